@@ -0,0 +1,180 @@
+// Copyright 2022 Daniel Parker
+// Distributed under Boost license
+
+// Usage: jsoncons_benchmarks [--data=DIR] [--filter=SUBSTRING] [--min-time=SECONDS] [--out=FILE]
+
+#include "benchmark_runner.hpp"
+#include "corpora.hpp"
+#include <jsoncons/json.hpp>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string>
+
+#ifndef JSONCONS_BENCHMARKS_DATA_DIR
+#define JSONCONS_BENCHMARKS_DATA_DIR "data"
+#endif
+
+namespace {
+
+    std::atomic<std::size_t> allocations(0);
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (p == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace jsoncons_benchmarks {
+
+    std::size_t allocation_count()
+    {
+        return allocations.load(std::memory_order_relaxed);
+    }
+
+    void benchmark_runner::run(const std::string& name, const std::string& corpus,
+                               std::size_t bytes_per_iteration, std::size_t items_per_iteration,
+                               const std::function<std::size_t()>& fn)
+    {
+        if (!enabled(name, corpus))
+        {
+            return;
+        }
+
+        std::size_t checksum = 0;
+        std::size_t before = allocation_count();
+        checksum += fn();
+        std::size_t allocations_per_iteration = allocation_count() - before;
+
+        std::size_t iterations = 0;
+        double seconds = 0;
+        auto start = std::chrono::steady_clock::now();
+        while (seconds < min_seconds_ || iterations < 3)
+        {
+            checksum += fn();
+            ++iterations;
+            seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        benchmark_result result{name, corpus, bytes_per_iteration, items_per_iteration,
+                                iterations, seconds, allocations_per_iteration};
+        if (items_per_iteration > 0)
+        {
+            std::printf("%-44s %-18s %10.1f MB/s %10.1f ns/item %10zu allocs/doc %8zu iterations\n",
+                        name.c_str(), corpus.c_str(), result.mb_per_second(), result.ns_per_item(),
+                        allocations_per_iteration, iterations);
+        }
+        else
+        {
+            std::printf("%-44s %-18s %10.1f MB/s %10zu allocs/doc %8zu iterations\n",
+                        name.c_str(), corpus.c_str(), result.mb_per_second(),
+                        allocations_per_iteration, iterations);
+        }
+        std::fflush(stdout);
+        if (checksum == 0)
+        {
+            std::printf(" ");
+        }
+        results_.push_back(std::move(result));
+    }
+
+    void run_json_benchmarks(benchmark_runner& runner, const corpora& c);
+    void run_query_benchmarks(benchmark_runner& runner, const corpora& c);
+    void run_binary_benchmarks(benchmark_runner& runner, const corpora& c);
+    void run_csv_benchmarks(benchmark_runner& runner, const corpora& c);
+    void run_double_to_string_benchmarks(benchmark_runner& runner);
+
+} // namespace jsoncons_benchmarks
+
+using namespace jsoncons_benchmarks;
+
+int main(int argc, char** argv)
+{
+    std::string data_dir = JSONCONS_BENCHMARKS_DATA_DIR;
+    std::string filter;
+    std::string out;
+    double min_seconds = 0.5;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg.compare(0, 7, "--data=") == 0)
+        {
+            data_dir = arg.substr(7);
+        }
+        else if (arg.compare(0, 9, "--filter=") == 0)
+        {
+            filter = arg.substr(9);
+        }
+        else if (arg.compare(0, 11, "--min-time=") == 0)
+        {
+            min_seconds = std::atof(arg.c_str() + 11);
+        }
+        else if (arg.compare(0, 6, "--out=") == 0)
+        {
+            out = arg.substr(6);
+        }
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--data=DIR] [--filter=SUBSTRING] [--min-time=SECONDS] [--out=FILE]\n";
+            return 1;
+        }
+    }
+
+    corpora c = load_corpora(data_dir);
+    for (const text_corpus* corpus : {&c.twitter, &c.canada, &c.citm_catalog, &c.csv})
+    {
+        std::cout << corpus->name << ": " << corpus->text.size() << " bytes"
+                  << (corpus->generated ? " (generated)" : "") << "\n";
+    }
+    std::cout << c.nested_cbor.name << ": " << c.nested_cbor.bytes.size() << " bytes"
+              << (c.nested_cbor.generated ? " (generated)" : "") << "\n\n";
+
+    benchmark_runner runner(min_seconds, filter);
+    run_json_benchmarks(runner, c);
+    run_query_benchmarks(runner, c);
+    run_binary_benchmarks(runner, c);
+    run_csv_benchmarks(runner, c);
+    run_double_to_string_benchmarks(runner);
+
+    if (!out.empty())
+    {
+        jsoncons::json results(jsoncons::json_array_arg);
+        for (const auto& result : runner.results())
+        {
+            jsoncons::json item;
+            item["name"] = result.name;
+            item["corpus"] = result.corpus;
+            item["mb_per_second"] = result.mb_per_second();
+            item["allocations_per_document"] = result.allocations_per_iteration;
+            item["iterations"] = result.iterations;
+            if (result.items_per_iteration > 0)
+            {
+                item["ns_per_item"] = result.ns_per_item();
+            }
+            results.push_back(std::move(item));
+        }
+        std::ofstream os(out);
+        os << jsoncons::pretty_print(results) << "\n";
+    }
+}
@@ -0,0 +1,83 @@
+// Copyright 2022 Daniel Parker
+// Distributed under Boost license
+
+#ifndef JSONCONS_BENCHMARKS_BENCHMARK_RUNNER_HPP
+#define JSONCONS_BENCHMARKS_BENCHMARK_RUNNER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace jsoncons_benchmarks {
+
+    // Counts calls to the global operator new, see benchmark_main.cpp
+    std::size_t allocation_count();
+
+    struct benchmark_result
+    {
+        std::string name;
+        std::string corpus;
+        std::size_t bytes_per_iteration;
+        std::size_t items_per_iteration;
+        std::size_t iterations;
+        double seconds;
+        std::size_t allocations_per_iteration;
+
+        double mb_per_second() const
+        {
+            return seconds > 0 ? (static_cast<double>(bytes_per_iteration)*iterations/(1024.0*1024.0))/seconds : 0;
+        }
+
+        double ns_per_item() const
+        {
+            return items_per_iteration > 0 ? seconds*1e9/(static_cast<double>(items_per_iteration)*iterations) : 0;
+        }
+    };
+
+    // Runs each benchmark once to count allocations and warm up the caches,
+    // then repeatedly until min_seconds have elapsed. The throughput is
+    // computed from the size of the input (or output, for encoders) of one
+    // iteration, so results for different corpora are comparable.
+
+    class benchmark_runner
+    {
+        double min_seconds_;
+        std::string filter_;
+        std::vector<benchmark_result> results_;
+    public:
+        benchmark_runner(double min_seconds, const std::string& filter)
+            : min_seconds_(min_seconds), filter_(filter)
+        {
+        }
+
+        bool enabled(const std::string& name, const std::string& corpus) const
+        {
+            return filter_.empty() || (name + "/" + corpus).find(filter_) != std::string::npos;
+        }
+
+        // fn performs one iteration, it returns a value that depends on the
+        // work done so that the optimizer cannot remove it
+        void run(const std::string& name, const std::string& corpus,
+                 std::size_t bytes_per_iteration, std::size_t items_per_iteration,
+                 const std::function<std::size_t()>& fn);
+
+        void run(const std::string& name, const std::string& corpus,
+                 std::size_t bytes_per_iteration,
+                 const std::function<std::size_t()>& fn)
+        {
+            run(name, corpus, bytes_per_iteration, 0, fn);
+        }
+
+        const std::vector<benchmark_result>& results() const
+        {
+            return results_;
+        }
+    };
+
+} // namespace jsoncons_benchmarks
+
+#endif
@@ -0,0 +1,198 @@
+// Copyright 2022 Daniel Parker
+// Distributed under Boost license
+
+// cbor, msgpack, bson and ubjson encoding, decoding and cursor skipping of
+// the JSON corpora and the nested CBOR corpus. Throughput is relative to the
+// size of the encoded data.
+
+#include "benchmark_runner.hpp"
+#include "corpora.hpp"
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <jsoncons_ext/msgpack/msgpack.hpp>
+#include <jsoncons_ext/bson/bson.hpp>
+#include <jsoncons_ext/ubjson/ubjson.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace jsoncons_benchmarks {
+
+namespace {
+
+    struct cbor_format
+    {
+        using cursor_type = jsoncons::cbor::cbor_bytes_cursor;
+
+        static constexpr const char* name = "cbor";
+
+        static void encode(const jsoncons::json& j, std::vector<uint8_t>& bytes)
+        {
+            jsoncons::cbor::encode_cbor(j, bytes);
+        }
+
+        static jsoncons::json decode(const std::vector<uint8_t>& bytes)
+        {
+            return jsoncons::cbor::decode_cbor<jsoncons::json>(bytes);
+        }
+    };
+
+    struct cbor_packed_format
+    {
+        using cursor_type = jsoncons::cbor::cbor_bytes_cursor;
+
+        static constexpr const char* name = "cbor pack_strings";
+
+        static void encode(const jsoncons::json& j, std::vector<uint8_t>& bytes)
+        {
+            jsoncons::cbor::cbor_options options;
+            options.pack_strings(true);
+            jsoncons::cbor::encode_cbor(j, bytes, options);
+        }
+
+        static jsoncons::json decode(const std::vector<uint8_t>& bytes)
+        {
+            return jsoncons::cbor::decode_cbor<jsoncons::json>(bytes);
+        }
+    };
+
+    struct msgpack_format
+    {
+        using cursor_type = jsoncons::msgpack::msgpack_bytes_cursor;
+
+        static constexpr const char* name = "msgpack";
+
+        static void encode(const jsoncons::json& j, std::vector<uint8_t>& bytes)
+        {
+            jsoncons::msgpack::encode_msgpack(j, bytes);
+        }
+
+        static jsoncons::json decode(const std::vector<uint8_t>& bytes)
+        {
+            return jsoncons::msgpack::decode_msgpack<jsoncons::json>(bytes);
+        }
+    };
+
+    struct bson_format
+    {
+        using cursor_type = jsoncons::bson::bson_bytes_cursor;
+
+        static constexpr const char* name = "bson";
+
+        static void encode(const jsoncons::json& j, std::vector<uint8_t>& bytes)
+        {
+            jsoncons::bson::encode_bson(j, bytes);
+        }
+
+        static jsoncons::json decode(const std::vector<uint8_t>& bytes)
+        {
+            return jsoncons::bson::decode_bson<jsoncons::json>(bytes);
+        }
+    };
+
+    struct ubjson_format
+    {
+        using cursor_type = jsoncons::ubjson::ubjson_bytes_cursor;
+
+        static constexpr const char* name = "ubjson";
+
+        static void encode(const jsoncons::json& j, std::vector<uint8_t>& bytes)
+        {
+            jsoncons::ubjson::encode_ubjson(j, bytes);
+        }
+
+        static jsoncons::json decode(const std::vector<uint8_t>& bytes)
+        {
+            return jsoncons::ubjson::decode_ubjson<jsoncons::json>(bytes);
+        }
+    };
+
+    template <class Format>
+    void run_format(benchmark_runner& runner, const std::string& corpus_name, const jsoncons::json& j)
+    {
+        const std::string encode_name = std::string(Format::name) + " encode";
+        const std::string decode_name = std::string(Format::name) + " decode";
+        const std::string skip_name = std::string(Format::name) + " cursor skip";
+        if (!runner.enabled(encode_name, corpus_name) && !runner.enabled(decode_name, corpus_name) &&
+            !runner.enabled(skip_name, corpus_name))
+        {
+            return;
+        }
+
+        std::vector<uint8_t> encoded;
+        Format::encode(j, encoded);
+
+        runner.run(encode_name, corpus_name, encoded.size(), [&]() -> std::size_t
+        {
+            std::vector<uint8_t> bytes;
+            Format::encode(j, bytes);
+            return bytes.size();
+        });
+
+        runner.run(decode_name, corpus_name, encoded.size(), [&]() -> std::size_t
+        {
+            jsoncons::json result = Format::decode(encoded);
+            return result.size();
+        });
+
+        // Reads the events of the root and skips over its members or elements
+        runner.run(skip_name, corpus_name, encoded.size(), [&]() -> std::size_t
+        {
+            typename Format::cursor_type cursor(encoded);
+            std::size_t count = 0;
+            for (cursor.next(); !cursor.done(); cursor.next())
+            {
+                cursor.skip();
+                ++count;
+            }
+            return count;
+        });
+    }
+
+} // namespace
+
+    void run_binary_benchmarks(benchmark_runner& runner, const corpora& c)
+    {
+        using jsoncons::json;
+
+        for (const text_corpus* corpus : c.json_corpora())
+        {
+            json j = json::parse(corpus->text);
+            run_format<cbor_format>(runner, corpus->name, j);
+            run_format<cbor_packed_format>(runner, corpus->name, j);
+            run_format<msgpack_format>(runner, corpus->name, j);
+            run_format<bson_format>(runner, corpus->name, j);
+            run_format<ubjson_format>(runner, corpus->name, j);
+        }
+
+        const std::vector<uint8_t>& bytes = c.nested_cbor.bytes;
+        runner.run("cbor decode", c.nested_cbor.name, bytes.size(), [&]() -> std::size_t
+        {
+            json j = jsoncons::cbor::decode_cbor<json>(bytes);
+            return j.size();
+        });
+
+        runner.run("cbor_cursor", c.nested_cbor.name, bytes.size(), [&]() -> std::size_t
+        {
+            jsoncons::cbor::cbor_bytes_cursor cursor(bytes);
+            std::size_t count = 0;
+            for (; !cursor.done(); cursor.next())
+            {
+                ++count;
+            }
+            return count;
+        });
+
+        if (runner.enabled("cbor encode", c.nested_cbor.name))
+        {
+            json j = jsoncons::cbor::decode_cbor<json>(bytes);
+            runner.run("cbor encode", c.nested_cbor.name, bytes.size(), [&]() -> std::size_t
+            {
+                std::vector<uint8_t> buffer;
+                jsoncons::cbor::encode_cbor(j, buffer);
+                return buffer.size();
+            });
+        }
+    }
+
+} // namespace jsoncons_benchmarks
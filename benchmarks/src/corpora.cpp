@@ -0,0 +1,344 @@
+// Copyright 2022 Daniel Parker
+// Distributed under Boost license
+
+#include "corpora.hpp"
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using jsoncons::json;
+
+namespace jsoncons_benchmarks {
+
+namespace {
+
+    bool read_file(const std::string& path, std::string& content)
+    {
+        std::ifstream is(path, std::ios::binary);
+        if (!is)
+        {
+            return false;
+        }
+        std::ostringstream os;
+        os << is.rdbuf();
+        content = os.str();
+        return true;
+    }
+
+    const char* const words[] = {"lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit",
+                                 "sed", "do", "eiusmod", "tempor", "incididunt", "ut", "labore", "et", "dolore",
+                                 "magna", "aliqua", "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E", "caf\xC3\xA9",
+                                 "\xD0\xBC\xD0\xB8\xD1\x80", "\"quoted\"", "tab\there", "line\nbreak"};
+
+    std::string sentence(std::mt19937& gen, std::size_t count)
+    {
+        std::uniform_int_distribution<std::size_t> dist(0, sizeof(words)/sizeof(words[0]) - 1);
+        std::string s;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (i > 0)
+            {
+                s.push_back(' ');
+            }
+            s.append(words[dist(gen)]);
+        }
+        return s;
+    }
+
+    std::string generate_twitter()
+    {
+        std::mt19937 gen(1);
+        std::uniform_int_distribution<int64_t> id_dist(100000000000000000LL, 999999999999999999LL);
+        std::uniform_int_distribution<int> count_dist(0, 100000);
+
+        json statuses(jsoncons::json_array_arg);
+        for (int i = 0; i < 300; ++i)
+        {
+            int64_t id = id_dist(gen);
+            json user;
+            user["id"] = count_dist(gen);
+            user["name"] = sentence(gen, 2);
+            user["screen_name"] = "user" + std::to_string(i % 97);
+            user["location"] = sentence(gen, 1);
+            user["description"] = sentence(gen, 12);
+            user["url"] = json::null();
+            user["protected"] = false;
+            user["followers_count"] = count_dist(gen);
+            user["friends_count"] = count_dist(gen);
+            user["created_at"] = "Sun Aug 31 00:29:15 +0000 2014";
+            user["verified"] = i % 13 == 0;
+            user["lang"] = "ja";
+
+            json hashtags(jsoncons::json_array_arg);
+            for (int k = 0; k < i % 3; ++k)
+            {
+                json tag;
+                tag["text"] = sentence(gen, 1);
+                tag["indices"] = json(jsoncons::json_array_arg, {json(k*10), json(k*10 + 8)});
+                hashtags.push_back(std::move(tag));
+            }
+            json entities;
+            entities["hashtags"] = std::move(hashtags);
+            entities["symbols"] = json(jsoncons::json_array_arg);
+            entities["urls"] = json(jsoncons::json_array_arg);
+
+            json status;
+            status["created_at"] = "Sun Aug 31 00:29:15 +0000 2014";
+            status["id"] = id;
+            status["id_str"] = std::to_string(id);
+            status["text"] = sentence(gen, 20);
+            status["source"] = "<a href=\"https://example.com\" rel=\"nofollow\">web</a>";
+            status["truncated"] = false;
+            status["in_reply_to_status_id"] = json::null();
+            status["user"] = std::move(user);
+            status["entities"] = std::move(entities);
+            status["retweet_count"] = count_dist(gen);
+            status["favorite_count"] = count_dist(gen);
+            status["favorited"] = false;
+            status["retweeted"] = false;
+            status["lang"] = "ja";
+            statuses.push_back(std::move(status));
+        }
+
+        json metadata;
+        metadata["completed_in"] = 0.087;
+        metadata["max_id"] = 505874924095815681LL;
+        metadata["query"] = "%E4%B8%80";
+        metadata["count"] = 300;
+
+        json root;
+        root["statuses"] = std::move(statuses);
+        root["search_metadata"] = std::move(metadata);
+        std::string s;
+        root.dump(s, jsoncons::indenting::indent);
+        return s;
+    }
+
+    std::string generate_canada()
+    {
+        std::mt19937 gen(2);
+        std::uniform_real_distribution<double> step(-0.01, 0.01);
+
+        json rings(jsoncons::json_array_arg);
+        for (int r = 0; r < 40; ++r)
+        {
+            json ring(jsoncons::json_array_arg);
+            double x = -65.613616999999977;
+            double y = 43.420273000000009;
+            for (int i = 0; i < 1400; ++i)
+            {
+                x += step(gen);
+                y += step(gen);
+                ring.push_back(json(jsoncons::json_array_arg, {json(x), json(y)}));
+            }
+            rings.push_back(std::move(ring));
+        }
+
+        json geometry;
+        geometry["type"] = "Polygon";
+        geometry["coordinates"] = std::move(rings);
+
+        json feature;
+        feature["type"] = "Feature";
+        feature["properties"] = json(jsoncons::json_object_arg, {{"name", "Canada"}});
+        feature["geometry"] = std::move(geometry);
+
+        json root;
+        root["type"] = "FeatureCollection";
+        root["features"] = json(jsoncons::json_array_arg, {std::move(feature)});
+        std::string s;
+        root.dump(s);
+        return s;
+    }
+
+    std::string generate_citm_catalog()
+    {
+        std::mt19937 gen(3);
+        std::uniform_int_distribution<int64_t> id_dist(100000000, 999999999);
+
+        json area_names;
+        for (int i = 0; i < 20; ++i)
+        {
+            area_names[std::to_string(205705993 + i)] = sentence(gen, 2);
+        }
+
+        json events;
+        for (int i = 0; i < 180; ++i)
+        {
+            int64_t id = 138586341 + i;
+            json event;
+            event["description"] = json::null();
+            event["id"] = id;
+            event["logo"] = i % 4 == 0 ? json("/images/UE0AAAAACEKo6QAAAAZDSVRN") : json::null();
+            event["name"] = sentence(gen, 3);
+            event["subTopicIds"] = json(jsoncons::json_array_arg, {json(337184269), json(337184283)});
+            event["subjectCode"] = json::null();
+            event["subtitle"] = json::null();
+            event["topicIds"] = json(jsoncons::json_array_arg, {json(324846099), json(107888604)});
+            events[std::to_string(id)] = std::move(event);
+        }
+
+        json performances(jsoncons::json_array_arg);
+        for (int i = 0; i < 240; ++i)
+        {
+            json prices(jsoncons::json_array_arg);
+            json seat_categories(jsoncons::json_array_arg);
+            for (int k = 0; k < 4; ++k)
+            {
+                int64_t seat_category_id = id_dist(gen);
+                json price;
+                price["amount"] = 90250 - 10000*k;
+                price["audienceSubCategoryId"] = 337100890;
+                price["seatCategoryId"] = seat_category_id;
+                prices.push_back(std::move(price));
+
+                json areas(jsoncons::json_array_arg);
+                for (int a = 0; a < 3; ++a)
+                {
+                    json area;
+                    area["areaId"] = 205705993 + a + k;
+                    area["blockIds"] = json(jsoncons::json_array_arg);
+                    areas.push_back(std::move(area));
+                }
+                json seat_category;
+                seat_category["areas"] = std::move(areas);
+                seat_category["seatCategoryId"] = seat_category_id;
+                seat_categories.push_back(std::move(seat_category));
+            }
+            json performance;
+            performance["eventId"] = 138586341 + i % 180;
+            performance["id"] = 339887544 + i;
+            performance["logo"] = json::null();
+            performance["name"] = json::null();
+            performance["prices"] = std::move(prices);
+            performance["seatCategories"] = std::move(seat_categories);
+            performance["seatMapImage"] = json::null();
+            performance["start"] = 1372701600000LL + 86400000LL*i;
+            performance["venueCode"] = i % 3 == 0 ? "PLEYEL_PLEYEL" : "MOGADOR";
+            performances.push_back(std::move(performance));
+        }
+
+        json root;
+        root["areaNames"] = std::move(area_names);
+        root["events"] = std::move(events);
+        root["performances"] = std::move(performances);
+        root["venueNames"] = json(jsoncons::json_object_arg, {{"PLEYEL_PLEYEL", "Salle Pleyel"}, {"MOGADOR", "Theatre Mogador"}});
+        std::string s;
+        root.dump(s, jsoncons::indenting::indent);
+        return s;
+    }
+
+    std::string generate_csv()
+    {
+        std::mt19937 gen(4);
+        std::uniform_int_distribution<int> int_dist(0, 1000000);
+        std::uniform_real_distribution<double> real_dist(-1000.0, 1000.0);
+
+        std::string s = "id,date,symbol,open,close,volume,comment\n";
+        for (int i = 0; i < 20000; ++i)
+        {
+            s += std::to_string(i);
+            s += ",2022-";
+            s += std::to_string(1 + i % 12);
+            s += "-";
+            s += std::to_string(1 + i % 28);
+            s += ",SYM";
+            s += std::to_string(i % 50);
+            s += ",";
+            s += std::to_string(real_dist(gen));
+            s += ",";
+            s += std::to_string(real_dist(gen));
+            s += ",";
+            s += std::to_string(int_dist(gen));
+            s += ",\"";
+            for (char ch : sentence(gen, 4))
+            {
+                if (ch == '"')
+                {
+                    s.push_back('"');
+                }
+                s.push_back(ch);
+            }
+            s += "\"\n";
+        }
+        return s;
+    }
+
+    json nested_node(std::mt19937& gen, int depth)
+    {
+        json node;
+        node["id"] = static_cast<int64_t>(gen());
+        node["name"] = sentence(gen, 2);
+        node["weight"] = static_cast<double>(gen() % 10000)/100.0;
+        if (depth > 0)
+        {
+            json children(jsoncons::json_array_arg);
+            for (int i = 0; i < 4; ++i)
+            {
+                children.push_back(nested_node(gen, depth - 1));
+            }
+            node["children"] = std::move(children);
+        }
+        return node;
+    }
+
+    std::vector<uint8_t> generate_nested_cbor()
+    {
+        std::mt19937 gen(5);
+        json root = nested_node(gen, 6);
+
+        // and a chain of singly nested arrays
+        json chain(jsoncons::json_array_arg, {json("leaf")});
+        for (int i = 0; i < 200; ++i)
+        {
+            chain = json(jsoncons::json_array_arg, {std::move(chain)});
+        }
+        root["chain"] = std::move(chain);
+
+        std::vector<uint8_t> bytes;
+        jsoncons::cbor::encode_cbor(root, bytes);
+        return bytes;
+    }
+
+    text_corpus make_text_corpus(const std::string& data_dir, const std::string& name, std::string (*generate)())
+    {
+        text_corpus corpus{name, std::string(), false};
+        if (!read_file(data_dir + "/" + name, corpus.text))
+        {
+            corpus.text = generate();
+            corpus.generated = true;
+        }
+        return corpus;
+    }
+
+} // namespace
+
+corpora load_corpora(const std::string& data_dir)
+{
+    corpora c;
+    c.twitter = make_text_corpus(data_dir, "twitter.json", generate_twitter);
+    c.canada = make_text_corpus(data_dir, "canada.json", generate_canada);
+    c.citm_catalog = make_text_corpus(data_dir, "citm_catalog.json", generate_citm_catalog);
+    c.csv = make_text_corpus(data_dir, "large.csv", generate_csv);
+
+    c.nested_cbor.name = "nested.cbor";
+    std::string content;
+    if (read_file(data_dir + "/nested.cbor", content))
+    {
+        c.nested_cbor.bytes.assign(content.begin(), content.end());
+        c.nested_cbor.generated = false;
+    }
+    else
+    {
+        c.nested_cbor.bytes = generate_nested_cbor();
+        c.nested_cbor.generated = true;
+    }
+    return c;
+}
+
+} // namespace jsoncons_benchmarks
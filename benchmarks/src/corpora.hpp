@@ -0,0 +1,52 @@
+// Copyright 2022 Daniel Parker
+// Distributed under Boost license
+
+#ifndef JSONCONS_BENCHMARKS_CORPORA_HPP
+#define JSONCONS_BENCHMARKS_CORPORA_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace jsoncons_benchmarks {
+
+    struct text_corpus
+    {
+        std::string name;
+        std::string text;
+        bool generated;
+    };
+
+    struct binary_corpus
+    {
+        std::string name;
+        std::vector<uint8_t> bytes;
+        bool generated;
+    };
+
+    // The canonical corpora, read from data_dir when present (twitter.json,
+    // canada.json, citm_catalog.json, large.csv and nested.cbor), otherwise
+    // generated with the same shape: twitter is string heavy with unicode and
+    // nested objects, canada is an array of coordinate pairs, citm_catalog
+    // has many small objects with integer values, large.csv has a header row
+    // and mixed columns, nested.cbor is a deeply nested CBOR item.
+
+    struct corpora
+    {
+        text_corpus twitter;
+        text_corpus canada;
+        text_corpus citm_catalog;
+        text_corpus csv;
+        binary_corpus nested_cbor;
+
+        std::vector<const text_corpus*> json_corpora() const
+        {
+            return {&twitter, &canada, &citm_catalog};
+        }
+    };
+
+    corpora load_corpora(const std::string& data_dir);
+
+} // namespace jsoncons_benchmarks
+
+#endif
@@ -0,0 +1,51 @@
+// Copyright 2022 Daniel Parker
+// Distributed under Boost license
+
+// csv decoding to json and encoding from json
+
+#include "benchmark_runner.hpp"
+#include "corpora.hpp"
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/csv/csv.hpp>
+#include <string>
+
+namespace jsoncons_benchmarks {
+
+    void run_csv_benchmarks(benchmark_runner& runner, const corpora& c)
+    {
+        using jsoncons::ojson;
+
+        const std::string& text = c.csv.text;
+        auto options = jsoncons::csv::csv_options{}
+            .assume_header(true);
+
+        runner.run("decode_csv", c.csv.name, text.size(), [&]() -> std::size_t
+        {
+            ojson j = jsoncons::csv::decode_csv<ojson>(text, options);
+            return j.size();
+        });
+
+        runner.run("decode_csv (m_columns)", c.csv.name, text.size(), [&]() -> std::size_t
+        {
+            auto m_options = jsoncons::csv::csv_options{}
+                .assume_header(true)
+                .mapping(jsoncons::csv::csv_mapping_kind::m_columns);
+            ojson j = jsoncons::csv::decode_csv<ojson>(text, m_options);
+            return j.size();
+        });
+
+        if (runner.enabled("encode_csv", c.csv.name))
+        {
+            ojson j = jsoncons::csv::decode_csv<ojson>(text, options);
+            std::string encoded;
+            jsoncons::csv::encode_csv(j, encoded);
+            runner.run("encode_csv", c.csv.name, encoded.size(), [&]() -> std::size_t
+            {
+                std::string s;
+                jsoncons::csv::encode_csv(j, s);
+                return s.size();
+            });
+        }
+    }
+
+} // namespace jsoncons_benchmarks
@@ -0,0 +1,121 @@
+// Copyright 2022 Daniel Parker
+// Distributed under Boost license
+
+// Measures the cost per double of jsoncons::detail::write_double with the
+// default (shortest representation) precision, against snprintf with 17
+// significant digits.
+
+#include "benchmark_runner.hpp"
+#include <jsoncons/detail/write_number.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace jsoncons_benchmarks {
+
+namespace {
+
+    std::vector<double> telemetry_values(std::size_t count)
+    {
+        // sensor readings with two decimals
+        std::mt19937_64 gen(1);
+        std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+        std::vector<double> values;
+        values.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            values.push_back(std::round(dist(gen)*100.0)/100.0);
+        }
+        return values;
+    }
+
+    std::vector<double> random_bit_values(std::size_t count)
+    {
+        // uniformly distributed bit patterns, most need 16 or 17 digits
+        std::mt19937_64 gen(2);
+        std::vector<double> values;
+        values.reserve(count);
+        while (values.size() < count)
+        {
+            uint64_t bits = gen();
+            double d;
+            std::memcpy(&d, &bits, sizeof(double));
+            if (std::isfinite(d))
+            {
+                values.push_back(d);
+            }
+        }
+        return values;
+    }
+
+    std::vector<double> integer_values(std::size_t count)
+    {
+        std::mt19937_64 gen(3);
+        std::uniform_int_distribution<int64_t> dist(-1000000, 1000000);
+        std::vector<double> values;
+        values.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            values.push_back(static_cast<double>(dist(gen)));
+        }
+        return values;
+    }
+
+} // namespace
+
+    void run_double_to_string_benchmarks(benchmark_runner& runner)
+    {
+        const std::size_t count = 100000;
+        const std::pair<const char*,std::vector<double>> corpora[] = {
+            {"telemetry", telemetry_values(count)},
+            {"random bits", random_bit_values(count)},
+            {"integers", integer_values(count)}
+        };
+
+        for (const auto& corpus : corpora)
+        {
+            const std::vector<double>& values = corpus.second;
+
+            jsoncons::detail::write_double writer(jsoncons::float_chars_format::general, 0);
+            std::string s;
+            for (double d : values)
+            {
+                writer(d, s);
+            }
+            runner.run("write_double", corpus.first, s.size(), values.size(), [&]() -> std::size_t
+            {
+                std::size_t total = 0;
+                std::string buffer;
+                for (double d : values)
+                {
+                    buffer.clear();
+                    writer(d, buffer);
+                    total += buffer.size();
+                }
+                return total;
+            });
+
+            std::size_t printf17_size = 0;
+            char buffer[64];
+            for (double d : values)
+            {
+                printf17_size += static_cast<std::size_t>(snprintf(buffer, sizeof(buffer), "%.17g", d));
+            }
+            runner.run("snprintf %.17g", corpus.first, printf17_size, values.size(), [&]() -> std::size_t
+            {
+                std::size_t total = 0;
+                for (double d : values)
+                {
+                    total += static_cast<std::size_t>(snprintf(buffer, sizeof(buffer), "%.17g", d));
+                }
+                return total;
+            });
+        }
+    }
+
+} // namespace jsoncons_benchmarks
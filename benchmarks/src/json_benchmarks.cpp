@@ -0,0 +1,160 @@
+// Copyright 2022 Daniel Parker
+// Distributed under Boost license
+
+// json::parse, json_encoder, json_cursor (reading and skipping) and
+// decode_json/encode_json with
+// user types
+
+#include "benchmark_runner.hpp"
+#include "corpora.hpp"
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_cursor.hpp>
+#include <jsoncons/ndjson_reader.hpp>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace canada {
+
+    struct polygon
+    {
+        std::string type;
+        std::vector<std::vector<std::vector<double>>> coordinates;
+    };
+
+    struct feature
+    {
+        std::string type;
+        std::map<std::string,std::string> properties;
+        polygon geometry;
+    };
+
+    struct feature_collection
+    {
+        std::string type;
+        std::vector<feature> features;
+    };
+
+} // namespace canada
+
+JSONCONS_ALL_MEMBER_TRAITS(canada::polygon, type, coordinates)
+JSONCONS_ALL_MEMBER_TRAITS(canada::feature, type, properties, geometry)
+JSONCONS_ALL_MEMBER_TRAITS(canada::feature_collection, type, features)
+
+namespace jsoncons_benchmarks {
+
+    void run_json_benchmarks(benchmark_runner& runner, const corpora& c)
+    {
+        using jsoncons::json;
+
+        for (const text_corpus* corpus : c.json_corpora())
+        {
+            const std::string& text = corpus->text;
+
+            runner.run("json::parse", corpus->name, text.size(), [&]() -> std::size_t
+            {
+                json j = json::parse(text);
+                return j.size();
+            });
+
+            runner.run("ojson::parse", corpus->name, text.size(), [&]() -> std::size_t
+            {
+                jsoncons::ojson j = jsoncons::ojson::parse(text);
+                return j.size();
+            });
+
+            json j = json::parse(text);
+            std::string compact;
+            j.dump(compact);
+            std::string pretty;
+            j.dump(pretty, jsoncons::indenting::indent);
+
+            runner.run("json_encoder", corpus->name, compact.size(), [&]() -> std::size_t
+            {
+                std::string s;
+                jsoncons::compact_json_string_encoder encoder(s);
+                j.dump(encoder);
+                return s.size();
+            });
+
+            runner.run("json_encoder (indented)", corpus->name, pretty.size(), [&]() -> std::size_t
+            {
+                std::string s;
+                jsoncons::json_string_encoder encoder(s);
+                j.dump(encoder);
+                return s.size();
+            });
+
+            runner.run("json_cursor", corpus->name, text.size(), [&]() -> std::size_t
+            {
+                jsoncons::json_string_cursor cursor(text);
+                std::size_t count = 0;
+                for (; !cursor.done(); cursor.next())
+                {
+                    ++count;
+                }
+                return count;
+            });
+
+            // Reads the events of the root and skips over its members or elements
+            runner.run("json_cursor skip", corpus->name, text.size(), [&]() -> std::size_t
+            {
+                jsoncons::json_string_cursor cursor(text);
+                std::size_t count = 0;
+                for (cursor.next(); !cursor.done(); cursor.next())
+                {
+                    cursor.skip();
+                    ++count;
+                }
+                return count;
+            });
+        }
+
+        if (runner.enabled("ndjson_reader", c.twitter.name))
+        {
+            // One status per line
+            std::string lines;
+            json j = json::parse(c.twitter.text);
+            for (const auto& status : j["statuses"].array_range())
+            {
+                std::string line;
+                status.dump(line);
+                lines += line;
+                lines.push_back('\n');
+            }
+
+            runner.run("ndjson_reader (1 thread)", c.twitter.name, lines.size(), [&]() -> std::size_t
+            {
+                jsoncons::ndjson_reader<json> reader(jsoncons::ndjson_options{}.num_threads(1).chunk_size(64*1024));
+                return reader.read(lines, [](jsoncons::ndjson_record<json>&) {return true;});
+            });
+
+            runner.run("ndjson_reader", c.twitter.name, lines.size(), [&]() -> std::size_t
+            {
+                jsoncons::ndjson_reader<json> reader(jsoncons::ndjson_options{}.chunk_size(64*1024));
+                return reader.read(lines, [](jsoncons::ndjson_record<json>&) {return true;});
+            });
+        }
+
+        const std::string& text = c.canada.text;
+        if (runner.enabled("decode_json<T>", c.canada.name) || runner.enabled("encode_json<T>", c.canada.name))
+        {
+            runner.run("decode_json<T>", c.canada.name, text.size(), [&]() -> std::size_t
+            {
+                auto collection = jsoncons::decode_json<canada::feature_collection>(text);
+                return collection.features.size();
+            });
+
+            auto collection = jsoncons::decode_json<canada::feature_collection>(text);
+            std::string s;
+            jsoncons::encode_json(collection, s);
+            runner.run("encode_json<T>", c.canada.name, s.size(), [&]() -> std::size_t
+            {
+                std::string buffer;
+                jsoncons::encode_json(collection, buffer);
+                return buffer.size();
+            });
+        }
+    }
+
+} // namespace jsoncons_benchmarks
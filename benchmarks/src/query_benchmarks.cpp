@@ -0,0 +1,353 @@
+// Copyright 2022 Daniel Parker
+// Distributed under Boost license
+
+// jsonpath and jmespath evaluation, jsonpointer lookups and jsonschema validation
+// against parsed documents, jsonpath queries streamed over a cursor, and jsonpatch
+// diffs of keyed arrays. Throughput is relative to the size of the document's JSON text.
+
+#include "benchmark_runner.hpp"
+#include "corpora.hpp"
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_cursor.hpp>
+#include <jsoncons_ext/jsonpath/jsonpath.hpp>
+#include <jsoncons_ext/jmespath/jmespath.hpp>
+#include <jsoncons_ext/jsonschema/jsonschema.hpp>
+#include <jsoncons_ext/jsonpointer/jsonpointer.hpp>
+#include <jsoncons_ext/jsonpatch/jsonpatch.hpp>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace jsoncons_benchmarks {
+
+namespace {
+
+    struct query
+    {
+        const text_corpus* corpus;
+        std::string jsonpath;
+        std::string jmespath;
+    };
+
+    const char* const twitter_schema = R"(
+{
+    "$schema": "http://json-schema.org/draft-07/schema#",
+    "type": "object",
+    "required": ["statuses"],
+    "properties": {
+        "statuses": {
+            "type": "array",
+            "items": {
+                "type": "object",
+                "required": ["id", "text", "user"],
+                "properties": {
+                    "id": {"type": "integer"},
+                    "id_str": {"type": "string", "pattern": "^[0-9]+$"},
+                    "text": {"type": "string", "maxLength": 1000},
+                    "user": {
+                        "type": "object",
+                        "required": ["id", "screen_name"],
+                        "properties": {
+                            "id": {"type": "integer", "minimum": 0},
+                            "screen_name": {"type": "string"},
+                            "followers_count": {"type": "integer", "minimum": 0}
+                        }
+                    },
+                    "entities": {
+                        "type": "object",
+                        "properties": {
+                            "hashtags": {"type": "array", "items": {"type": "object"}}
+                        }
+                    },
+                    "retweet_count": {"type": "integer"},
+                    "favorited": {"type": "boolean"}
+                }
+            }
+        }
+    }
+}
+    )";
+
+    const char* const canada_schema = R"(
+{
+    "$schema": "http://json-schema.org/draft-07/schema#",
+    "type": "object",
+    "required": ["type", "features"],
+    "properties": {
+        "type": {"enum": ["FeatureCollection"]},
+        "features": {
+            "type": "array",
+            "items": {
+                "type": "object",
+                "properties": {
+                    "type": {"const": "Feature"},
+                    "geometry": {
+                        "type": "object",
+                        "properties": {
+                            "coordinates": {
+                                "type": "array",
+                                "items": {
+                                    "type": "array",
+                                    "items": {
+                                        "type": "array",
+                                        "minItems": 2,
+                                        "maxItems": 2,
+                                        "items": {"type": "number"}
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+    )";
+
+    const char* const citm_catalog_schema = R"(
+{
+    "$schema": "http://json-schema.org/draft-07/schema#",
+    "type": "object",
+    "properties": {
+        "areaNames": {"type": "object", "additionalProperties": {"type": "string"}},
+        "events": {
+            "type": "object",
+            "additionalProperties": {
+                "type": "object",
+                "required": ["id", "name"],
+                "properties": {
+                    "id": {"type": "integer"},
+                    "name": {"type": "string"},
+                    "topicIds": {"type": "array", "items": {"type": "integer"}}
+                }
+            }
+        },
+        "performances": {
+            "type": "array",
+            "items": {
+                "type": "object",
+                "required": ["id", "eventId", "prices"],
+                "properties": {
+                    "id": {"type": "integer"},
+                    "eventId": {"type": "integer"},
+                    "prices": {
+                        "type": "array",
+                        "items": {
+                            "type": "object",
+                            "properties": {
+                                "amount": {"type": "integer", "minimum": 0}
+                            }
+                        }
+                    },
+                    "venueCode": {"type": "string"}
+                }
+            }
+        }
+    }
+}
+    )";
+
+} // namespace
+
+    void run_query_benchmarks(benchmark_runner& runner, const corpora& c)
+    {
+        using jsoncons::json;
+
+        std::vector<query> queries = {
+            {&c.twitter, "$.statuses[*].user.screen_name", "statuses[*].user.screen_name"},
+            {&c.twitter, "$..id", "statuses[?retweet_count > `50000`].id"},
+            {&c.canada, "$.features[0].geometry.coordinates[0][*][0]", "features[0].geometry.coordinates[0][*][0]"},
+            {&c.citm_catalog, "$.performances[?(@.venueCode == 'PLEYEL_PLEYEL')].id", "performances[?venueCode == 'PLEYEL_PLEYEL'].id"}
+        };
+
+        for (const auto& q : queries)
+        {
+            const std::string& name = q.corpus->name;
+            const std::size_t size = q.corpus->text.size();
+            const bool jsonpath_enabled = runner.enabled("jsonpath " + q.jsonpath, name) ||
+                                          runner.enabled("jsonpath context " + q.jsonpath, name);
+            const bool jmespath_enabled = runner.enabled("jmespath " + q.jmespath, name) ||
+                                          runner.enabled("jmespath view " + q.jmespath, name) ||
+                                          runner.enabled("jmespath context " + q.jmespath, name);
+            if (!jsonpath_enabled && !jmespath_enabled)
+            {
+                continue;
+            }
+            json doc = json::parse(q.corpus->text);
+
+            auto path = jsoncons::jsonpath::make_expression<json>(q.jsonpath);
+            runner.run("jsonpath " + q.jsonpath, name, size, [&]() -> std::size_t
+            {
+                json result = path.evaluate(doc);
+                return result.size();
+            });
+
+            jsoncons::jsonpath::evaluation_context<json> context;
+            runner.run("jsonpath context " + q.jsonpath, name, size, [&]() -> std::size_t
+            {
+                json result = path.evaluate(context, doc);
+                return result.size();
+            });
+
+            auto expr = jsoncons::jmespath::make_expression<json>(q.jmespath);
+            runner.run("jmespath " + q.jmespath, name, size, [&]() -> std::size_t
+            {
+                json result = expr.evaluate(doc);
+                return result.size();
+            });
+
+            runner.run("jmespath view " + q.jmespath, name, size, [&]() -> std::size_t
+            {
+                auto result = expr.evaluate_view(doc);
+                return result->size();
+            });
+
+            jsoncons::jmespath::evaluation_context<json> jmespath_context;
+            runner.run("jmespath context " + q.jmespath, name, size, [&]() -> std::size_t
+            {
+                json result = expr.evaluate(jmespath_context, doc);
+                return result.size();
+            });
+        }
+
+        // Queries on the JSON text, parsing then querying a document, or streaming
+        // the query over a cursor
+        std::vector<query> text_queries = queries;
+        text_queries.push_back(query{&c.twitter, "$.statuses[0].id", ""});
+        for (const auto& q : text_queries)
+        {
+            const std::string& name = q.corpus->name;
+            const std::string& text = q.corpus->text;
+
+            runner.run("jsonpath parse " + q.jsonpath, name, text.size(), [&]() -> std::size_t
+            {
+                json doc = json::parse(text);
+                json result = jsoncons::jsonpath::json_query(doc, q.jsonpath);
+                return result.size();
+            });
+
+            runner.run("jsonpath stream " + q.jsonpath, name, text.size(), [&]() -> std::size_t
+            {
+                jsoncons::json_string_cursor cursor(text);
+                json result = jsoncons::jsonpath::stream_query<json>(cursor, q.jsonpath);
+                return result.size();
+            });
+        }
+
+        if (runner.enabled("jsonpointer get", c.twitter.name) || 
+            runner.enabled("jsonpointer compiled get", c.twitter.name) ||
+            runner.enabled("jsonpointer get_many", c.twitter.name))
+        {
+            const std::size_t size = c.twitter.text.size();
+            json doc = json::parse(c.twitter.text);
+            std::vector<std::string> pointers;
+            for (std::size_t i = 0; i < doc["statuses"].size(); ++i)
+            {
+                for (const char* member : {"/id", "/text", "/user/screen_name", "/user/followers_count"})
+                {
+                    pointers.push_back("/statuses/" + std::to_string(i) + member);
+                }
+            }
+
+            runner.run("jsonpointer get", c.twitter.name, size, [&]() -> std::size_t
+            {
+                std::size_t count = 0;
+                for (const auto& p : pointers)
+                {
+                    count += jsoncons::jsonpointer::get(doc, p).size();
+                }
+                return count;
+            });
+
+            std::vector<jsoncons::jsonpointer::compiled_json_pointer> compiled;
+            for (const auto& p : pointers)
+            {
+                compiled.emplace_back(p);
+            }
+            runner.run("jsonpointer compiled get", c.twitter.name, size, [&]() -> std::size_t
+            {
+                std::size_t count = 0;
+                for (const auto& p : compiled)
+                {
+                    count += jsoncons::jsonpointer::get(doc, p).size();
+                }
+                return count;
+            });
+
+            std::sort(compiled.begin(), compiled.end());
+            std::vector<json*> results;
+            runner.run("jsonpointer get_many", c.twitter.name, size, [&]() -> std::size_t
+            {
+                jsoncons::jsonpointer::get_many(doc, compiled, results);
+                std::size_t count = 0;
+                for (auto p : results)
+                {
+                    count += p->size();
+                }
+                return count;
+            });
+        }
+
+        const std::vector<std::pair<const text_corpus*,const char*>> schemas = {
+            {&c.twitter, twitter_schema},
+            {&c.canada, canada_schema},
+            {&c.citm_catalog, citm_catalog_schema}
+        };
+        for (const auto& item : schemas)
+        {
+            const std::string& name = item.first->name;
+            if (!runner.enabled("jsonschema validate", name))
+            {
+                continue;
+            }
+            json doc = json::parse(item.first->text);
+            auto schema = jsoncons::jsonschema::make_schema(json::parse(item.second));
+            jsoncons::jsonschema::json_validator<json> validator(schema);
+
+            runner.run("jsonschema validate", name, item.first->text.size(), [&]() -> std::size_t
+            {
+                return validator.is_valid(doc) ? 1 : 2;
+            });
+        }
+
+        // Diffs an array of objects against a shuffled copy, matching the
+        // elements by their "id" member, so that nearly every element is moved
+        const std::string keyed = "100000 keyed objects";
+        if (runner.enabled("jsonpatch from_diff by key", keyed))
+        {
+            const std::size_t n = 100000;
+            std::vector<std::size_t> ids(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                ids[i] = i;
+            }
+            json source(jsoncons::json_array_arg);
+            for (auto id : ids)
+            {
+                json item(jsoncons::json_object_arg);
+                item["id"] = id;
+                source.push_back(std::move(item));
+            }
+            std::mt19937 gen(7);
+            std::shuffle(ids.begin(), ids.end(), gen);
+            json target(jsoncons::json_array_arg);
+            for (auto id : ids)
+            {
+                json item(jsoncons::json_object_arg);
+                item["id"] = id;
+                target.push_back(std::move(item));
+            }
+
+            jsoncons::jsonpatch::diff_options options;
+            options.identity_key("id");
+            runner.run("jsonpatch from_diff by key", keyed, source.to_string().size(), n, [&]() -> std::size_t
+            {
+                json patch = jsoncons::jsonpatch::from_diff(source, target, options);
+                return patch.size();
+            });
+        }
+    }
+
+} // namespace jsoncons_benchmarks
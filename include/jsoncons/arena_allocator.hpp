@@ -0,0 +1,198 @@
+// Copyright 2022 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_ARENA_ALLOCATOR_HPP
+#define JSONCONS_ARENA_ALLOCATOR_HPP
+
+#include <cstddef> // std::size_t, std::max_align_t
+#include <cstdint> // uintptr_t
+#include <new> // ::operator new, std::bad_alloc
+#include <memory> // std::addressof
+#include <limits> // std::numeric_limits
+#include <algorithm> // std::max
+#include <jsoncons/config/jsoncons_config.hpp>
+
+namespace jsoncons {
+
+    // arena is a monotonic (bump pointer) memory resource. It hands out memory from a
+    // list of chunks, starting with initial_chunk_size bytes and doubling the size of
+    // each new chunk up to max_chunk_size. Individual deallocations are ignored,
+    // all memory is returned at once by release() or the destructor.
+
+    class arena
+    {
+        struct chunk
+        {
+            chunk* next;
+            std::size_t size;
+        };
+
+        static constexpr std::size_t header_size = (sizeof(chunk) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+        chunk* head_;
+        char* current_;
+        char* end_;
+        std::size_t next_chunk_size_;
+        std::size_t chunk_count_;
+        std::size_t bytes_allocated_;
+    public:
+        static constexpr std::size_t default_initial_chunk_size = 4096;
+        static constexpr std::size_t max_chunk_size = 16*1024*1024;
+
+        explicit arena(std::size_t initial_chunk_size = default_initial_chunk_size) noexcept
+            : head_(nullptr), current_(nullptr), end_(nullptr),
+              next_chunk_size_(initial_chunk_size == 0 ? default_initial_chunk_size : initial_chunk_size),
+              chunk_count_(0), bytes_allocated_(0)
+        {
+        }
+
+        arena(const arena&) = delete;
+        arena& operator=(const arena&) = delete;
+
+        ~arena() noexcept
+        {
+            release();
+        }
+
+        void* allocate(std::size_t size, std::size_t alignment)
+        {
+            alignment = (std::max)(alignment, alignof(std::max_align_t));
+            char* p = align_up(current_, alignment);
+            if (current_ == nullptr || p > end_ || size > static_cast<std::size_t>(end_ - p))
+            {
+                add_chunk(size, alignment);
+                p = align_up(current_, alignment);
+            }
+            current_ = p + size;
+            bytes_allocated_ += size;
+            return p;
+        }
+
+        // Frees every chunk, invalidating all memory handed out by this arena
+        void release() noexcept
+        {
+            while (head_ != nullptr)
+            {
+                chunk* next = head_->next;
+                ::operator delete(head_);
+                head_ = next;
+            }
+            current_ = nullptr;
+            end_ = nullptr;
+            chunk_count_ = 0;
+            bytes_allocated_ = 0;
+        }
+
+        std::size_t chunk_count() const noexcept
+        {
+            return chunk_count_;
+        }
+
+        std::size_t bytes_allocated() const noexcept
+        {
+            return bytes_allocated_;
+        }
+
+    private:
+        static char* align_up(char* p, std::size_t alignment) noexcept
+        {
+            uintptr_t n = reinterpret_cast<uintptr_t>(p);
+            return p + (((n + alignment - 1) & ~(uintptr_t)(alignment - 1)) - n);
+        }
+
+        void add_chunk(std::size_t size, std::size_t alignment)
+        {
+            if (size > (std::numeric_limits<std::size_t>::max)() - header_size - alignment)
+            {
+                JSONCONS_THROW(std::bad_alloc());
+            }
+            std::size_t chunk_size = (std::max)(next_chunk_size_, header_size + size + alignment);
+
+            chunk* c = static_cast<chunk*>(::operator new(chunk_size));
+            c->next = head_;
+            c->size = chunk_size;
+            head_ = c;
+            current_ = reinterpret_cast<char*>(c) + header_size;
+            end_ = reinterpret_cast<char*>(c) + chunk_size;
+            ++chunk_count_;
+
+            if (next_chunk_size_ < max_chunk_size)
+            {
+                next_chunk_size_ *= 2;
+                if (next_chunk_size_ > max_chunk_size)
+                {
+                    next_chunk_size_ = max_chunk_size;
+                }
+            }
+        }
+    };
+
+    // arena_allocator allocates from an arena, deallocate is a no-op. A default
+    // constructed arena_allocator has no arena, it exists so that values that
+    // don't allocate can report an allocator, and allocating from it fails.
+
+    template <class T>
+    class arena_allocator
+    {
+        template <class U> friend class arena_allocator;
+
+        arena* arena_;
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        arena_allocator() noexcept
+            : arena_(nullptr)
+        {
+        }
+
+        arena_allocator(arena& a) noexcept
+            : arena_(std::addressof(a))
+        {
+        }
+
+        template <class U>
+        arena_allocator(const arena_allocator<U>& other) noexcept
+            : arena_(other.arena_)
+        {
+        }
+
+        T* allocate(size_type n)
+        {
+            JSONCONS_ASSERT(arena_ != nullptr);
+            if (n > (std::numeric_limits<size_type>::max)() / sizeof(T))
+            {
+                JSONCONS_THROW(std::bad_alloc());
+            }
+            return static_cast<T*>(arena_->allocate(n*sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T*, size_type) noexcept
+        {
+        }
+
+        arena* get_arena() const noexcept
+        {
+            return arena_;
+        }
+
+        template <class U>
+        friend bool operator==(const arena_allocator& lhs, const arena_allocator<U>& rhs) noexcept
+        {
+            return lhs.arena_ == rhs.get_arena();
+        }
+
+        template <class U>
+        friend bool operator!=(const arena_allocator& lhs, const arena_allocator<U>& rhs) noexcept
+        {
+            return lhs.arena_ != rhs.get_arena();
+        }
+    };
+
+} // namespace jsoncons
+
+#endif
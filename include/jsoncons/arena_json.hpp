@@ -0,0 +1,185 @@
+// Copyright 2022 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_ARENA_JSON_HPP
+#define JSONCONS_ARENA_JSON_HPP
+
+#include <memory> // std::unique_ptr
+#include <istream> // std::basic_istream
+#include <functional> // std::function
+#include <utility> // std::move
+#include <jsoncons/json.hpp>
+#include <jsoncons/arena_allocator.hpp>
+
+namespace jsoncons {
+
+    using arena_json = basic_json<char,sorted_policy,arena_allocator<char>>;
+    using arena_ojson = basic_json<char,order_preserving_policy,arena_allocator<char>>;
+    using arena_wjson = basic_json<wchar_t,sorted_policy,arena_allocator<char>>;
+    using arena_wojson = basic_json<wchar_t,order_preserving_policy,arena_allocator<char>>;
+
+    // arena_document owns an arena and a root value allocated from it. Parsing
+    // places every array, object, member name and long string of the document in
+    // the arena's chunks, and the destructor releases the chunks without visiting
+    // the nodes. Values added to the root must use get_allocator(), a default
+    // constructed arena_allocator cannot allocate.
+
+    template <class Json>
+    class arena_document
+    {
+    public:
+        using value_type = Json;
+        using char_type = typename Json::char_type;
+        using allocator_type = typename Json::allocator_type;
+    private:
+        std::unique_ptr<arena> arena_;
+        Json* root_;
+    public:
+        explicit arena_document(std::size_t initial_chunk_size = arena::default_initial_chunk_size)
+            : arena_(new arena(initial_chunk_size)), root_(nullptr)
+        {
+            root_ = ::new(arena_->allocate(sizeof(Json), alignof(Json))) Json(json_object_arg, semantic_tag::none, get_allocator());
+        }
+
+        arena_document(const arena_document&) = delete;
+
+        arena_document(arena_document&& other) noexcept
+            : arena_(std::move(other.arena_)), root_(other.root_)
+        {
+            other.root_ = nullptr;
+        }
+
+        arena_document& operator=(const arena_document&) = delete;
+
+        arena_document& operator=(arena_document&& other) noexcept
+        {
+            if (this != &other)
+            {
+                arena_ = std::move(other.arena_);
+                root_ = other.root_;
+                other.root_ = nullptr;
+            }
+            return *this;
+        }
+
+        Json& root()
+        {
+            JSONCONS_ASSERT(root_ != nullptr);
+            return *root_;
+        }
+
+        const Json& root() const
+        {
+            JSONCONS_ASSERT(root_ != nullptr);
+            return *root_;
+        }
+
+        allocator_type get_allocator() const
+        {
+            JSONCONS_ASSERT(arena_ != nullptr);
+            return allocator_type(*arena_);
+        }
+
+        const arena& get_arena() const
+        {
+            JSONCONS_ASSERT(arena_ != nullptr);
+            return *arena_;
+        }
+
+        template <class Source>
+        static
+        typename std::enable_if<traits_extension::is_sequence_of<Source,char_type>::value,arena_document>::type
+        parse(const Source& s,
+              const basic_json_decode_options<char_type>& options = basic_json_decode_options<char_type>(),
+              std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing())
+        {
+            arena_document doc(initial_chunk_size_for(s.size()));
+            json_decoder<Json> decoder(result_allocator_arg, doc.get_allocator());
+            basic_json_reader<char_type,string_source<char_type>> reader(s, decoder, options, err_handler);
+            reader.read_next();
+            reader.check_done();
+            if (!decoder.is_valid())
+            {
+                JSONCONS_THROW(ser_error(json_errc::source_error, "Failed to parse json string"));
+            }
+            doc.root() = decoder.get_result();
+            return doc;
+        }
+
+        // String values without escapes refer into s instead of being copied,
+        // escaped strings and member names are copied into the arena. s must
+        // outlive the document
+        template <class Source>
+        static
+        typename std::enable_if<traits_extension::is_sequence_of<Source,char_type>::value,arena_document>::type
+        parse(borrowed_string_arg_t,
+              const Source& s,
+              const basic_json_decode_options<char_type>& options = basic_json_decode_options<char_type>(),
+              std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing())
+        {
+            arena_document doc;
+            json_decoder<Json> decoder(result_allocator_arg, doc.get_allocator());
+            decoder.borrow_strings(jsoncons::basic_string_view<char_type>(s.data(), s.size()));
+            basic_json_parser<char_type> parser(options,err_handler);
+
+            auto r = unicode_traits::detect_encoding_from_bom(s.data(), s.size());
+            if (!(r.encoding == unicode_traits::encoding_kind::utf8 || r.encoding == unicode_traits::encoding_kind::undetected))
+            {
+                JSONCONS_THROW(ser_error(json_errc::illegal_unicode_character,parser.line(),parser.column()));
+            }
+            std::size_t offset = (r.ptr - s.data());
+            parser.update(s.data()+offset,s.size()-offset);
+            parser.parse_some(decoder);
+            parser.finish_parse(decoder);
+            parser.check_done();
+            if (!decoder.is_valid())
+            {
+                JSONCONS_THROW(ser_error(json_errc::source_error, "Failed to parse json string"));
+            }
+            doc.root() = decoder.get_result();
+            return doc;
+        }
+
+        static arena_document parse(const char_type* s,
+                                    const basic_json_decode_options<char_type>& options = basic_json_decode_options<char_type>(),
+                                    std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing())
+        {
+            return parse(jsoncons::basic_string_view<char_type>(s), options, err_handler);
+        }
+
+        static arena_document parse(std::basic_istream<char_type>& is,
+                                    const basic_json_decode_options<char_type>& options = basic_json_decode_options<char_type>(),
+                                    std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing())
+        {
+            arena_document doc;
+            json_decoder<Json> decoder(result_allocator_arg, doc.get_allocator());
+            basic_json_reader<char_type,stream_source<char_type>> reader(is, decoder, options, err_handler);
+            reader.read_next();
+            reader.check_done();
+            if (!decoder.is_valid())
+            {
+                JSONCONS_THROW(ser_error(json_errc::source_error, "Failed to parse json stream"));
+            }
+            doc.root() = decoder.get_result();
+            return doc;
+        }
+    private:
+        // Parsed documents take up about as much memory as their text, start
+        // with a chunk that size so most documents fit in a few chunks
+        static std::size_t initial_chunk_size_for(std::size_t length)
+        {
+            std::size_t size = length*sizeof(char_type);
+            if (size < arena::default_initial_chunk_size)
+            {
+                return arena::default_initial_chunk_size;
+            }
+            return size < arena::max_chunk_size ? size : arena::max_chunk_size;
+        }
+    };
+
+} // namespace jsoncons
+
+#endif
@@ -708,6 +708,37 @@ namespace jsoncons {
             }
         };
 
+        // borrowed_string_storage
+        class borrowed_string_storage final
+        {
+        public:
+            uint8_t storage_kind_:4;
+            uint8_t length_:4;
+            semantic_tag tag_;
+        private:
+            uint32_t size_;
+            const char_type* data_;
+        public:
+            static constexpr std::size_t max_length = (std::numeric_limits<uint32_t>::max)();
+
+            borrowed_string_storage(semantic_tag tag, const char_type* data, std::size_t length)
+                : storage_kind_(static_cast<uint8_t>(json_storage_kind::borrowed_string_value)), length_(0), tag_(tag),
+                  size_(static_cast<uint32_t>(length)), data_(data)
+            {
+                JSONCONS_ASSERT(length <= max_length);
+            }
+
+            const char_type* data() const
+            {
+                return data_;
+            }
+
+            std::size_t length() const
+            {
+                return size_;
+            }
+        };
+
         // byte_string_storage
         class byte_string_storage final
         {
@@ -1985,6 +2016,7 @@ namespace jsoncons {
             object_storage object_stor_;
             empty_object_storage empty_object_stor_;
             json_const_pointer_storage json_const_pointer_stor_;
+            borrowed_string_storage borrowed_string_stor_;
         };
 
         void Destroy_()
@@ -2165,6 +2197,16 @@ namespace jsoncons {
             return json_const_pointer_stor_;
         }
 
+        borrowed_string_storage& cast(identity<borrowed_string_storage>) 
+        {
+            return borrowed_string_stor_;
+        }
+
+        const borrowed_string_storage& cast(identity<borrowed_string_storage>) const
+        {
+            return borrowed_string_stor_;
+        }
+
         template <class TypeA, class TypeB>
         void swap_a_b(basic_json& other)
         {
@@ -2193,6 +2235,7 @@ namespace jsoncons {
                 case json_storage_kind::array_value        : swap_a_b<TypeA, array_storage>(other); break;
                 case json_storage_kind::object_value       : swap_a_b<TypeA, object_storage>(other); break;
                 case json_storage_kind::json_const_pointer : swap_a_b<TypeA, json_const_pointer_storage>(other); break;
+                case json_storage_kind::borrowed_string_value : swap_a_b<TypeA, borrowed_string_storage>(other); break;
                 default:
                     JSONCONS_UNREACHABLE();
                     break;
@@ -2242,6 +2285,9 @@ namespace jsoncons {
                 case json_storage_kind::json_const_pointer:
                     construct<json_const_pointer_storage>(val.cast<json_const_pointer_storage>());
                     break;
+                case json_storage_kind::borrowed_string_value:
+                    construct<borrowed_string_storage>(val.cast<borrowed_string_storage>());
+                    break;
                 default:
                     break;
             }
@@ -2260,6 +2306,7 @@ namespace jsoncons {
                 case json_storage_kind::double_value:
                 case json_storage_kind::short_string_value:
                 case json_storage_kind::json_const_pointer:
+                case json_storage_kind::borrowed_string_value:
                     Init_(val);
                     break;
                 case json_storage_kind::long_string_value:
@@ -2292,6 +2339,7 @@ namespace jsoncons {
                 case json_storage_kind::bool_value:
                 case json_storage_kind::short_string_value:
                 case json_storage_kind::json_const_pointer:
+                case json_storage_kind::borrowed_string_value:
                     Init_(val);
                     break;
                 case json_storage_kind::long_string_value:
@@ -2327,6 +2375,7 @@ namespace jsoncons {
                 case json_storage_kind::bool_value:
                 case json_storage_kind::short_string_value:
                 case json_storage_kind::json_const_pointer:
+                case json_storage_kind::borrowed_string_value:
                     Init_(std::forward<basic_json>(val));
                     break;
                 case json_storage_kind::long_string_value:
@@ -2455,6 +2504,7 @@ namespace jsoncons {
                     return json_type::double_value;
                 case json_storage_kind::short_string_value:
                 case json_storage_kind::long_string_value:
+                case json_storage_kind::borrowed_string_value:
                     return json_type::string_value;
                 case json_storage_kind::byte_string_value:
                     return json_type::byte_string_value;
@@ -2511,6 +2561,8 @@ namespace jsoncons {
                     return string_view_type(cast<short_string_storage>().data(),cast<short_string_storage>().length());
                 case json_storage_kind::long_string_value:
                     return string_view_type(cast<long_string_storage>().data(),cast<long_string_storage>().length());
+                case json_storage_kind::borrowed_string_value:
+                    return string_view_type(cast<borrowed_string_storage>().data(),cast<borrowed_string_storage>().length());
                 case json_storage_kind::json_const_pointer:
                     return cast<json_const_pointer_storage>().value()->as_string_view();
                 default:
@@ -2528,6 +2580,7 @@ namespace jsoncons {
             {
                 case json_storage_kind::short_string_value:
                 case json_storage_kind::long_string_value:
+                case json_storage_kind::borrowed_string_value:
                 {
                     value_converter<jsoncons::string_view, byte_string_type> converter;
                     byte_string_type v = converter.convert(as_string_view(),tag(), ec);
@@ -2681,11 +2734,12 @@ namespace jsoncons {
                     break;
                 case json_storage_kind::short_string_value:
                 case json_storage_kind::long_string_value:
+                case json_storage_kind::borrowed_string_value:
                     switch (rhs.storage_kind())
                     {
                         case json_storage_kind::short_string_value:
-                            return as_string_view().compare(rhs.as_string_view());
                         case json_storage_kind::long_string_value:
+                        case json_storage_kind::borrowed_string_value:
                             return as_string_view().compare(rhs.as_string_view());
                         case json_storage_kind::json_const_pointer:
                             return compare(*(rhs.cast<json_const_pointer_storage>().value()));
@@ -2768,6 +2822,7 @@ namespace jsoncons {
                 case json_storage_kind::array_value: swap_a<array_storage>(other); break;
                 case json_storage_kind::object_value: swap_a<object_storage>(other); break;
                 case json_storage_kind::json_const_pointer: swap_a<json_const_pointer_storage>(other); break;
+                case json_storage_kind::borrowed_string_value: swap_a<borrowed_string_storage>(other); break;
                 default:
                     JSONCONS_UNREACHABLE();
                     break;
@@ -2811,6 +2866,37 @@ namespace jsoncons {
             return parse(s, basic_json_decode_options<CharT>(), err_handler);
         }
 
+        // String values without escapes refer into s instead of being copied,
+        // s must outlive the result
+        template <class Source>
+        static
+        typename std::enable_if<traits_extension::is_sequence_of<Source,char_type>::value,basic_json>::type
+        parse(borrowed_string_arg_t,
+              const Source& s, 
+              const basic_json_decode_options<char_type>& options = basic_json_decode_options<CharT>(), 
+              std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing())
+        {
+            json_decoder<basic_json> decoder;
+            decoder.borrow_strings(string_view_type(s.data(), s.size()));
+            basic_json_parser<char_type> parser(options,err_handler);
+
+            auto r = unicode_traits::detect_encoding_from_bom(s.data(), s.size());
+            if (!(r.encoding == unicode_traits::encoding_kind::utf8 || r.encoding == unicode_traits::encoding_kind::undetected))
+            {
+                JSONCONS_THROW(ser_error(json_errc::illegal_unicode_character,parser.line(),parser.column()));
+            }
+            std::size_t offset = (r.ptr - s.data());
+            parser.update(s.data()+offset,s.size()-offset);
+            parser.parse_some(decoder);
+            parser.finish_parse(decoder);
+            parser.check_done();
+            if (!decoder.is_valid())
+            {
+                JSONCONS_THROW(ser_error(json_errc::source_error, "Failed to parse json string"));
+            }
+            return decoder.get_result();
+        }
+
         static basic_json parse(const char_type* s, 
                                 const basic_json_decode_options<char_type>& options = basic_json_decode_options<char_type>(), 
                                 std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing())
@@ -3192,6 +3278,27 @@ namespace jsoncons {
         {
         }
 
+        // Refers to the characters of sv rather than copying them, the caller
+        // must keep them alive for as long as this value (or a copy of it) is in use.
+        // Short strings are stored inline as usual.
+        basic_json(borrowed_string_arg_t, const string_view_type& sv, 
+                   semantic_tag tag = semantic_tag::none, 
+                   const Allocator& alloc = Allocator())
+        {
+            if (sv.length() <= short_string_storage::max_length)
+            {
+                construct<short_string_storage>(tag, sv.data(), static_cast<uint8_t>(sv.length()));
+            }
+            else if (sv.length() <= borrowed_string_storage::max_length)
+            {
+                construct<borrowed_string_storage>(tag, sv.data(), sv.length());
+            }
+            else
+            {
+                construct<long_string_storage>(tag, sv.data(), sv.length(), alloc);
+            }
+        }
+
         template <class Source>
         basic_json(byte_string_arg_t, const Source& source, 
                    semantic_tag tag = semantic_tag::none,
@@ -3629,6 +3736,7 @@ namespace jsoncons {
             {
                 case json_storage_kind::short_string_value:
                 case json_storage_kind::long_string_value:
+                case json_storage_kind::borrowed_string_value:
                     return true;
                 case json_storage_kind::json_const_pointer:
                     return cast<json_const_pointer_storage>().value()->is_string();
@@ -3666,6 +3774,7 @@ namespace jsoncons {
             {
                 case json_storage_kind::short_string_value:
                 case json_storage_kind::long_string_value:
+                case json_storage_kind::borrowed_string_value:
                     return jsoncons::detail::is_base10(as_string_view().data(), as_string_view().length());
                 case json_storage_kind::int64_value:
                 case json_storage_kind::uint64_value:
@@ -3784,6 +3893,7 @@ namespace jsoncons {
                     return true;
                 case json_storage_kind::short_string_value:
                 case json_storage_kind::long_string_value:
+                case json_storage_kind::borrowed_string_value:
                     return tag() == semantic_tag::bigint ||
                            tag() == semantic_tag::bigdec ||
                            tag() == semantic_tag::bigfloat;
@@ -3805,6 +3915,8 @@ namespace jsoncons {
                     return cast<short_string_storage>().length() == 0;
                 case json_storage_kind::long_string_value:
                     return cast<long_string_storage>().length() == 0;
+                case json_storage_kind::borrowed_string_value:
+                    return cast<borrowed_string_storage>().length() == 0;
                 case json_storage_kind::array_value:
                     return array_value().empty();
                 case json_storage_kind::empty_object_value:
@@ -3919,6 +4031,7 @@ namespace jsoncons {
             {
                 case json_storage_kind::short_string_value:
                 case json_storage_kind::long_string_value:
+                case json_storage_kind::borrowed_string_value:
                 {
                     switch (tag())
                     {
@@ -3981,6 +4094,7 @@ namespace jsoncons {
             {
                 case json_storage_kind::short_string_value:
                 case json_storage_kind::long_string_value:
+                case json_storage_kind::borrowed_string_value:
                 {
                     IntegerType val;
                     auto result = jsoncons::detail::to_integer(as_string_view().data(), as_string_view().length(), val);
@@ -4032,6 +4146,7 @@ namespace jsoncons {
             {
                 case json_storage_kind::short_string_value:
                 case json_storage_kind::long_string_value:
+                case json_storage_kind::borrowed_string_value:
                 {
                     IntegerType val;
                     auto result = jsoncons::detail::to_integer(as_string_view().data(), as_string_view().length(), val);
@@ -4073,6 +4188,7 @@ namespace jsoncons {
             {
                 case json_storage_kind::short_string_value:
                 case json_storage_kind::long_string_value:
+                case json_storage_kind::borrowed_string_value:
                 {
                     IntegerType val;
                     auto result = jsoncons::detail::to_integer(as_string_view().data(), as_string_view().length(), val);
@@ -4095,10 +4211,11 @@ namespace jsoncons {
             {
                 case json_storage_kind::short_string_value:
                 case json_storage_kind::long_string_value:
+                case json_storage_kind::borrowed_string_value:
                 {
                     jsoncons::detail::chars_to to_double;
                     // to_double() throws std::invalid_argument if conversion fails
-                    return to_double(as_cstring(), as_string_view().length());
+                    return to_double(as_string_view().data(), as_string_view().length());
                 }
                 case json_storage_kind::half_value:
                     return binary::decode_half(cast<half_storage>().value());
@@ -4131,6 +4248,7 @@ namespace jsoncons {
             {
                 case json_storage_kind::short_string_value:
                 case json_storage_kind::long_string_value:
+                case json_storage_kind::borrowed_string_value:
                 {
                     return string_type(as_string_view().data(),as_string_view().length(),alloc);
                 }
@@ -5504,6 +5622,7 @@ namespace jsoncons {
             {
                 case json_storage_kind::short_string_value:
                 case json_storage_kind::long_string_value:
+                case json_storage_kind::borrowed_string_value:
                     visitor.string_value(as_string_view(), tag(), context, ec);
                     break;
                 case json_storage_kind::byte_string_value:
@@ -22,6 +22,7 @@
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/conv_error.hpp>
 #include <jsoncons/traits_extension.hpp>
+#include <jsoncons/detail/simd_base64.hpp>
 
 namespace jsoncons {
 
@@ -145,11 +146,155 @@ namespace detail {
         return decode_result<InputIt>{last, conv_errc::success};
     }
 
-} // namespace detail
+    // Codecs for contiguous input encode and decode by blocks into a fixed size
+    // buffer, and append the buffer to the result container or sink.
+
+    template <class Container>
+    typename std::enable_if<traits_extension::has_reserve<Container>::value>::type
+    reserve_for_append(Container& result, std::size_t length)
+    {
+        result.reserve(result.size() + length);
+    }
+
+    template <class Container>
+    typename std::enable_if<!traits_extension::has_reserve<Container>::value>::type
+    reserve_for_append(Container&, std::size_t)
+    {
+    }
+
+    template <class T, class Container>
+    typename std::enable_if<traits_extension::has_append<Container,T>::value>::type
+    append_buffer(const T* data, std::size_t length, Container& result)
+    {
+        result.append(data, length);
+    }
+
+    template <class T, class Container>
+    typename std::enable_if<!traits_extension::has_append<Container,T>::value &&
+                            traits_extension::is_range_insertable<Container,const T*>::value>::type
+    append_buffer(const T* data, std::size_t length, Container& result)
+    {
+        result.insert(result.end(), data, data + length);
+    }
+
+    template <class T, class Container>
+    typename std::enable_if<!traits_extension::has_append<Container,T>::value &&
+                            !traits_extension::is_range_insertable<Container,const T*>::value>::type
+    append_buffer(const T* data, std::size_t length, Container& result)
+    {
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            result.push_back(data[i]);
+        }
+    }
 
     template <class InputIt, class Container>
-    typename std::enable_if<std::is_same<typename std::iterator_traits<InputIt>::value_type,uint8_t>::value,size_t>::type
-    encode_base16(InputIt first, InputIt last, Container& result)
+    std::size_t encode_base64_impl(InputIt first, InputIt last, const char alphabet[65], Container& result, std::false_type)
+    {
+        return encode_base64_generic(first, last, alphabet, result);
+    }
+
+    template <class Container>
+    std::size_t encode_base64_impl(const uint8_t* first, const uint8_t* last, const char alphabet[65], Container& result, std::true_type)
+    {
+        const std::size_t buffer_size = 1024;
+        char buffer[buffer_size];
+
+        std::size_t length = static_cast<std::size_t>(last - first);
+        reserve_for_append(result, (length + 2) / 3 * 4);
+
+        std::size_t count = 0;
+        while (length >= 3)
+        {
+            std::size_t n = encode_base64_blocks(first, (std::min)(length, buffer_size / 4 * 3), alphabet, buffer);
+            append_buffer(buffer, n / 3 * 4, result);
+            count += n / 3 * 4;
+            first += n;
+            length -= n;
+        }
+        return count + encode_base64_generic(first, last, alphabet, result);
+    }
+
+    template <class InputIt, class F, class Container>
+    decode_result<InputIt> decode_base64_impl(InputIt first, InputIt last,
+                                              const uint8_t reverse_alphabet[256], char, char,
+                                              F f, Container& result, std::false_type)
+    {
+        return decode_base64_generic(first, last, reverse_alphabet, f, result);
+    }
+
+    template <class InputIt, class F, class Container>
+    decode_result<InputIt> decode_base64_impl(InputIt first, InputIt last,
+                                              const uint8_t reverse_alphabet[256], char c62, char c63,
+                                              F f, Container& result, std::true_type)
+    {
+        const std::size_t buffer_size = 768;
+        uint8_t buffer[buffer_size];
+
+        reserve_for_append(result, static_cast<std::size_t>(last - first) / 4 * 3);
+
+        while (last - first >= 4)
+        {
+            std::size_t chunk = (std::min)(static_cast<std::size_t>(last - first), buffer_size / 3 * 4);
+            std::size_t n = decode_base64_blocks(first, chunk, reverse_alphabet, c62, c63, buffer);
+            append_buffer(buffer, n / 4 * 3, result);
+            first += n;
+            if (n < chunk / 4 * 4)
+            {
+                break; // padding or a character not in the alphabet
+            }
+        }
+        return decode_base64_generic(first, last, reverse_alphabet, f, result);
+    }
+
+    template <class InputIt>
+    struct is_contiguous_byte_input
+        : std::integral_constant<bool, std::is_pointer<InputIt>::value &&
+                                       sizeof(typename std::iterator_traits<InputIt>::value_type) == 1>
+    {
+    };
+
+    template <class InputIt, class Container>
+    bool decode_base16_generic(InputIt it, InputIt last, Container& result)
+    {
+        while (it != last)
+        {
+            uint8_t val;
+            auto a = *it++;
+            if (a >= '0' && a <= '9')
+            {
+                val = (a - '0') << 4;
+            }
+            else if ((a | 0x20) >= 'a' && (a | 0x20) <= 'f')
+            {
+                val = ((a | 0x20) - 'a' + 10) << 4;
+            }
+            else
+            {
+                return false;
+            }
+
+            auto b = *it++;
+            if (b >= '0' && b <= '9')
+            {
+                val |= (b - '0');
+            }
+            else if ((b | 0x20) >= 'a' && (b | 0x20) <= 'f')
+            {
+                val |= ((b | 0x20) - 'a' + 10);
+            }
+            else
+            {
+                return false;
+            }
+
+            result.push_back(val);
+        }
+        return true;
+    }
+
+    template <class InputIt, class Container>
+    std::size_t encode_base16_impl(InputIt first, InputIt last, Container& result, std::false_type)
     {
         static constexpr char characters[] = "0123456789ABCDEF";
 
@@ -162,6 +307,60 @@ namespace detail {
         return (last-first)*2;
     }
 
+    template <class Container>
+    std::size_t encode_base16_impl(const uint8_t* first, const uint8_t* last, Container& result, std::true_type)
+    {
+        const std::size_t buffer_size = 1024;
+        char buffer[buffer_size];
+
+        std::size_t length = static_cast<std::size_t>(last - first);
+        reserve_for_append(result, length*2);
+        for (std::size_t i = 0; i < length; i += buffer_size / 2)
+        {
+            std::size_t n = (std::min)(length - i, buffer_size / 2);
+            encode_base16_blocks(first + i, n, buffer);
+            append_buffer(buffer, n*2, result);
+        }
+        return length*2;
+    }
+
+    template <class InputIt, class Container>
+    bool decode_base16_impl(InputIt first, InputIt last, Container& result, std::false_type)
+    {
+        return decode_base16_generic(first, last, result);
+    }
+
+    template <class InputIt, class Container>
+    bool decode_base16_impl(InputIt first, InputIt last, Container& result, std::true_type)
+    {
+        const std::size_t buffer_size = 512;
+        uint8_t buffer[buffer_size];
+
+        reserve_for_append(result, static_cast<std::size_t>(last - first) / 2);
+
+        while (last - first >= 2)
+        {
+            std::size_t chunk = (std::min)(static_cast<std::size_t>(last - first), buffer_size * 2);
+            std::size_t n = decode_base16_blocks(first, chunk, buffer);
+            append_buffer(buffer, n / 2, result);
+            first += n;
+            if (n < chunk)
+            {
+                break; // the rest is decoded a pair at a time
+            }
+        }
+        return decode_base16_generic(first, last, result);
+    }
+
+} // namespace detail
+
+    template <class InputIt, class Container>
+    typename std::enable_if<std::is_same<typename std::iterator_traits<InputIt>::value_type,uint8_t>::value,size_t>::type
+    encode_base16(InputIt first, InputIt last, Container& result)
+    {
+        return detail::encode_base16_impl(first, last, result, std::is_pointer<InputIt>());
+    }
+
     template <class InputIt, class Container>
     typename std::enable_if<std::is_same<typename std::iterator_traits<InputIt>::value_type,uint8_t>::value,size_t>::type
     encode_base64url(InputIt first, InputIt last, Container& result)
@@ -170,7 +369,7 @@ namespace detail {
                                                       "abcdefghijklmnopqrstuvwxyz"
                                                       "0123456789-_"
                                                       "\0";
-        return detail::encode_base64_generic(first, last, alphabet, result);
+        return detail::encode_base64_impl(first, last, alphabet, result, std::is_pointer<InputIt>());
     }
 
     template <class InputIt, class Container>
@@ -181,7 +380,7 @@ namespace detail {
                                                    "abcdefghijklmnopqrstuvwxyz"
                                                    "0123456789+/"
                                                    "=";
-        return detail::encode_base64_generic(first, last, alphabet, result);
+        return detail::encode_base64_impl(first, last, alphabet, result, std::is_pointer<InputIt>());
     }
 
     template <class Char>
@@ -226,9 +425,9 @@ namespace detail {
             0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
             0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
         };
-        auto retval = jsoncons::detail::decode_base64_generic(first, last, reverse_alphabet, 
-                                                              is_base64url<typename std::iterator_traits<InputIt>::value_type>, 
-                                                              result);
+        auto retval = jsoncons::detail::decode_base64_impl(first, last, reverse_alphabet, '-', '_',
+                                                           is_base64url<typename std::iterator_traits<InputIt>::value_type>,
+                                                           result, jsoncons::detail::is_contiguous_byte_input<InputIt>());
         return retval.ec == conv_errc::success ? retval : decode_result<InputIt>{retval.it, conv_errc::not_base64url};
     }
 
@@ -254,9 +453,9 @@ namespace detail {
             0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
             0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
         };
-        auto retval = jsoncons::detail::decode_base64_generic(first, last, reverse_alphabet, 
-                                                             is_base64<typename std::iterator_traits<InputIt>::value_type>, 
-                                                             result);
+        auto retval = jsoncons::detail::decode_base64_impl(first, last, reverse_alphabet, '+', '/',
+                                                           is_base64<typename std::iterator_traits<InputIt>::value_type>,
+                                                           result, jsoncons::detail::is_contiguous_byte_input<InputIt>());
         return retval.ec == conv_errc::success ? retval : decode_result<InputIt>{retval.it, conv_errc::not_base64};
     }
 
@@ -270,39 +469,9 @@ namespace detail {
             return decode_result<InputIt>{first, conv_errc::not_base16};
         }
 
-        InputIt it = first;
-        while (it != last)
+        if (!jsoncons::detail::decode_base16_impl(first, last, result, jsoncons::detail::is_contiguous_byte_input<InputIt>()))
         {
-            uint8_t val;
-            auto a = *it++;
-            if (a >= '0' && a <= '9') 
-            {
-                val = (a - '0') << 4;
-            } 
-            else if ((a | 0x20) >= 'a' && (a | 0x20) <= 'f') 
-            {
-                val = ((a | 0x20) - 'a' + 10) << 4;
-            } 
-            else 
-            {
-                return decode_result<InputIt>{first, conv_errc::not_base16};
-            }
-
-            auto b = *it++;
-            if (b >= '0' && b <= '9') 
-            {
-                val |= (b - '0');
-            } 
-            else if ((b | 0x20) >= 'a' && (b | 0x20) <= 'f') 
-            {
-                val |= ((b | 0x20) - 'a' + 10);
-            } 
-            else 
-            {
-                return decode_result<InputIt>{first, conv_errc::not_base16};
-            }
-
-            result.push_back(val);
+            return decode_result<InputIt>{first, conv_errc::not_base16};
         }
         return decode_result<InputIt>{last, conv_errc::success};
     }
@@ -575,13 +744,12 @@ namespace detail {
 
         void assign(const uint8_t* s, std::size_t count)
         {
-            data_.clear();
-            data_.insert(s, s+count);
+            data_.assign(s, s+count);
         }
 
         void append(const uint8_t* s, std::size_t count)
         {
-            data_.insert(s, s+count);
+            data_.insert(data_.end(), s, s+count);
         }
 
         void clear()
@@ -336,6 +336,28 @@ namespace jsoncons {
     #define JSONCONS_COPY(first,last,d_first) std::copy(first, last, d_first)
 #endif
 
+// SIMD instruction sets, selected at compile time. Define JSONCONS_NO_SIMD
+// to force the scalar code paths.
+#if !defined(JSONCONS_NO_SIMD)
+#  if defined(__AVX2__)
+#    define JSONCONS_HAS_AVX2 1
+#  endif
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define JSONCONS_HAS_SSE2 1
+#  endif
+#  if (defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)) && (defined(__aarch64__) || defined(_M_ARM64))
+#    define JSONCONS_HAS_NEON 1
+#  endif
+#endif
+
+// Builds without AVX2 enabled can still use it for the scanners in
+// detail/simd_scan.hpp, where GCC and Clang can compile functions for
+// another target and select them at run time.
+#if !defined(JSONCONS_NO_SIMD) && !defined(JSONCONS_HAS_AVX2) && defined(JSONCONS_HAS_SSE2) && \
+    (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#  define JSONCONS_HAS_AVX2_DISPATCH 1
+#endif
+
 #if defined(_MSC_VER) && _MSC_VER <= 1900 
 #define JSONCONS_CONSTEXPR
 #else
@@ -10,6 +10,7 @@
 #include <string>
 #include <tuple>
 #include <array>
+#include <cstring> // std::memcpy
 #include <memory>
 #include <type_traits> // std::enable_if, std::true_type, std::false_type
 #include <jsoncons/json_visitor.hpp>
@@ -286,15 +287,130 @@ namespace jsoncons {
             return true;
         }
 
-        bool visit_typed_array(const jsoncons::span<const value_type>& data,  
+        bool visit_typed_array(const jsoncons::span<const uint8_t>& data,
                             semantic_tag,
                             const ser_context&,
                             std::error_code&) override
         {
-            v_ = std::vector<value_type>(data.begin(),data.end());
+            return assign_span(data);
+        }
+
+        bool visit_typed_array(const jsoncons::span<const uint16_t>& data,
+                            semantic_tag,
+                            const ser_context&,
+                            std::error_code&) override
+        {
+            return assign_span(data);
+        }
+
+        bool visit_typed_array(const jsoncons::span<const uint32_t>& data,
+                            semantic_tag,
+                            const ser_context&,
+                            std::error_code&) override
+        {
+            return assign_span(data);
+        }
+
+        bool visit_typed_array(const jsoncons::span<const uint64_t>& data,
+                            semantic_tag,
+                            const ser_context&,
+                            std::error_code&) override
+        {
+            return assign_span(data);
+        }
+
+        bool visit_typed_array(const jsoncons::span<const int8_t>& data,
+                            semantic_tag,
+                            const ser_context&,
+                            std::error_code&) override
+        {
+            return assign_span(data);
+        }
+
+        bool visit_typed_array(const jsoncons::span<const int16_t>& data,
+                            semantic_tag,
+                            const ser_context&,
+                            std::error_code&) override
+        {
+            return assign_span(data);
+        }
+
+        bool visit_typed_array(const jsoncons::span<const int32_t>& data,
+                            semantic_tag,
+                            const ser_context&,
+                            std::error_code&) override
+        {
+            return assign_span(data);
+        }
+
+        bool visit_typed_array(const jsoncons::span<const int64_t>& data,
+                            semantic_tag,
+                            const ser_context&,
+                            std::error_code&) override
+        {
+            return assign_span(data);
+        }
+
+        bool visit_typed_array(const jsoncons::span<const float>& data,
+                            semantic_tag,
+                            const ser_context&,
+                            std::error_code&) override
+        {
+            return assign_span(data);
+        }
+
+        bool visit_typed_array(const jsoncons::span<const double>& data,
+                            semantic_tag,
+                            const ser_context&,
+                            std::error_code&) override
+        {
+            return assign_span(data);
+        }
+
+        bool visit_typed_array(half_arg_t,
+                            const jsoncons::span<const uint16_t>& data,
+                            semantic_tag,
+                            const ser_context&,
+                            std::error_code&) override
+        {
+            v_.clear();
+            reserve_storage(typename std::integral_constant<bool, traits_extension::has_reserve<T>::value>::type(), v_, data.size());
+            for (auto value : data)
+            {
+                visit_half_(typename std::integral_constant<bool, std::is_integral<value_type>::value>::type(), value);
+            }
             return false;
         }
 
+        // A typed array stands for the whole array, its elements are copied in one go
+        template <class U>
+        bool assign_span(const jsoncons::span<const U>& data)
+        {
+            assign_span(typename std::integral_constant<bool, std::is_same<U,value_type>::value && traits_extension::has_data<T>::value>::type(), data);
+            return false;
+        }
+
+        template <class U>
+        void assign_span(std::true_type, const jsoncons::span<const U>& data)
+        {
+            v_.resize(data.size());
+            if (!data.empty())
+            {
+                std::memcpy(&v_[0], data.data(), data.size()*sizeof(value_type));
+            }
+        }
+
+        template <class U>
+        void assign_span(std::false_type, const jsoncons::span<const U>& data)
+        {
+            v_.clear();
+            reserve_storage(typename std::integral_constant<bool, traits_extension::has_reserve<T>::value>::type(), v_, data.size());
+            for (auto value : data)
+            {
+                v_.push_back(static_cast<value_type>(value));
+            }
+        }
+
         static
         void reserve_storage(std::true_type, T& v, std::size_t new_cap)
         {
@@ -343,7 +459,6 @@ namespace jsoncons {
                         {
                             v.push_back(static_cast<value_type>(ch));
                         }
-                        cursor.next(ec);
                         return v;
                     }
                     else
@@ -0,0 +1,283 @@
+// Copyright 2022 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_OBJECT_HASH_INDEX_HPP
+#define JSONCONS_DETAIL_OBJECT_HASH_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits> // std::numeric_limits
+#include <memory> // std::allocator_traits
+#include <vector>
+#include <type_traits> // std::make_unsigned
+#include <utility> // std::move, std::swap
+#include <jsoncons/config/jsoncons_config.hpp>
+
+namespace jsoncons {
+namespace detail {
+
+    // An open addressing hash table with linear probing that maps member names
+    // to their positions in an object's member container. Each slot keeps the
+    // hash of its name next to the position, so positions can be shifted after
+    // an insert or erase in the middle of the container, and the table can grow,
+    // without hashing the names again. The table holds at most half as many
+    // entries as slots.
+
+    template <class Allocator>
+    class object_hash_index
+    {
+        struct slot
+        {
+            uint32_t hash;
+            uint32_t position;
+        };
+
+        using slot_allocator_type = typename std::allocator_traits<Allocator>:: template rebind_alloc<slot>;
+
+        static constexpr uint32_t empty_position = (std::numeric_limits<uint32_t>::max)();
+        static constexpr std::size_t min_capacity = 64;
+
+        std::vector<slot,slot_allocator_type> slots_;
+        std::size_t size_;
+    public:
+        static constexpr std::size_t npos = (std::numeric_limits<std::size_t>::max)();
+
+        // Objects with at least this many members are indexed
+        static constexpr std::size_t threshold = 32;
+
+        static constexpr std::size_t max_size = empty_position - 1;
+
+        object_hash_index()
+            : size_(0)
+        {
+        }
+
+        explicit object_hash_index(const Allocator& alloc)
+            : slots_(slot_allocator_type(alloc)), size_(0)
+        {
+        }
+
+        object_hash_index(const object_hash_index& other, const Allocator& alloc)
+            : slots_(other.slots_, slot_allocator_type(alloc)), size_(other.size_)
+        {
+        }
+
+        object_hash_index(object_hash_index&& other, const Allocator& alloc)
+            : slots_(std::move(other.slots_), slot_allocator_type(alloc)), size_(other.size_)
+        {
+            other.size_ = 0;
+        }
+
+        object_hash_index(const object_hash_index&) = default;
+
+        object_hash_index(object_hash_index&& other) noexcept
+            : slots_(std::move(other.slots_)), size_(other.size_)
+        {
+            other.size_ = 0;
+        }
+
+        object_hash_index& operator=(const object_hash_index&) = default;
+
+        object_hash_index& operator=(object_hash_index&& other) noexcept
+        {
+            slots_.swap(other.slots_);
+            std::swap(size_, other.size_);
+            return *this;
+        }
+
+        bool active() const noexcept
+        {
+            return !slots_.empty();
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        void swap(object_hash_index& other) noexcept
+        {
+            slots_.swap(other.slots_);
+            std::swap(size_, other.size_);
+        }
+
+        // Deactivates the index and frees its slots
+        void clear() noexcept
+        {
+            slots_.clear();
+            slots_.shrink_to_fit();
+            size_ = 0;
+        }
+
+        template <class CharT>
+        static uint32_t hash(const CharT* s, std::size_t length) noexcept
+        {
+            using unsigned_type = typename std::make_unsigned<CharT>::type;
+
+            // FNV-1a over code units, followed by a finalizer to spread the
+            // high bits into the low bits used for the slot
+            uint32_t h = 2166136261u;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                h ^= static_cast<uint32_t>(static_cast<unsigned_type>(s[i]));
+                h *= 16777619u;
+            }
+            h ^= h >> 16;
+            h *= 0x85ebca6bu;
+            h ^= h >> 13;
+            return h;
+        }
+
+        template <class StringView>
+        static uint32_t hash(const StringView& name) noexcept
+        {
+            return hash(name.data(), name.size());
+        }
+
+        // Indexes the members at positions [0, members.size())
+        template <class Members>
+        void build(const Members& members)
+        {
+            JSONCONS_ASSERT(members.size() <= max_size);
+
+            std::size_t capacity = min_capacity;
+            while (capacity < 2*members.size())
+            {
+                capacity *= 2;
+            }
+            slots_.assign(capacity, slot{0, empty_position});
+            size_ = 0;
+            for (std::size_t i = 0; i < members.size(); ++i)
+            {
+                place(hash(members[i].key()), i);
+                ++size_;
+            }
+        }
+
+        // Returns the position of the member named name, or npos
+        template <class Members, class StringView>
+        std::size_t find(const Members& members, const StringView& name, uint32_t h) const noexcept
+        {
+            const std::size_t mask = slots_.size() - 1;
+            for (std::size_t i = h & mask; slots_[i].position != empty_position; i = (i + 1) & mask)
+            {
+                if (slots_[i].hash == h && members[slots_[i].position].key() == name)
+                {
+                    return slots_[i].position;
+                }
+            }
+            return npos;
+        }
+
+        template <class Members, class StringView>
+        std::size_t find(const Members& members, const StringView& name) const noexcept
+        {
+            return find(members, name, hash(name));
+        }
+
+        // Adds an entry for a name that is not in the index
+        void insert(uint32_t h, std::size_t position)
+        {
+            JSONCONS_ASSERT(size_ < max_size);
+
+            if (2*(size_ + 1) > slots_.size())
+            {
+                grow();
+            }
+            place(h, position);
+            ++size_;
+        }
+
+        // Removes the entry for the member at position, h is the hash of its name
+        void erase(uint32_t h, std::size_t position) noexcept
+        {
+            const std::size_t mask = slots_.size() - 1;
+            std::size_t i = h & mask;
+            while (slots_[i].position != position)
+            {
+                if (slots_[i].position == empty_position)
+                {
+                    return;
+                }
+                i = (i + 1) & mask;
+            }
+
+            // Backward shift deletion, move later entries of the probe
+            // sequence into the hole so that no tombstones are needed
+            std::size_t j = i;
+            while (true)
+            {
+                j = (j + 1) & mask;
+                if (slots_[j].position == empty_position)
+                {
+                    break;
+                }
+                std::size_t home = slots_[j].hash & mask;
+                if (((j - home) & mask) >= ((j - i) & mask))
+                {
+                    slots_[i] = slots_[j];
+                    i = j;
+                }
+            }
+            slots_[i].position = empty_position;
+            --size_;
+        }
+
+        // Adds delta to every position at or after first
+        void shift(std::size_t first, std::ptrdiff_t delta) noexcept
+        {
+            for (auto& s : slots_)
+            {
+                if (s.position != empty_position && s.position >= first)
+                {
+                    s.position = static_cast<uint32_t>(static_cast<std::ptrdiff_t>(s.position) + delta);
+                }
+            }
+        }
+
+    private:
+        void place(uint32_t h, std::size_t position) noexcept
+        {
+            const std::size_t mask = slots_.size() - 1;
+            std::size_t i = h & mask;
+            while (slots_[i].position != empty_position)
+            {
+                i = (i + 1) & mask;
+            }
+            slots_[i].hash = h;
+            slots_[i].position = static_cast<uint32_t>(position);
+        }
+
+        void grow()
+        {
+            std::vector<slot,slot_allocator_type> old(slots_.get_allocator());
+            old.swap(slots_);
+            slots_.assign(old.empty() ? min_capacity : 2*old.size(), slot{0, empty_position});
+            for (const auto& s : old)
+            {
+                if (s.position != empty_position)
+                {
+                    place(s.hash, s.position);
+                }
+            }
+        }
+    };
+
+    template <class Allocator>
+    constexpr uint32_t object_hash_index<Allocator>::empty_position;
+    template <class Allocator>
+    constexpr std::size_t object_hash_index<Allocator>::min_capacity;
+    template <class Allocator>
+    constexpr std::size_t object_hash_index<Allocator>::npos;
+    template <class Allocator>
+    constexpr std::size_t object_hash_index<Allocator>::threshold;
+    template <class Allocator>
+    constexpr std::size_t object_hash_index<Allocator>::max_size;
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif
@@ -0,0 +1,100 @@
+// Copyright 2022 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_OBJECT_POOL_HPP
+#define JSONCONS_DETAIL_OBJECT_POOL_HPP
+
+#include <cstddef>
+#include <memory> // std::unique_ptr
+#include <new> // placement new
+#include <type_traits> // std::aligned_storage
+#include <utility> // std::move, std::forward
+#include <vector>
+
+namespace jsoncons {
+namespace detail {
+
+    // Owns objects of type T, constructed in blocks of storage. Objects keep
+    // their addresses until clear(), which destroys them but keeps the storage,
+    // so that a warmed up pool creates objects without allocating.
+
+    template <class T>
+    class object_pool
+    {
+        using storage_type = typename std::aligned_storage<sizeof(T),alignof(T)>::type;
+        static constexpr std::size_t block_size = 32;
+
+        std::vector<std::unique_ptr<storage_type[]>> blocks_;
+        std::size_t size_;
+    public:
+        object_pool()
+            : size_(0)
+        {
+        }
+
+        object_pool(const object_pool&) = delete;
+
+        object_pool(object_pool&& other) noexcept
+            : blocks_(std::move(other.blocks_)), size_(other.size_)
+        {
+            other.size_ = 0;
+        }
+
+        ~object_pool() noexcept
+        {
+            clear();
+        }
+
+        object_pool& operator=(const object_pool&) = delete;
+
+        object_pool& operator=(object_pool&& other) noexcept
+        {
+            clear();
+            blocks_ = std::move(other.blocks_);
+            size_ = other.size_;
+            other.size_ = 0;
+            return *this;
+        }
+
+        // The number of objects constructed since the last clear()
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        // The number of blocks of storage allocated
+        std::size_t block_count() const noexcept
+        {
+            return blocks_.size();
+        }
+
+        template <typename... Args>
+        T* create(Args&& ... args)
+        {
+            const std::size_t block = size_ / block_size;
+            if (block == blocks_.size())
+            {
+                blocks_.emplace_back(new storage_type[block_size]);
+            }
+            T* ptr = ::new(&blocks_[block][size_ % block_size]) T(std::forward<Args>(args)...);
+            ++size_;
+            return ptr;
+        }
+
+        void clear() noexcept
+        {
+            while (size_ > 0)
+            {
+                --size_;
+                reinterpret_cast<T*>(&blocks_[size_ / block_size][size_ % block_size])->~T();
+            }
+        }
+    };
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif
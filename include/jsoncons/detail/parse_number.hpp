@@ -16,8 +16,10 @@
 #include <limits> // std::numeric_limits
 #include <type_traits> // std::enable_if
 #include <exception>
+#include <memory> // std::unique_ptr
 #include <jsoncons/config/jsoncons_config.hpp>
 #include <jsoncons/json_exception.hpp>
+#include <jsoncons/detail/eisel_lemire.hpp>
 #include <cctype>
 
 namespace jsoncons { namespace detail {
@@ -912,15 +914,10 @@ base16_to_integer(const CharT* s, std::size_t length, T& n)
 
 #if defined(JSONCONS_HAS_STD_FROM_CHARS) && JSONCONS_HAS_STD_FROM_CHARS
 
-class chars_to
+class fallback_chars_to
 {
 public:
 
-    char get_decimal_point() const
-    {
-        return '.';
-    }
-
     template <class CharT>
     typename std::enable_if<std::is_same<CharT,char>::value,double>::type
     operator()(const CharT* s, std::size_t len) const
@@ -955,43 +952,41 @@ public:
 };
 #elif defined(JSONCONS_HAS_MSC_STRTOD_L)
 
-class chars_to
+class fallback_chars_to
 {
 private:
     _locale_t locale_;
+    mutable std::string buffer_;
 public:
-    chars_to()
+    fallback_chars_to()
     {
         locale_ = _create_locale(LC_NUMERIC, "C");
     }
-    ~chars_to() noexcept
+    ~fallback_chars_to() noexcept
     {
         _free_locale(locale_);
     }
 
-    chars_to(const chars_to&)
+    fallback_chars_to(const fallback_chars_to&)
     {
         locale_ = _create_locale(LC_NUMERIC, "C");
     }
 
-    chars_to& operator=(const chars_to&) 
+    fallback_chars_to& operator=(const fallback_chars_to&) 
     {
         // Don't assign locale
         return *this;
     }
 
-    char get_decimal_point() const
-    {
-        return '.';
-    }
-
+    // The input need not be null terminated
     template <class CharT>
     typename std::enable_if<std::is_same<CharT,char>::value,double>::type
-    operator()(const CharT* s, std::size_t) const
+    operator()(const CharT* s, std::size_t length) const
     {
+        buffer_.assign(s, length);
         CharT *end = nullptr;
-        double val = _strtod_l(s, &end, locale_);
-        if (s == end)
+        double val = _strtod_l(buffer_.c_str(), &end, locale_);
+        if (buffer_.c_str() == end)
         {
             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("Convert string to double failed"));
         }
@@ -1000,11 +995,12 @@ public:
 
     template <class CharT>
     typename std::enable_if<std::is_same<CharT,wchar_t>::value,double>::type
-    operator()(const CharT* s, std::size_t) const
+    operator()(const CharT* s, std::size_t length) const
     {
+        std::wstring input(s, length);
         CharT *end = nullptr;
-        double val = _wcstod_l(s, &end, locale_);
-        if (s == end)
+        double val = _wcstod_l(input.c_str(), &end, locale_);
+        if (input.c_str() == end)
         {
             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("Convert string to double failed"));
         }
@@ -1014,42 +1010,40 @@ public:
 
 #elif defined(JSONCONS_HAS_STRTOLD_L)
 
-class chars_to
+class fallback_chars_to
 {
 private:
     locale_t locale_;
+    mutable std::string buffer_;
 public:
-    chars_to()
+    fallback_chars_to()
     {
         locale_ = newlocale(LC_ALL_MASK, "C", (locale_t) 0);
     }
-    ~chars_to() noexcept
+    ~fallback_chars_to() noexcept
     {
         freelocale(locale_);
     }
 
-    chars_to(const chars_to&)
+    fallback_chars_to(const fallback_chars_to&)
     {
         locale_ = newlocale(LC_ALL_MASK, "C", (locale_t) 0);
     }
 
-    chars_to& operator=(const chars_to&) 
+    fallback_chars_to& operator=(const fallback_chars_to&) 
     {
         return *this;
     }
 
-    char get_decimal_point() const
-    {
-        return '.';
-    }
-
+    // The input need not be null terminated
     template <class CharT>
     typename std::enable_if<std::is_same<CharT,char>::value,double>::type
-    operator()(const CharT* s, std::size_t) const
+    operator()(const CharT* s, std::size_t length) const
     {
+        buffer_.assign(s, length);
         char *end = nullptr;
-        double val = strtold_l(s, &end, locale_);
-        if (s == end)
+        double val = strtold_l(buffer_.c_str(), &end, locale_);
+        if (buffer_.c_str() == end)
         {
             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("Convert string to double failed"));
         }
@@ -1058,11 +1052,12 @@ public:
 
     template <class CharT>
     typename std::enable_if<std::is_same<CharT,wchar_t>::value,double>::type
-    operator()(const CharT* s, std::size_t) const
+    operator()(const CharT* s, std::size_t length) const
     {
+        std::wstring input(s, length);
         CharT *end = nullptr;
-        double val = wcstold_l(s, &end, locale_);
-        if (s == end)
+        double val = wcstold_l(input.c_str(), &end, locale_);
+        if (input.c_str() == end)
         {
             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("Convert string to double failed"));
         }
@@ -1071,13 +1066,13 @@ public:
 };
 
 #else
-class chars_to
+class fallback_chars_to
 {
 private:
-    std::vector<char> buffer_;
+    mutable std::vector<char> buffer_;
     char decimal_point_;
 public:
-    chars_to()
+    fallback_chars_to()
         : buffer_()
     {
         struct lconv * lc = localeconv();
@@ -1092,21 +1087,24 @@ public:
         buffer_.reserve(100);
     }
 
-    chars_to(const chars_to&) = default;
-    chars_to& operator=(const chars_to&) = default;
-
-    char get_decimal_point() const
-    {
-        return decimal_point_;
-    }
+    fallback_chars_to(const fallback_chars_to&) = default;
+    fallback_chars_to& operator=(const fallback_chars_to&) = default;
 
     template <class CharT>
     typename std::enable_if<std::is_same<CharT,char>::value,double>::type
-    operator()(const CharT* s, std::size_t /*length*/) const
+    operator()(const CharT* s, std::size_t length) const
     {
-        CharT *end = nullptr;
-        double val = strtod(s, &end);
-        if (s == end)
+        // strtod expects the decimal point of the current locale
+        buffer_.clear();
+        for (std::size_t i = 0; i < length && s[i] != 0; ++i)
+        {
+            buffer_.push_back(s[i] == '.' ? decimal_point_ : s[i]);
+        }
+        buffer_.push_back(0);
+
+        char *end = nullptr;
+        double val = strtod(buffer_.data(), &end);
+        if (buffer_.data() == end)
         {
             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("Convert string to double failed"));
         }
@@ -1115,11 +1113,19 @@ public:
 
     template <class CharT>
     typename std::enable_if<std::is_same<CharT,wchar_t>::value,double>::type
-    operator()(const CharT* s, std::size_t /*length*/) const
+    operator()(const CharT* s, std::size_t length) const
     {
-        CharT *end = nullptr;
-        double val = wcstod(s, &end);
-        if (s == end)
+        std::vector<wchar_t> input;
+        input.reserve(length + 1);
+        for (std::size_t i = 0; i < length && s[i] != 0; ++i)
+        {
+            input.push_back(s[i] == L'.' ? static_cast<wchar_t>(decimal_point_) : s[i]);
+        }
+        input.push_back(0);
+
+        wchar_t *end = nullptr;
+        double val = wcstod(input.data(), &end);
+        if (input.data() == end)
         {
             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("Convert string to double failed"));
         }
@@ -1128,6 +1134,52 @@ public:
 };
 #endif
 
+// Converts decimal numbers with at most 19 significant digits with the
+// Eisel-Lemire algorithm, independent of the current locale, and everything
+// else (longer mantissas, hexadecimal floats, inf and nan) with the platform
+// conversion above. The platform conversion is constructed the first time
+// it is needed and kept for later calls, copies don't share it. The decimal
+// point is always '.'.
+class chars_to
+{
+    mutable std::unique_ptr<fallback_chars_to> fallback_;
+public:
+    chars_to() = default;
+
+    chars_to(const chars_to&)
+    {
+    }
+
+    chars_to(chars_to&&) = default;
+
+    chars_to& operator=(const chars_to&)
+    {
+        return *this;
+    }
+
+    chars_to& operator=(chars_to&&) = default;
+
+    char get_decimal_point() const
+    {
+        return '.';
+    }
+
+    template <class CharT>
+    double operator()(const CharT* s, std::size_t length) const
+    {
+        double val;
+        if (jsoncons::detail::decimal_to_double(s, length, val))
+        {
+            return val;
+        }
+        if (!fallback_)
+        {
+            fallback_.reset(new fallback_chars_to());
+        }
+        return (*fallback_)(s, length);
+    }
+};
+
 }}
 
 #endif
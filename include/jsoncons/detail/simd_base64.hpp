@@ -0,0 +1,260 @@
+// Copyright 2022 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_SIMD_BASE64_HPP
+#define JSONCONS_DETAIL_SIMD_BASE64_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/detail/simd_scan.hpp>
+
+namespace jsoncons {
+namespace detail {
+
+#if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+
+    // encode_base64_avx2 encodes 24 byte blocks while at least 28 bytes remain,
+    // and returns the number of bytes encoded
+
+    JSONCONS_TARGET_AVX2 inline
+    std::size_t encode_base64_avx2(const uint8_t* data, std::size_t length, const char* alphabet, char* out) noexcept
+    {
+        std::size_t i = 0;
+        // Mula's method: spread 24 bytes over 32 lanes so that each 32 bit lane
+        // holds one 3 byte group, then isolate the 6 bit indices with multiplies
+        const __m256i spread = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                                                1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+        const __m256i shift_lut = _mm256_setr_epi8(
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, static_cast<char>(alphabet[62] - 62), static_cast<char>(alphabet[63] - 63), 'A', 0, 0,
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, static_cast<char>(alphabet[62] - 62), static_cast<char>(alphabet[63] - 63), 'A', 0, 0);
+        // Each block reads 28 bytes and encodes 24 of them
+        for (; length - i >= 28; i += 24, out += 32)
+        {
+            __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i))),
+                                                 _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 12)), 1);
+            in = _mm256_shuffle_epi8(in, spread);
+            const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+            const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+            const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+            const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+            const __m256i indices = _mm256_or_si256(t1, t3);
+
+            // 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12
+            __m256i reduced = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+            const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+            reduced = _mm256_or_si256(reduced, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+            const __m256i chars = _mm256_add_epi8(_mm256_shuffle_epi8(shift_lut, reduced), indices);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), chars);
+        }
+        return i;
+    }
+
+#endif
+
+    // encode_base64_blocks encodes the whole 3 byte groups of [data,data+length)
+    // to out with the 64 character alphabet, and returns the number of bytes encoded.
+    // out must have room for length/3*4 characters.
+
+    inline
+    std::size_t encode_base64_blocks(const uint8_t* data, std::size_t length, const char* alphabet, char* out) noexcept
+    {
+        std::size_t i = 0;
+    #if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+        if (length >= 28 && cpu_has_avx2())
+        {
+            i = encode_base64_avx2(data, length, alphabet, out);
+            out += i / 3 * 4;
+        }
+    #endif
+        for (; length - i >= 3; i += 3, out += 4)
+        {
+            const uint32_t group = (uint32_t(data[i]) << 16) | (uint32_t(data[i+1]) << 8) | uint32_t(data[i+2]);
+            out[0] = alphabet[(group >> 18) & 0x3f];
+            out[1] = alphabet[(group >> 12) & 0x3f];
+            out[2] = alphabet[(group >> 6) & 0x3f];
+            out[3] = alphabet[group & 0x3f];
+        }
+        return i;
+    }
+
+#if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+
+    // decode_base64_avx2 decodes 32 character blocks until fewer than 32 characters
+    // remain or a block holds a character that is not in the alphabet, and returns
+    // the number of characters decoded
+
+    JSONCONS_TARGET_AVX2 inline
+    std::size_t decode_base64_avx2(const char* data, std::size_t length, char c62, char c63, uint8_t* out) noexcept
+    {
+        std::size_t i = 0;
+        const __m256i upper_lo = _mm256_set1_epi8('A' - 1);
+        const __m256i upper_hi = _mm256_set1_epi8('Z' + 1);
+        const __m256i lower_lo = _mm256_set1_epi8('a' - 1);
+        const __m256i lower_hi = _mm256_set1_epi8('z' + 1);
+        const __m256i digit_lo = _mm256_set1_epi8('0' - 1);
+        const __m256i digit_hi = _mm256_set1_epi8('9' + 1);
+        const __m256i char62 = _mm256_set1_epi8(c62);
+        const __m256i char63 = _mm256_set1_epi8(c63);
+        const __m256i compact = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                                 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+        for (; length - i >= 32; i += 32, out += 24)
+        {
+            const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            // Bytes from 0x80 are negative and fall outside every range
+            const __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(in, upper_lo), _mm256_cmpgt_epi8(upper_hi, in));
+            const __m256i lower = _mm256_and_si256(_mm256_cmpgt_epi8(in, lower_lo), _mm256_cmpgt_epi8(lower_hi, in));
+            const __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(in, digit_lo), _mm256_cmpgt_epi8(digit_hi, in));
+            const __m256i is62 = _mm256_cmpeq_epi8(in, char62);
+            const __m256i is63 = _mm256_cmpeq_epi8(in, char63);
+            const __m256i valid = _mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(digit, _mm256_or_si256(is62, is63)));
+            if (_mm256_movemask_epi8(valid) != -1)
+            {
+                break;
+            }
+            const __m256i offset = _mm256_or_si256(
+                _mm256_or_si256(_mm256_and_si256(upper, _mm256_set1_epi8(-'A')),
+                                _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a'))),
+                _mm256_or_si256(_mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')),
+                                _mm256_or_si256(_mm256_and_si256(is62, _mm256_set1_epi8(static_cast<char>(62 - c62))),
+                                                _mm256_and_si256(is63, _mm256_set1_epi8(static_cast<char>(63 - c63))))));
+            const __m256i values = _mm256_add_epi8(in, offset);
+
+            // Merge pairs of 6 bit values into 12 bits, then pairs of those into 24 bits
+            const __m256i merged = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+            const __m256i packed = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+            // 12 big endian bytes at the start of each lane, then the two lanes together
+            const __m256i bytes = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(packed, compact),
+                                                              _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(bytes));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out + 16), _mm256_extracti128_si256(bytes, 1));
+        }
+        return i;
+    }
+
+#endif
+
+    // decode_base64_blocks decodes the whole 4 character groups of [data,data+length)
+    // to out, stopping before the first group that contains a character that is not
+    // in the alphabet (including padding.) Returns the number of characters decoded.
+    // reverse_alphabet maps characters to 6 bit values, or 0xff if not in the alphabet,
+    // and c62 and c63 are the characters for 62 and 63. out must have room for
+    // length/4*3 bytes.
+
+    template <class CharT>
+    std::size_t decode_base64_blocks(const CharT* data, std::size_t length,
+                                     const uint8_t* reverse_alphabet, char c62, char c63,
+                                     uint8_t* out) noexcept
+    {
+        static_assert(sizeof(CharT) == 1, "decode_base64_blocks requires single byte characters");
+        (void)c62;
+        (void)c63;
+
+        std::size_t i = 0;
+    #if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+        if (length >= 32 && cpu_has_avx2())
+        {
+            i = decode_base64_avx2(reinterpret_cast<const char*>(data), length, c62, c63, out);
+            out += i / 4 * 3;
+        }
+    #endif
+        for (; length - i >= 4; i += 4, out += 3)
+        {
+            const uint8_t a = reverse_alphabet[static_cast<uint8_t>(data[i])];
+            const uint8_t b = reverse_alphabet[static_cast<uint8_t>(data[i+1])];
+            const uint8_t c = reverse_alphabet[static_cast<uint8_t>(data[i+2])];
+            const uint8_t d = reverse_alphabet[static_cast<uint8_t>(data[i+3])];
+            if ((a | b | c | d) == 0xff)
+            {
+                break;
+            }
+            const uint32_t group = (uint32_t(a) << 18) | (uint32_t(b) << 12) | (uint32_t(c) << 6) | uint32_t(d);
+            out[0] = static_cast<uint8_t>(group >> 16);
+            out[1] = static_cast<uint8_t>(group >> 8);
+            out[2] = static_cast<uint8_t>(group);
+        }
+        return i;
+    }
+
+    // encode_base16_blocks encodes [data,data+length) to 2*length upper case
+    // hexadecimal digits
+
+    inline
+    void encode_base16_blocks(const uint8_t* data, std::size_t length, char* out) noexcept
+    {
+        static constexpr char characters[] = "0123456789ABCDEF";
+
+        std::size_t i = 0;
+    #if defined(JSONCONS_HAS_SSE2)
+        const __m128i low_nibble = _mm_set1_epi8(0x0f);
+        const __m128i nine = _mm_set1_epi8(9);
+        const __m128i zero_char = _mm_set1_epi8('0');
+        const __m128i letter_gap = _mm_set1_epi8('A' - '9' - 1);
+        for (; length - i >= 16; i += 16, out += 32)
+        {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            __m128i hi = _mm_and_si128(_mm_srli_epi16(in, 4), low_nibble);
+            __m128i lo = _mm_and_si128(in, low_nibble);
+            hi = _mm_add_epi8(_mm_add_epi8(hi, zero_char), _mm_and_si128(_mm_cmpgt_epi8(hi, nine), letter_gap));
+            lo = _mm_add_epi8(_mm_add_epi8(lo, zero_char), _mm_and_si128(_mm_cmpgt_epi8(lo, nine), letter_gap));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8(hi, lo));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16), _mm_unpackhi_epi8(hi, lo));
+        }
+    #endif
+        for (; i < length; ++i, out += 2)
+        {
+            out[0] = characters[data[i] >> 4];
+            out[1] = characters[data[i] & 0xf];
+        }
+    }
+
+    // decode_base16_blocks decodes pairs of hexadecimal digits from [data,data+length)
+    // to out, stopping before the first block that contains a character that is not
+    // a hexadecimal digit. length must be even. Returns the number of characters decoded.
+
+    template <class CharT>
+    std::size_t decode_base16_blocks(const CharT* data, std::size_t length, uint8_t* out) noexcept
+    {
+        static_assert(sizeof(CharT) == 1, "decode_base16_blocks requires single byte characters");
+
+        std::size_t i = 0;
+    #if defined(JSONCONS_HAS_SSE2)
+        const __m128i digit_lo = _mm_set1_epi8('0' - 1);
+        const __m128i digit_hi = _mm_set1_epi8('9' + 1);
+        const __m128i lower_case = _mm_set1_epi8(0x20);
+        const __m128i alpha_lo = _mm_set1_epi8('a' - 1);
+        const __m128i alpha_hi = _mm_set1_epi8('f' + 1);
+        const __m128i low_byte = _mm_set1_epi16(0x00ff);
+        for (; length - i >= 16; i += 16, out += 8)
+        {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            const __m128i folded = _mm_or_si128(in, lower_case);
+            const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(in, digit_lo), _mm_cmpgt_epi8(digit_hi, in));
+            const __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(folded, alpha_lo), _mm_cmpgt_epi8(alpha_hi, folded));
+            if (_mm_movemask_epi8(_mm_or_si128(digit, alpha)) != 0xffff)
+            {
+                break;
+            }
+            const __m128i values = _mm_or_si128(_mm_and_si128(digit, _mm_sub_epi8(in, _mm_set1_epi8('0'))),
+                                                _mm_and_si128(alpha, _mm_sub_epi8(folded, _mm_set1_epi8('a' - 10))));
+            // Each 16 bit lane holds the high nibble in its low byte
+            const __m128i pairs = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values, low_byte), 4), _mm_srli_epi16(values, 8));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(pairs, pairs));
+        }
+    #else
+        (void)data;
+        (void)length;
+        (void)out;
+    #endif
+        return i;
+    }
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif
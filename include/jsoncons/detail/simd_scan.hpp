@@ -0,0 +1,382 @@
+// Copyright 2022 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_SIMD_SCAN_HPP
+#define JSONCONS_DETAIL_SIMD_SCAN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits> // std::make_unsigned
+#include <jsoncons/config/compiler_support.hpp>
+
+#if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_SSE2)
+#include <immintrin.h>
+#endif
+#if defined(JSONCONS_HAS_NEON)
+#include <arm_neon.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace jsoncons {
+namespace detail {
+
+    // Index of the lowest set bit, mask must be non-zero
+    inline unsigned count_trailing_zeros(uint32_t mask) noexcept
+    {
+    #if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctz(mask));
+    #elif defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<unsigned>(index);
+    #else
+        unsigned n = 0;
+        while ((mask & 1u) == 0)
+        {
+            mask >>= 1;
+            ++n;
+        }
+        return n;
+    #endif
+    }
+
+    inline unsigned count_trailing_zeros(uint64_t mask) noexcept
+    {
+    #if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctzll(mask));
+    #elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+        unsigned long index;
+        _BitScanForward64(&index, mask);
+        return static_cast<unsigned>(index);
+    #else
+        uint32_t lo = static_cast<uint32_t>(mask);
+        return lo != 0 ? count_trailing_zeros(lo) : 32 + count_trailing_zeros(static_cast<uint32_t>(mask >> 32));
+    #endif
+    }
+
+#if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+
+    #if defined(JSONCONS_HAS_AVX2_DISPATCH)
+    #define JSONCONS_TARGET_AVX2 __attribute__((target("avx2")))
+    #else
+    #define JSONCONS_TARGET_AVX2
+    #endif
+
+    inline bool cpu_has_avx2() noexcept
+    {
+    #if defined(JSONCONS_HAS_AVX2)
+        return true;
+    #else
+        static const bool has_avx2 = (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+        return has_avx2;
+    #endif
+    }
+
+    // The AVX2 kernels scan 32 bytes at a time and stop at the block that holds
+    // the character searched for, or with fewer than 32 bytes left. The caller's
+    // 16 byte loop finishes the scan.
+
+    JSONCONS_TARGET_AVX2 inline
+    const char* find_string_special_avx2(const char* first, const char* last) noexcept
+    {
+        const __m256i quote32 = _mm256_set1_epi8('\"');
+        const __m256i backslash32 = _mm256_set1_epi8('\\');
+        const __m256i control32 = _mm256_set1_epi8(0x1f);
+        while (last - first >= 32)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            __m256i m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, quote32),
+                                                        _mm256_cmpeq_epi8(v, backslash32)),
+                                        _mm256_cmpeq_epi8(_mm256_max_epu8(v, control32), control32));
+            uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(m));
+            if (mask != 0)
+            {
+                return first + count_trailing_zeros(mask);
+            }
+            first += 32;
+        }
+        return first;
+    }
+
+    JSONCONS_TARGET_AVX2 inline
+    const char* find_bracket_special_avx2(const char* first, const char* last) noexcept
+    {
+        // '[' ']' '{' '}' differ only in bits 0x20 and 0x06, the masked compare
+        // also matches 'Y', '_', 'y' and DEL, which the caller passes over
+        const __m256i bracket_mask32 = _mm256_set1_epi8(static_cast<char>(0xd9));
+        const __m256i bracket32 = _mm256_set1_epi8(0x59);
+        const __m256i quote32 = _mm256_set1_epi8('\"');
+        const __m256i solidus32 = _mm256_set1_epi8('/');
+        const __m256i lf32 = _mm256_set1_epi8('\n');
+        const __m256i cr32 = _mm256_set1_epi8('\r');
+        while (last - first >= 32)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            __m256i m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(_mm256_and_si256(v, bracket_mask32), bracket32),
+                                                        _mm256_cmpeq_epi8(v, quote32)),
+                                        _mm256_or_si256(_mm256_cmpeq_epi8(v, solidus32),
+                                                        _mm256_or_si256(_mm256_cmpeq_epi8(v, lf32), _mm256_cmpeq_epi8(v, cr32))));
+            uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(m));
+            if (mask != 0)
+            {
+                return first + count_trailing_zeros(mask);
+            }
+            first += 32;
+        }
+        return first;
+    }
+
+    JSONCONS_TARGET_AVX2 inline
+    const char* skip_blanks_avx2(const char* first, const char* last) noexcept
+    {
+        const __m256i space32 = _mm256_set1_epi8(' ');
+        const __m256i tab32 = _mm256_set1_epi8('\t');
+        while (last - first >= 32)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            __m256i m = _mm256_or_si256(_mm256_cmpeq_epi8(v, space32), _mm256_cmpeq_epi8(v, tab32));
+            uint32_t mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(m));
+            if (mask != 0)
+            {
+                return first + count_trailing_zeros(mask);
+            }
+            first += 32;
+        }
+        return first;
+    }
+
+#endif // JSONCONS_HAS_AVX2 || JSONCONS_HAS_AVX2_DISPATCH
+
+    // Scalar predicates, shared by the vectorized tails
+
+    template <class CharT>
+    bool is_string_special(CharT c) noexcept
+    {
+        using uchar_type = typename std::make_unsigned<CharT>::type;
+        return c == '\"' || c == '\\' || static_cast<uchar_type>(c) < 0x20;
+    }
+
+    template <class CharT>
+    bool is_bracket_special(CharT c) noexcept
+    {
+        return c == '{' || c == '}' || c == '[' || c == ']' || c == '\"' || c == '/' || c == '\n' || c == '\r';
+    }
+
+    template <class CharT>
+    bool is_blank(CharT c) noexcept
+    {
+        return c == ' ' || c == '\t';
+    }
+
+    // find_string_special returns a pointer to the first character in [first,last)
+    // that terminates a run of unescaped string content: a quotation mark,
+    // a reverse solidus, or a control character (U+0000 through U+001F),
+    // or last if there is none.
+
+    template <class CharT>
+    const CharT* find_string_special(const CharT* first, const CharT* last) noexcept
+    {
+        while (first != last && !is_string_special(*first))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    inline
+    const char* find_string_special(const char* first, const char* last) noexcept
+    {
+    #if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+        if (last - first >= 32 && cpu_has_avx2())
+        {
+            first = find_string_special_avx2(first, last);
+        }
+    #endif
+    #if defined(JSONCONS_HAS_SSE2)
+        const __m128i quote = _mm_set1_epi8('\"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i control = _mm_set1_epi8(0x1f);
+        while (last - first >= 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote),
+                                                  _mm_cmpeq_epi8(v, backslash)),
+                                     _mm_cmpeq_epi8(_mm_max_epu8(v, control), control));
+            uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(m));
+            if (mask != 0)
+            {
+                return first + count_trailing_zeros(mask);
+            }
+            first += 16;
+        }
+    #elif defined(JSONCONS_HAS_NEON)
+        const uint8x16_t quote = vdupq_n_u8('\"');
+        const uint8x16_t backslash = vdupq_n_u8('\\');
+        const uint8x16_t control = vdupq_n_u8(0x20);
+        while (last - first >= 16)
+        {
+            uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(first));
+            uint8x16_t m = vorrq_u8(vorrq_u8(vceqq_u8(v, quote), vceqq_u8(v, backslash)), vcltq_u8(v, control));
+            // Narrow each byte of the comparison result to a nibble
+            uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+            if (mask != 0)
+            {
+                return first + (count_trailing_zeros(mask) >> 2);
+            }
+            first += 16;
+        }
+    #endif
+        while (first != last && !is_string_special(*first))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    // find_bracket_special returns a pointer to the first character in [first,last)
+    // that a bracket counting scan outside of strings must look at: a bracket or
+    // brace, a quotation mark, a solidus, or a line break, or last if there is none.
+
+    template <class CharT>
+    const CharT* find_bracket_special(const CharT* first, const CharT* last) noexcept
+    {
+        while (first != last && !is_bracket_special(*first))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    inline
+    const char* find_bracket_special(const char* first, const char* last) noexcept
+    {
+    #if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+        if (last - first >= 32 && cpu_has_avx2())
+        {
+            first = find_bracket_special_avx2(first, last);
+        }
+    #endif
+    #if defined(JSONCONS_HAS_SSE2)
+        const __m128i bracket_mask = _mm_set1_epi8(static_cast<char>(0xd9));
+        const __m128i bracket = _mm_set1_epi8(0x59);
+        const __m128i quote = _mm_set1_epi8('\"');
+        const __m128i solidus = _mm_set1_epi8('/');
+        const __m128i lf = _mm_set1_epi8('\n');
+        const __m128i cr = _mm_set1_epi8('\r');
+        while (last - first >= 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(_mm_and_si128(v, bracket_mask), bracket),
+                                                  _mm_cmpeq_epi8(v, quote)),
+                                     _mm_or_si128(_mm_cmpeq_epi8(v, solidus),
+                                                  _mm_or_si128(_mm_cmpeq_epi8(v, lf), _mm_cmpeq_epi8(v, cr))));
+            uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(m));
+            if (mask != 0)
+            {
+                return first + count_trailing_zeros(mask);
+            }
+            first += 16;
+        }
+    #elif defined(JSONCONS_HAS_NEON)
+        const uint8x16_t bracket_mask = vdupq_n_u8(0xd9);
+        const uint8x16_t bracket = vdupq_n_u8(0x59);
+        const uint8x16_t quote = vdupq_n_u8('\"');
+        const uint8x16_t solidus = vdupq_n_u8('/');
+        const uint8x16_t lf = vdupq_n_u8('\n');
+        const uint8x16_t cr = vdupq_n_u8('\r');
+        while (last - first >= 16)
+        {
+            uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(first));
+            uint8x16_t m = vorrq_u8(vorrq_u8(vceqq_u8(vandq_u8(v, bracket_mask), bracket), vceqq_u8(v, quote)),
+                                    vorrq_u8(vceqq_u8(v, solidus), vorrq_u8(vceqq_u8(v, lf), vceqq_u8(v, cr))));
+            uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+            if (mask != 0)
+            {
+                return first + (count_trailing_zeros(mask) >> 2);
+            }
+            first += 16;
+        }
+    #endif
+        while (first != last && !is_bracket_special(*first))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    // skip_blanks returns a pointer to the first character in [first,last)
+    // that is not a space or horizontal tab, or last if there is none.
+
+    template <class CharT>
+    const CharT* skip_blanks(const CharT* first, const CharT* last) noexcept
+    {
+        while (first != last && is_blank(*first))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    inline
+    const char* skip_blanks(const char* first, const char* last) noexcept
+    {
+        // Most whitespace runs are short, check a few characters before vectorizing
+        for (int i = 0; i < 4; ++i)
+        {
+            if (first == last || !is_blank(*first))
+            {
+                return first;
+            }
+            ++first;
+        }
+    #if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+        if (last - first >= 32 && cpu_has_avx2())
+        {
+            first = skip_blanks_avx2(first, last);
+        }
+    #endif
+    #if defined(JSONCONS_HAS_SSE2)
+        const __m128i space = _mm_set1_epi8(' ');
+        const __m128i tab = _mm_set1_epi8('\t');
+        while (last - first >= 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab));
+            uint32_t mask = ~static_cast<uint32_t>(_mm_movemask_epi8(m)) & 0xffffu;
+            if (mask != 0)
+            {
+                return first + count_trailing_zeros(mask);
+            }
+            first += 16;
+        }
+    #elif defined(JSONCONS_HAS_NEON)
+        const uint8x16_t space = vdupq_n_u8(' ');
+        const uint8x16_t tab = vdupq_n_u8('\t');
+        while (last - first >= 16)
+        {
+            uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(first));
+            uint8x16_t m = vmvnq_u8(vorrq_u8(vceqq_u8(v, space), vceqq_u8(v, tab)));
+            uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+            if (mask != 0)
+            {
+                return first + (count_trailing_zeros(mask) >> 2);
+            }
+            first += 16;
+        }
+    #endif
+        while (first != last && is_blank(*first))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif
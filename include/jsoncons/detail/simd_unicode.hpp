@@ -0,0 +1,499 @@
+// Copyright 2022 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_SIMD_UNICODE_HPP
+#define JSONCONS_DETAIL_SIMD_UNICODE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits> // std::integral_constant, std::make_unsigned
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/detail/simd_scan.hpp>
+
+namespace jsoncons {
+namespace detail {
+
+    // skip_ascii returns a pointer to the first code unit in [first,last)
+    // that is not ASCII (U+0000 through U+007F), or last if there is none.
+
+    template <class CharT>
+    const CharT* skip_ascii_scalar(const CharT* first, const CharT* last) noexcept
+    {
+        using uchar_type = typename std::make_unsigned<CharT>::type;
+        while (first != last && static_cast<uchar_type>(*first) < 0x80)
+        {
+            ++first;
+        }
+        return first;
+    }
+
+#if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+
+    // skip_ascii_avx2 stops at the 32 byte block that holds a byte from 0x80,
+    // or with fewer than 32 bytes left
+
+    JSONCONS_TARGET_AVX2 inline
+    const char* skip_ascii_avx2(const char* first, const char* last) noexcept
+    {
+        while (last - first >= 32)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            if (_mm256_movemask_epi8(v) != 0)
+            {
+                break;
+            }
+            first += 32;
+        }
+        return first;
+    }
+
+#endif
+
+    template <class CharT, std::size_t N>
+    const CharT* skip_ascii(const CharT* first, const CharT* last, std::integral_constant<std::size_t,N>) noexcept
+    {
+        return skip_ascii_scalar(first, last);
+    }
+
+    template <class CharT>
+    const CharT* skip_ascii(const CharT* first, const CharT* last, std::integral_constant<std::size_t,1>) noexcept
+    {
+    #if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+        if (last - first >= 32 && cpu_has_avx2())
+        {
+            first = reinterpret_cast<const CharT*>(skip_ascii_avx2(reinterpret_cast<const char*>(first),
+                                                                   reinterpret_cast<const char*>(last)));
+        }
+    #endif
+    #if defined(JSONCONS_HAS_SSE2)
+        while (last - first >= 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(v));
+            if (mask != 0)
+            {
+                return first + count_trailing_zeros(mask);
+            }
+            first += 16;
+        }
+    #elif defined(JSONCONS_HAS_NEON)
+        while (last - first >= 16)
+        {
+            uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(first));
+            if (vmaxvq_u8(v) >= 0x80)
+            {
+                break;
+            }
+            first += 16;
+        }
+    #endif
+        return skip_ascii_scalar(first, last);
+    }
+
+    template <class CharT>
+    const CharT* skip_ascii(const CharT* first, const CharT* last, std::integral_constant<std::size_t,2>) noexcept
+    {
+    #if defined(JSONCONS_HAS_SSE2)
+        const __m128i high = _mm_set1_epi16(static_cast<short>(0xff80));
+        const __m128i zero = _mm_setzero_si128();
+        while (last - first >= 8)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            uint32_t mask = ~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, high), zero))) & 0xffffu;
+            if (mask != 0)
+            {
+                return first + (count_trailing_zeros(mask) >> 1);
+            }
+            first += 8;
+        }
+    #elif defined(JSONCONS_HAS_NEON)
+        const uint16x8_t high = vdupq_n_u16(0xff80);
+        while (last - first >= 8)
+        {
+            uint16x8_t v = vld1q_u16(reinterpret_cast<const uint16_t*>(first));
+            if (vmaxvq_u16(vandq_u16(v, high)) != 0)
+            {
+                break;
+            }
+            first += 8;
+        }
+    #endif
+        return skip_ascii_scalar(first, last);
+    }
+
+    template <class CharT>
+    const CharT* skip_ascii(const CharT* first, const CharT* last, std::integral_constant<std::size_t,4>) noexcept
+    {
+    #if defined(JSONCONS_HAS_SSE2)
+        const __m128i high = _mm_set1_epi32(static_cast<int>(0xffffff80));
+        const __m128i zero = _mm_setzero_si128();
+        while (last - first >= 4)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            uint32_t mask = ~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(v, high), zero))) & 0xffffu;
+            if (mask != 0)
+            {
+                return first + (count_trailing_zeros(mask) >> 2);
+            }
+            first += 4;
+        }
+    #elif defined(JSONCONS_HAS_NEON)
+        const uint32x4_t high = vdupq_n_u32(0xffffff80);
+        while (last - first >= 4)
+        {
+            uint32x4_t v = vld1q_u32(reinterpret_cast<const uint32_t*>(first));
+            if (vmaxvq_u32(vandq_u32(v, high)) != 0)
+            {
+                break;
+            }
+            first += 4;
+        }
+    #endif
+        return skip_ascii_scalar(first, last);
+    }
+
+    template <class CharT>
+    const CharT* skip_ascii(const CharT* first, const CharT* last) noexcept
+    {
+        return skip_ascii(first, last, std::integral_constant<std::size_t,sizeof(CharT)>());
+    }
+
+    // skip_valid_utf8 returns a pointer p to a code point boundary in [first,last)
+    // such that [first,p) is well formed UTF-8. first must be a code point boundary.
+    // The caller validates [p,last) one sequence at a time, p is short of last
+    // when the next block contains an error or is too short to check as a block.
+
+    inline
+    const char* utf8_sequence_boundary(const char* first, const char* p) noexcept
+    {
+        // [first,p) is well formed except possibly for a truncated sequence at the end
+        for (std::ptrdiff_t i = 1; i <= 3 && p - i >= first; ++i)
+        {
+            uint8_t c = static_cast<uint8_t>(p[-i]);
+            if ((c & 0xc0) != 0x80)
+            {
+                std::ptrdiff_t length = c < 0x80 ? 1 : (c < 0xe0 ? 2 : (c < 0xf0 ? 3 : 4));
+                return length > i ? p - i : p;
+            }
+        }
+        return p;
+    }
+
+#if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+
+    // Block validation following Keiser and Lemire, "Validating UTF-8 In Less
+    // Than One Instruction Per Byte". Each byte is classified by the high nibble
+    // of the previous byte, the low nibble of the previous byte, and its own high
+    // nibble, the three lookups are and-ed together and are non-zero only for
+    // invalid two-byte combinations. A third or fourth byte must be a continuation
+    // byte exactly when the byte two or three positions earlier is a 3 or 4 byte lead.
+
+    struct utf8_lookup_tables
+    {
+        static constexpr uint8_t too_short = 1 << 0;  // 11______ 0_______, 11______ 11______
+        static constexpr uint8_t too_long = 1 << 1;   // 0_______ 10______
+        static constexpr uint8_t overlong_3 = 1 << 2; // 11100000 100_____
+        static constexpr uint8_t too_large = 1 << 3;  // 11110100 1001____ and above
+        static constexpr uint8_t surrogate = 1 << 4;  // 11101101 101_____
+        static constexpr uint8_t overlong_2 = 1 << 5; // 1100000_ 10______
+        static constexpr uint8_t too_large_1000 = 1 << 6; // 11110101 1000____ and above
+        static constexpr uint8_t overlong_4 = 1 << 6; // 11110000 1000____
+        static constexpr uint8_t two_conts = 1 << 7;  // 10______ 10______
+        static constexpr uint8_t carry = too_short | too_long | two_conts;
+    };
+
+    JSONCONS_TARGET_AVX2 inline
+    __m256i utf8_lookup16(__m256i index, int8_t t0, int8_t t1, int8_t t2, int8_t t3, int8_t t4, int8_t t5, int8_t t6, int8_t t7,
+                          int8_t t8, int8_t t9, int8_t t10, int8_t t11, int8_t t12, int8_t t13, int8_t t14, int8_t t15) noexcept
+    {
+        const __m256i table = _mm256_setr_epi8(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14, t15,
+                                               t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14, t15);
+        return _mm256_shuffle_epi8(table, index);
+    }
+
+    // Returns non-zero bytes where input, preceded by prev_input, is not well formed
+    JSONCONS_TARGET_AVX2 inline
+    __m256i check_utf8_block(__m256i input, __m256i prev_input) noexcept
+    {
+        using t = utf8_lookup_tables;
+
+        const __m256i low_nibble = _mm256_set1_epi8(0x0f);
+        const __m256i straddle = _mm256_permute2x128_si256(prev_input, input, 0x21);
+        const __m256i prev1 = _mm256_alignr_epi8(input, straddle, 15);
+        const __m256i prev2 = _mm256_alignr_epi8(input, straddle, 14);
+        const __m256i prev3 = _mm256_alignr_epi8(input, straddle, 13);
+
+        const __m256i byte_1_high = utf8_lookup16(_mm256_and_si256(_mm256_srli_epi16(prev1, 4), low_nibble),
+            t::too_long, t::too_long, t::too_long, t::too_long,
+            t::too_long, t::too_long, t::too_long, t::too_long,
+            static_cast<int8_t>(t::two_conts), static_cast<int8_t>(t::two_conts),
+            static_cast<int8_t>(t::two_conts), static_cast<int8_t>(t::two_conts),
+            t::too_short | t::overlong_2,
+            t::too_short,
+            t::too_short | t::overlong_3 | t::surrogate,
+            t::too_short | t::too_large | t::too_large_1000 | t::overlong_4);
+
+        const __m256i byte_1_low = utf8_lookup16(_mm256_and_si256(prev1, low_nibble),
+            static_cast<int8_t>(t::carry | t::overlong_3 | t::overlong_2 | t::overlong_4),
+            static_cast<int8_t>(t::carry | t::overlong_2),
+            static_cast<int8_t>(t::carry),
+            static_cast<int8_t>(t::carry),
+            static_cast<int8_t>(t::carry | t::too_large),
+            static_cast<int8_t>(t::carry | t::too_large | t::too_large_1000),
+            static_cast<int8_t>(t::carry | t::too_large | t::too_large_1000),
+            static_cast<int8_t>(t::carry | t::too_large | t::too_large_1000),
+            static_cast<int8_t>(t::carry | t::too_large | t::too_large_1000),
+            static_cast<int8_t>(t::carry | t::too_large | t::too_large_1000),
+            static_cast<int8_t>(t::carry | t::too_large | t::too_large_1000),
+            static_cast<int8_t>(t::carry | t::too_large | t::too_large_1000),
+            static_cast<int8_t>(t::carry | t::too_large | t::too_large_1000),
+            static_cast<int8_t>(t::carry | t::too_large | t::too_large_1000 | t::surrogate),
+            static_cast<int8_t>(t::carry | t::too_large | t::too_large_1000),
+            static_cast<int8_t>(t::carry | t::too_large | t::too_large_1000));
+
+        const __m256i byte_2_high = utf8_lookup16(_mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble),
+            t::too_short, t::too_short, t::too_short, t::too_short,
+            t::too_short, t::too_short, t::too_short, t::too_short,
+            static_cast<int8_t>(t::too_long | t::overlong_2 | t::two_conts | t::overlong_3 | t::too_large_1000 | t::overlong_4),
+            static_cast<int8_t>(t::too_long | t::overlong_2 | t::two_conts | t::overlong_3 | t::too_large),
+            static_cast<int8_t>(t::too_long | t::overlong_2 | t::two_conts | t::surrogate | t::too_large),
+            static_cast<int8_t>(t::too_long | t::overlong_2 | t::two_conts | t::surrogate | t::too_large),
+            t::too_short, t::too_short, t::too_short, t::too_short);
+
+        const __m256i special_cases = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+        // Only 111_____ (3 and 4 byte leads) two back and 1111____ three back reach 0x80
+        const __m256i is_third_byte = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xe0 - 0x80)));
+        const __m256i is_fourth_byte = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xf0 - 0x80)));
+        const __m256i must_be_continuation = _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte),
+                                                              _mm256_set1_epi8(static_cast<char>(0x80)));
+        return _mm256_xor_si256(must_be_continuation, special_cases);
+    }
+
+    // skip_valid_utf8_avx2 checks 32 byte blocks while at least 32 bytes remain
+
+    JSONCONS_TARGET_AVX2 inline
+    const char* skip_valid_utf8_avx2(const char* first, const char* last) noexcept
+    {
+        const char* start = first;
+        // The largest values that may end a block without a truncated sequence
+        const __m256i max_value = _mm256_setr_epi8(
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            static_cast<char>(0xf0 - 1), static_cast<char>(0xe0 - 1), static_cast<char>(0xc0 - 1));
+        __m256i prev_input = _mm256_setzero_si256();
+        while (last - first >= 32)
+        {
+            __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            if (_mm256_movemask_epi8(input) == 0)
+            {
+                // An all ASCII block, the previous block must not end with a truncated sequence
+                if (!_mm256_testz_si256(_mm256_subs_epu8(prev_input, max_value), _mm256_subs_epu8(prev_input, max_value)))
+                {
+                    break;
+                }
+            }
+            else
+            {
+                __m256i error = check_utf8_block(input, prev_input);
+                if (!_mm256_testz_si256(error, error))
+                {
+                    break;
+                }
+            }
+            prev_input = input;
+            first += 32;
+        }
+        return utf8_sequence_boundary(start, first);
+    }
+
+#endif
+
+    inline
+    const char* skip_valid_utf8(const char* first, const char* last) noexcept
+    {
+    #if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+        if (last - first >= 32 && cpu_has_avx2())
+        {
+            return skip_valid_utf8_avx2(first, last);
+        }
+    #endif
+        // Without a byte shuffle, only runs of ASCII are checked by block
+        if (first == last || static_cast<uint8_t>(*first) >= 0x80)
+        {
+            return first;
+        }
+        return skip_ascii(first, last);
+    }
+
+    // skip_non_surrogates returns a pointer to the first code unit in [first,last)
+    // that is a surrogate (U+D800 through U+DFFF), or for 32 bit code units,
+    // a surrogate or a value above U+10FFFF, or last if there is none.
+
+    template <class CharT>
+    const CharT* skip_non_surrogates_scalar(const CharT* first, const CharT* last) noexcept
+    {
+        using uchar_type = typename std::make_unsigned<CharT>::type;
+        while (first != last)
+        {
+            uint32_t ch = static_cast<uchar_type>(*first);
+            if ((ch & 0xfffff800) == 0xd800 || ch > 0x10ffff)
+            {
+                break;
+            }
+            ++first;
+        }
+        return first;
+    }
+
+    template <class CharT, std::size_t N>
+    const CharT* skip_non_surrogates(const CharT* first, const CharT* last, std::integral_constant<std::size_t,N>) noexcept
+    {
+        return skip_non_surrogates_scalar(first, last);
+    }
+
+    template <class CharT>
+    const CharT* skip_non_surrogates(const CharT* first, const CharT* last, std::integral_constant<std::size_t,2>) noexcept
+    {
+    #if defined(JSONCONS_HAS_SSE2)
+        const __m128i mask = _mm_set1_epi16(static_cast<short>(0xf800));
+        const __m128i surrogate = _mm_set1_epi16(static_cast<short>(0xd800));
+        while (last - first >= 8)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            uint32_t m = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, mask), surrogate)));
+            if (m != 0)
+            {
+                return first + (count_trailing_zeros(m) >> 1);
+            }
+            first += 8;
+        }
+    #elif defined(JSONCONS_HAS_NEON)
+        const uint16x8_t mask = vdupq_n_u16(0xf800);
+        const uint16x8_t surrogate = vdupq_n_u16(0xd800);
+        while (last - first >= 8)
+        {
+            uint16x8_t v = vld1q_u16(reinterpret_cast<const uint16_t*>(first));
+            if (vmaxvq_u16(vceqq_u16(vandq_u16(v, mask), surrogate)) != 0)
+            {
+                break;
+            }
+            first += 8;
+        }
+    #endif
+        return skip_non_surrogates_scalar(first, last);
+    }
+
+    template <class CharT>
+    const CharT* skip_non_surrogates(const CharT* first, const CharT* last, std::integral_constant<std::size_t,4>) noexcept
+    {
+    #if defined(JSONCONS_HAS_SSE2)
+        const __m128i mask = _mm_set1_epi32(static_cast<int>(0xfffff800));
+        const __m128i surrogate = _mm_set1_epi32(0xd800);
+        const __m128i max_plane = _mm_set1_epi32(0x10);
+        while (last - first >= 4)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            __m128i bad = _mm_or_si128(_mm_cmpeq_epi32(_mm_and_si128(v, mask), surrogate),
+                                       _mm_cmpgt_epi32(_mm_srli_epi32(v, 16), max_plane));
+            uint32_t m = static_cast<uint32_t>(_mm_movemask_epi8(bad));
+            if (m != 0)
+            {
+                return first + (count_trailing_zeros(m) >> 2);
+            }
+            first += 4;
+        }
+    #elif defined(JSONCONS_HAS_NEON)
+        const uint32x4_t mask = vdupq_n_u32(0xfffff800);
+        const uint32x4_t surrogate = vdupq_n_u32(0xd800);
+        const uint32x4_t max_legal = vdupq_n_u32(0x10ffff);
+        while (last - first >= 4)
+        {
+            uint32x4_t v = vld1q_u32(reinterpret_cast<const uint32_t*>(first));
+            if (vmaxvq_u32(vorrq_u32(vceqq_u32(vandq_u32(v, mask), surrogate), vcgtq_u32(v, max_legal))) != 0)
+            {
+                break;
+            }
+            first += 4;
+        }
+    #endif
+        return skip_non_surrogates_scalar(first, last);
+    }
+
+    template <class CharT>
+    const CharT* skip_non_surrogates(const CharT* first, const CharT* last) noexcept
+    {
+        return skip_non_surrogates(first, last, std::integral_constant<std::size_t,sizeof(CharT)>());
+    }
+
+    // copy_ascii copies n ASCII code units to a code unit sequence of
+    // another width
+
+    template <class CharT, class OutCharT>
+    void copy_ascii_scalar(const CharT* first, std::size_t n, OutCharT* out) noexcept
+    {
+        using uchar_type = typename std::make_unsigned<CharT>::type;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            out[i] = static_cast<OutCharT>(static_cast<uchar_type>(first[i]));
+        }
+    }
+
+    template <class CharT, class OutCharT>
+    void copy_ascii(const CharT* first, std::size_t n, OutCharT* out) noexcept
+    {
+    #if defined(JSONCONS_HAS_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        if (sizeof(CharT) == 1 && sizeof(OutCharT) == 2)
+        {
+            for (; n >= 16; n -= 16, first += 16, out += 16)
+            {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8(v, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpackhi_epi8(v, zero));
+            }
+        }
+        else if (sizeof(CharT) == 1 && sizeof(OutCharT) == 4)
+        {
+            for (; n >= 16; n -= 16, first += 16, out += 16)
+            {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+                __m128i lo = _mm_unpacklo_epi8(v, zero);
+                __m128i hi = _mm_unpackhi_epi8(v, zero);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi16(lo, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4), _mm_unpackhi_epi16(lo, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpacklo_epi16(hi, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 12), _mm_unpackhi_epi16(hi, zero));
+            }
+        }
+        else if (sizeof(CharT) == 2 && sizeof(OutCharT) == 1)
+        {
+            for (; n >= 16; n -= 16, first += 16, out += 16)
+            {
+                __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+                __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 8));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(lo, hi));
+            }
+        }
+        else if (sizeof(CharT) == 4 && sizeof(OutCharT) == 1)
+        {
+            for (; n >= 16; n -= 16, first += 16, out += 16)
+            {
+                __m128i a = _mm_packs_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)),
+                                            _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 4)));
+                __m128i b = _mm_packs_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 8)),
+                                            _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 12)));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(a, b));
+            }
+        }
+    #endif
+        copy_ascii_scalar(first, n, out);
+    }
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif
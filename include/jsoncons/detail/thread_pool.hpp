@@ -0,0 +1,109 @@
+// Copyright 2022 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_THREAD_POOL_HPP
+#define JSONCONS_DETAIL_THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility> // std::move
+#include <vector>
+
+namespace jsoncons {
+namespace detail {
+
+    // A fixed number of threads that run submitted tasks in submission order.
+    // The destructor waits for running tasks to finish and discards tasks that
+    // have not started, callers that need results wait for them first.
+
+    class thread_pool
+    {
+        std::vector<std::thread> threads_;
+        std::deque<std::function<void()>> tasks_;
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool stopping_;
+    public:
+        explicit thread_pool(std::size_t num_threads)
+            : stopping_(false)
+        {
+            if (num_threads == 0)
+            {
+                num_threads = 1;
+            }
+            threads_.reserve(num_threads);
+            for (std::size_t i = 0; i < num_threads; ++i)
+            {
+                threads_.emplace_back([this]() {work();});
+            }
+        }
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        ~thread_pool() noexcept
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stopping_ = true;
+                tasks_.clear();
+            }
+            cv_.notify_all();
+            for (auto& t : threads_)
+            {
+                t.join();
+            }
+        }
+
+        std::size_t size() const noexcept
+        {
+            return threads_.size();
+        }
+
+        void submit(std::function<void()> task)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                tasks_.push_back(std::move(task));
+            }
+            cv_.notify_one();
+        }
+
+        // The number of threads to use by default, at least one
+        static std::size_t default_size() noexcept
+        {
+            std::size_t n = std::thread::hardware_concurrency();
+            return n == 0 ? 1 : n;
+        }
+    private:
+        void work()
+        {
+            while (true)
+            {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    cv_.wait(lock, [this]() {return stopping_ || !tasks_.empty();});
+                    if (stopping_)
+                    {
+                        return;
+                    }
+                    task = std::move(tasks_.front());
+                    tasks_.pop_front();
+                }
+                task();
+            }
+        }
+    };
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif
@@ -16,7 +16,7 @@
 #include <stdio.h> // snprintf
 #include <jsoncons/config/jsoncons_config.hpp>
 #include <jsoncons/json_options.hpp>
-#include <jsoncons/detail/grisu3.hpp>
+#include <jsoncons/detail/ryu.hpp>
 #include <jsoncons/detail/parse_number.hpp>
 #include <jsoncons/traits_extension.hpp>
 
@@ -284,7 +284,7 @@ namespace detail {
     }
 
     template<class Result>
-    bool dtoa_scientific(double val, char decimal_point, Result& result)
+    bool dtoa_scientific(double val, char decimal_point, Result& result, std::false_type)
     {
         if (val == 0)
         {
@@ -316,6 +316,46 @@ namespace detail {
         return true;
     }
 
+    template<class Result>
+    bool dtoa_scientific(double v, char decimal_point, Result& result, std::true_type)
+    {
+        if (v == 0)
+        {
+            result.push_back('0');
+            result.push_back('.');
+            result.push_back('0');
+            return true;
+        }
+        if (!std::isfinite(v))
+        {
+            return dtoa_scientific(v, decimal_point, result, std::false_type());
+        }
+
+        int length = 0;
+        int k;
+
+        char buffer[32];
+
+        double u = std::signbit(v) ? -v : v;
+        jsoncons::detail::ryu(u, buffer, &length, &k);
+        if (std::signbit(v))
+        {
+            result.push_back('-');
+        }
+        result.push_back(buffer[0]);
+        if (length > 1)
+        {
+            result.push_back('.');
+            for (int i = 1; i < length; ++i)
+            {
+                result.push_back(buffer[i]);
+            }
+        }
+        result.push_back('e');
+        fill_exponent(k + length - 1, result);
+        return true;
+    }
+
     template<class Result>
     bool dtoa_general(double val, char decimal_point, Result& result, std::false_type)
     {
@@ -359,28 +399,26 @@ namespace detail {
             result.push_back('0');
             return true;
         }
+        if (!std::isfinite(v))
+        {
+            return dtoa_general(v, decimal_point, result, std::false_type());
+        }
 
         int length = 0;
         int k;
 
-        char buffer[100];
+        char buffer[32];
 
         double u = std::signbit(v) ? -v : v;
-        if (jsoncons::detail::grisu3(u, buffer, &length, &k))
+        jsoncons::detail::ryu(u, buffer, &length, &k);
+        if (std::signbit(v))
         {
-            if (std::signbit(v))
-            {
-                result.push_back('-');
-            }
-            // min exp: -4 is consistent with sprintf
-            // max exp: std::numeric_limits<double>::max_digits10
-            jsoncons::detail::prettify_string(buffer, length, k, -4, std::numeric_limits<double>::max_digits10, result);
-            return true;
-        }
-        else
-        {
-            return dtoa_general(v, decimal_point, result, std::false_type());
+            result.push_back('-');
         }
+        // min exp: -4 is consistent with sprintf
+        // max exp: std::numeric_limits<double>::max_digits10
+        jsoncons::detail::prettify_string(buffer, length, k, -4, std::numeric_limits<double>::max_digits10, result);
+        return true;
     }
 
     template<class Result>
@@ -426,26 +464,24 @@ namespace detail {
             result.push_back('0');
             return true;
         }
+        if (!std::isfinite(v))
+        {
+            return dtoa_fixed(v, decimal_point, result, std::false_type());
+        }
 
         int length = 0;
         int k;
 
-        char buffer[100];
+        char buffer[32];
 
         double u = std::signbit(v) ? -v : v;
-        if (jsoncons::detail::grisu3(u, buffer, &length, &k))
+        jsoncons::detail::ryu(u, buffer, &length, &k);
+        if (std::signbit(v))
         {
-            if (std::signbit(v))
-            {
-                result.push_back('-');
-            }
-            jsoncons::detail::prettify_string(buffer, length, k, std::numeric_limits<int>::lowest(), (std::numeric_limits<int>::max)(), result);
-            return true;
-        }
-        else
-        {
-            return dtoa_fixed(v, decimal_point, result, std::false_type());
+            result.push_back('-');
         }
+        jsoncons::detail::prettify_string(buffer, length, k, std::numeric_limits<int>::lowest(), (std::numeric_limits<int>::max)(), result);
+        return true;
     }
 
     template<class Result>
@@ -460,24 +496,22 @@ namespace detail {
         return dtoa_general(v, decimal_point, result, std::integral_constant<bool, std::numeric_limits<double>::is_iec559>());
     }
 
+    template<class Result>
+    bool dtoa_scientific(double v, char decimal_point, Result& result)
+    {
+        return dtoa_scientific(v, decimal_point, result, std::integral_constant<bool, std::numeric_limits<double>::is_iec559>());
+    }
+
     class write_double
     {
     private:
-        chars_to to_double_;
         float_chars_format float_format_;
         int precision_;
         char decimal_point_;
     public:
         write_double(float_chars_format float_format, int precision)
-           : float_format_(float_format), precision_(precision), decimal_point_('.')
+           : float_format_(float_format), precision_(precision), decimal_point_(0)
         {
-    #if !defined(JSONCONS_NO_LOCALECONV)
-            struct lconv *lc = localeconv();
-            if (lc != nullptr && lc->decimal_point[0] != 0)
-            {
-                decimal_point_ = lc->decimal_point[0];
-            }
-    #endif
         }
         write_double(const write_double&) = default;
 
@@ -502,11 +536,11 @@ namespace detail {
                         {
                             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("write_double failed."));
                         }
-                        dump_buffer(number_buffer, length, decimal_point_, result);
+                        dump_buffer(number_buffer, length, decimal_point(), result);
                     }
                     else
                     {
-                        if (!dtoa_fixed(val, decimal_point_, result))
+                        if (!dtoa_fixed(val, shortest_decimal_point(), result))
                         {
                             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("write_double failed."));
                         }
@@ -522,11 +556,11 @@ namespace detail {
                         {
                             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("write_double failed."));
                         }
-                        dump_buffer(number_buffer, length, decimal_point_, result);
+                        dump_buffer(number_buffer, length, decimal_point(), result);
                     }
                     else
                     {
-                        if (!dtoa_scientific(val, decimal_point_, result))
+                        if (!dtoa_scientific(val, shortest_decimal_point(), result))
                         {
                             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("write_double failed."));
                         }
@@ -542,11 +576,11 @@ namespace detail {
                         {
                             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("write_double failed."));
                         }
-                        dump_buffer(number_buffer, length, decimal_point_, result);
+                        dump_buffer(number_buffer, length, decimal_point(), result);
                     }
                     else
                     {
-                        if (!dtoa_general(val, decimal_point_, result))
+                        if (!dtoa_general(val, shortest_decimal_point(), result))
                         {
                             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("write_double failed."));
                         }
@@ -559,6 +593,31 @@ namespace detail {
             }
             return count;
         }
+    private:
+        // Shortest representations are produced without snprintf except on
+        // platforms without IEEE 754 doubles
+        char shortest_decimal_point()
+        {
+            return std::numeric_limits<double>::is_iec559 ? '.' : decimal_point();
+        }
+
+        // The decimal point of the C locale, needed only to read back what snprintf
+        // writes, queried on first use
+        char decimal_point()
+        {
+            if (decimal_point_ == 0)
+            {
+                decimal_point_ = '.';
+    #if !defined(JSONCONS_NO_LOCALECONV)
+                struct lconv *lc = localeconv();
+                if (lc != nullptr && lc->decimal_point[0] != 0)
+                {
+                    decimal_point_ = lc->decimal_point[0];
+                }
+    #endif
+            }
+            return decimal_point_;
+        }
     };
 
 } // namespace detail
@@ -11,6 +11,7 @@
 #include <tuple>
 #include <array>
 #include <memory>
+#include <iterator> // std::distance
 #include <type_traits> // std::enable_if, std::true_type, std::false_type
 #include <jsoncons/json_visitor.hpp>
 #include <jsoncons/json_decoder.hpp>
@@ -254,7 +255,8 @@ namespace jsoncons {
                            const Json& proto, 
                            std::error_code& ec)
         {
-            encoder.begin_array(val.size(),semantic_tag::none,ser_context(),ec);
+            encoder.begin_array(element_count(typename std::integral_constant<bool, traits_extension::has_size<T>::value>::type(), val),
+                                semantic_tag::none,ser_context(),ec);
             if (ec) return;
             for (auto it = std::begin(val); it != std::end(val); ++it)
             {
@@ -263,6 +265,16 @@ namespace jsoncons {
             }
             encoder.end_array(ser_context(), ec);
         }
+    private:
+        static std::size_t element_count(std::true_type, const T& val)
+        {
+            return val.size();
+        }
+
+        static std::size_t element_count(std::false_type, const T& val)
+        {
+            return static_cast<std::size_t>(std::distance(std::begin(val), std::end(val)));
+        }
     };
 
     template <class T, class CharT>
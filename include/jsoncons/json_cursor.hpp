@@ -267,6 +267,49 @@ public:
         read_next(ec);
     }
 
+    void skip() override
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    // Scans for the closing bracket without producing events for the
+    // contents, then reads the end_object or end_array event
+    void skip(std::error_code& ec) override
+    {
+        if (done())
+        {
+            return;
+        }
+        switch (cursor_visitor_.event().event_type())
+        {
+            case staj_event_type::begin_object:
+            case staj_event_type::begin_array:
+                break;
+            default:
+                return;
+        }
+        while (!parser_.skip_container())
+        {
+            if (source_.eof())
+            {
+                ec = json_errc::unexpected_eof;
+                return;
+            }
+            auto s = source_.read_buffer(ec);
+            if (ec) return;
+            if (s.size() > 0)
+            {
+                parser_.update(s.data(),s.size());
+            }
+        }
+        read_next(ec);
+    }
+
     void check_done()
     {
         std::error_code ec;
@@ -13,6 +13,7 @@
 #include <memory> // std::allocator
 #include <iterator> // std::make_move_iterator
 #include <utility> // std::move
+#include <functional> // std::less
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_visitor.hpp>
 
@@ -80,6 +81,8 @@ private:
     std::vector<stack_item,stack_item_allocator_type> item_stack_;
     std::vector<structure_info,structure_info_allocator_type> structure_stack_;
     bool is_valid_;
+    const char_type* borrowed_first_;
+    const char_type* borrowed_last_;
 
 public:
     json_decoder(const temp_allocator_type& temp_alloc = temp_allocator_type())
@@ -89,7 +92,9 @@ public:
           name_(result_allocator_),
           item_stack_(temp_allocator_),
           structure_stack_(temp_allocator_),
-          is_valid_(false) 
+          is_valid_(false),
+          borrowed_first_(nullptr),
+          borrowed_last_(nullptr)
     {
         item_stack_.reserve(1000);
         structure_stack_.reserve(100);
@@ -104,7 +109,9 @@ public:
           name_(result_allocator_),
           item_stack_(),
           structure_stack_(),
-          is_valid_(false)
+          is_valid_(false),
+          borrowed_first_(nullptr),
+          borrowed_last_(nullptr)
     {
         item_stack_.reserve(1000);
         structure_stack_.reserve(100);
@@ -120,7 +127,9 @@ public:
           name_(result_allocator_),
           item_stack_(temp_allocator_),
           structure_stack_(temp_allocator_),
-          is_valid_(false)
+          is_valid_(false),
+          borrowed_first_(nullptr),
+          borrowed_last_(nullptr)
     {
         item_stack_.reserve(1000);
         structure_stack_.reserve(100);
@@ -135,6 +144,14 @@ public:
         structure_stack_.emplace_back(structure_type::root_t, 0);
     }
 
+    // String values that lie within input are stored as views into it
+    // rather than copied, input must outlive the result
+    void borrow_strings(const string_view_type& input)
+    {
+        borrowed_first_ = input.data();
+        borrowed_last_ = input.data() + input.size();
+    }
+
     bool is_valid() const
     {
         return is_valid_;
@@ -157,6 +174,12 @@ public:
 
 private:
 
+    bool is_borrowed(const string_view_type& sv) const
+    {
+        std::less<const char_type*> less;
+        return borrowed_first_ != nullptr && !less(sv.data(), borrowed_first_) && !less(borrowed_last_, sv.data() + sv.size());
+    }
+
     void visit_flush() override
     {
     }
@@ -258,10 +281,17 @@ private:
         {
             case structure_type::object_t:
             case structure_type::array_t:
-                item_stack_.emplace_back(std::forward<key_type>(name_), sv, tag, result_allocator_);
+                if (is_borrowed(sv))
+                {
+                    item_stack_.emplace_back(std::forward<key_type>(name_), borrowed_string_arg, sv, tag, result_allocator_);
+                }
+                else
+                {
+                    item_stack_.emplace_back(std::forward<key_type>(name_), sv, tag, result_allocator_);
+                }
                 break;
             case structure_type::root_t:
-                result_ = Json(sv, tag, result_allocator_);
+                result_ = is_borrowed(sv) ? Json(borrowed_string_arg, sv, tag, result_allocator_) : Json(sv, tag, result_allocator_);
                 is_valid_ = true;
                 return false;
         }
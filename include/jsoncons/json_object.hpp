@@ -23,6 +23,7 @@
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/allocator_holder.hpp>
 #include <jsoncons/json_array.hpp>
+#include <jsoncons/detail/object_hash_index.hpp>
 
 namespace jsoncons {
 
@@ -271,7 +272,10 @@ namespace jsoncons {
         using key_value_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<key_value_type>;
         using key_value_container_type = SequenceContainer<key_value_type,key_value_allocator_type>;
 
+        using hash_index_type = detail::object_hash_index<allocator_type>;
+
         key_value_container_type members_;
+        hash_index_type hash_index_;
     public:
         using iterator = typename key_value_container_type::iterator;
         using const_iterator = typename key_value_container_type::const_iterator;
@@ -284,19 +288,22 @@ namespace jsoncons {
 
         explicit sorted_json_object(const allocator_type& alloc)
             : allocator_holder<allocator_type>(alloc), 
-              members_(key_value_allocator_type(alloc))
+              members_(key_value_allocator_type(alloc)),
+              hash_index_(alloc)
         {
         }
 
         sorted_json_object(const sorted_json_object& val)
             : allocator_holder<allocator_type>(val.get_allocator()),
-              members_(val.members_)
+              members_(val.members_),
+              hash_index_(val.hash_index_)
         {
         }
 
         sorted_json_object(sorted_json_object&& val)
             : allocator_holder<allocator_type>(val.get_allocator()), 
-              members_(std::move(val.members_))
+              members_(std::move(val.members_)),
+              hash_index_(std::move(val.hash_index_))
         {
         }
 
@@ -304,6 +311,7 @@ namespace jsoncons {
         {
             allocator_holder<allocator_type>::operator=(val.get_allocator());
             members_ = val.members_;
+            hash_index_ = val.hash_index_;
             return *this;
         }
 
@@ -315,12 +323,14 @@ namespace jsoncons {
 
         sorted_json_object(const sorted_json_object& val, const allocator_type& alloc) 
             : allocator_holder<allocator_type>(alloc), 
-              members_(val.members_,key_value_allocator_type(alloc))
+              members_(val.members_,key_value_allocator_type(alloc)),
+              hash_index_(val.hash_index_,alloc)
         {
         }
 
         sorted_json_object(sorted_json_object&& val,const allocator_type& alloc) 
-            : allocator_holder<allocator_type>(alloc), members_(std::move(val.members_),key_value_allocator_type(alloc))
+            : allocator_holder<allocator_type>(alloc), members_(std::move(val.members_),key_value_allocator_type(alloc)),
+              hash_index_(std::move(val.hash_index_),alloc)
         {
         }
 
@@ -338,13 +348,15 @@ namespace jsoncons {
             auto it = std::unique(members_.begin(), members_.end(),
                                   [](const key_value_type& a, const key_value_type& b) -> bool { return !(a.key().compare(b.key()));});
             members_.erase(it, members_.end());
+            build_hash_index();
         }
 
         template<class InputIt>
         sorted_json_object(InputIt first, InputIt last, 
                     const allocator_type& alloc)
             : allocator_holder<allocator_type>(alloc), 
-              members_(key_value_allocator_type(alloc))
+              members_(key_value_allocator_type(alloc)),
+              hash_index_(alloc)
         {
             std::size_t count = std::distance(first,last);
             members_.reserve(count);
@@ -357,12 +369,14 @@ namespace jsoncons {
             auto it = std::unique(members_.begin(), members_.end(),
                                   [](const key_value_type& a, const key_value_type& b) -> bool { return !(a.key().compare(b.key()));});
             members_.erase(it, members_.end());
+            build_hash_index();
         }
 
         sorted_json_object(const std::initializer_list<std::pair<std::basic_string<char_type>,Json>>& init, 
                     const allocator_type& alloc = allocator_type())
             : allocator_holder<allocator_type>(alloc), 
-              members_(key_value_allocator_type(alloc))
+              members_(key_value_allocator_type(alloc)),
+              hash_index_(alloc)
         {
             members_.reserve(init.size());
             for (auto& item : init)
@@ -384,6 +398,7 @@ namespace jsoncons {
         void swap(sorted_json_object& val) noexcept
         {
             members_.swap(val.members_);
+            hash_index_.swap(val.hash_index_);
         }
 
         iterator begin()
@@ -410,7 +425,11 @@ namespace jsoncons {
 
         std::size_t capacity() const {return members_.capacity();}
 
-        void clear() {members_.clear();}
+        void clear() 
+        {
+            members_.clear();
+            hash_index_.clear();
+        }
 
         void shrink_to_fit() 
         {
@@ -443,6 +462,11 @@ namespace jsoncons {
 
         iterator find(const string_view_type& name) noexcept
         {
+            if (hash_index_.active())
+            {
+                std::size_t pos = hash_index_.find(members_, name);
+                return pos == hash_index_type::npos ? members_.end() : members_.begin() + pos;
+            }
             auto p = std::equal_range(members_.begin(),members_.end(), name, 
                                        Comp());        
             return p.first == p.second ? members_.end() : p.first;
@@ -450,6 +474,11 @@ namespace jsoncons {
 
         const_iterator find(const string_view_type& name) const noexcept
         {
+            if (hash_index_.active())
+            {
+                std::size_t pos = hash_index_.find(members_, name);
+                return pos == hash_index_type::npos ? members_.end() : members_.begin() + pos;
+            }
             auto p = std::equal_range(members_.begin(),members_.end(), name, 
                                        Comp());        
             return p.first == p.second ? members_.end() : p.first;
@@ -457,6 +486,8 @@ namespace jsoncons {
 
         iterator erase(const_iterator pos) 
         {
+            std::size_t pos1 = pos - members_.begin();
+            index_erasing(pos1, pos1 + 1);
     #if defined(JSONCONS_NO_VECTOR_ERASE_TAKES_CONST_ITERATOR)
             iterator it = members_.begin() + (pos - members_.begin());
             return members_.erase(it);
@@ -467,6 +498,7 @@ namespace jsoncons {
 
         iterator erase(const_iterator first, const_iterator last) 
         {
+            index_erasing(first - members_.begin(), last - members_.begin());
     #if defined(JSONCONS_NO_VECTOR_ERASE_TAKES_CONST_ITERATOR)
             iterator it1 = members_.begin() + (first - members_.begin());
             iterator it2 = members_.begin() + (last - members_.begin());
@@ -481,6 +513,8 @@ namespace jsoncons {
             auto it = find(name);
             if (it != members_.end())
             {
+                std::size_t pos1 = it - members_.begin();
+                index_erasing(pos1, pos1 + 1);
                 members_.erase(it);
             }
         }
@@ -499,6 +533,7 @@ namespace jsoncons {
             auto it = std::unique(members_.begin(), members_.end(),
                                   [](const key_value_type& a, const key_value_type& b) -> bool { return !(a.key().compare(b.key()));});
             members_.erase(it, members_.end());
+            build_hash_index();
         }
 
         template<class InputIt, class Convert>
@@ -524,6 +559,7 @@ namespace jsoncons {
                         members_.emplace_back(convert(*s));
                     }
                 }
+                build_hash_index();
             }
         }
 
@@ -533,6 +569,16 @@ namespace jsoncons {
         typename std::enable_if<traits_extension::is_stateless<A>::value,std::pair<iterator,bool>>::type
         insert_or_assign(const string_view_type& name, T&& value)
         {
+            if (hash_index_.active())
+            {
+                std::size_t pos = hash_index_.find(members_, name);
+                if (pos != hash_index_type::npos)
+                {
+                    auto it = members_.begin() + pos;
+                    it->value(Json(std::forward<T>(value)));
+                    return std::make_pair(it,false);
+                }
+            }
             bool inserted;
             auto it = std::lower_bound(members_.begin(),members_.end(), name, 
                                        Comp());        
@@ -540,6 +586,7 @@ namespace jsoncons {
             {
                 members_.emplace_back(key_type(name.begin(),name.end()), 
                                             std::forward<T>(value));
+                index_inserted(members_.size() - 1);
                 inserted = true;
                 it = members_.begin() + members_.size() - 1;
             }
@@ -553,6 +600,7 @@ namespace jsoncons {
                 it = members_.emplace(it,
                                             key_type(name.begin(),name.end()),
                                             std::forward<T>(value));
+                index_inserted(it - members_.begin());
                 inserted = true;
             }
             return std::make_pair(it,inserted);
@@ -562,6 +610,16 @@ namespace jsoncons {
         typename std::enable_if<!traits_extension::is_stateless<A>::value,std::pair<iterator,bool>>::type
         insert_or_assign(const string_view_type& name, T&& value)
         {
+            if (hash_index_.active())
+            {
+                std::size_t pos = hash_index_.find(members_, name);
+                if (pos != hash_index_type::npos)
+                {
+                    auto it = members_.begin() + pos;
+                    it->value(Json(std::forward<T>(value), get_allocator()));
+                    return std::make_pair(it,false);
+                }
+            }
             bool inserted;
             auto it = std::lower_bound(members_.begin(),members_.end(), name, 
                                        Comp());        
@@ -569,6 +627,7 @@ namespace jsoncons {
             {
                 members_.emplace_back(key_type(name.begin(),name.end(), get_allocator()), 
                                             std::forward<T>(value),get_allocator());
+                index_inserted(members_.size() - 1);
                 inserted = true;
                 it = members_.begin() + members_.size() - 1;
             }
@@ -582,6 +641,7 @@ namespace jsoncons {
                 it = members_.emplace(it,
                                             key_type(name.begin(),name.end(), get_allocator()),
                                             std::forward<T>(value),get_allocator());
+                index_inserted(it - members_.begin());
                 inserted = true;
             }
             return std::make_pair(it,inserted);
@@ -593,6 +653,14 @@ namespace jsoncons {
         typename std::enable_if<traits_extension::is_stateless<A>::value,std::pair<iterator,bool>>::type
         try_emplace(const string_view_type& name, Args&&... args)
         {
+            if (hash_index_.active())
+            {
+                std::size_t pos = hash_index_.find(members_, name);
+                if (pos != hash_index_type::npos)
+                {
+                    return std::make_pair(members_.begin() + pos,false);
+                }
+            }
             bool inserted;
             auto it = std::lower_bound(members_.begin(),members_.end(), name, 
                                        Comp());        
@@ -600,6 +668,7 @@ namespace jsoncons {
             {
                 members_.emplace_back(key_type(name.begin(),name.end()), 
                                             std::forward<Args>(args)...);
+                index_inserted(members_.size() - 1);
                 it = members_.begin() + members_.size() - 1;
                 inserted = true;
             }
@@ -612,6 +681,7 @@ namespace jsoncons {
                 it = members_.emplace(it,
                                             key_type(name.begin(),name.end()),
                                             std::forward<Args>(args)...);
+                index_inserted(it - members_.begin());
                 inserted = true;
             }
             return std::make_pair(it,inserted);
@@ -621,6 +691,14 @@ namespace jsoncons {
         typename std::enable_if<!traits_extension::is_stateless<A>::value,std::pair<iterator,bool>>::type
         try_emplace(const string_view_type& name, Args&&... args)
         {
+            if (hash_index_.active())
+            {
+                std::size_t pos = hash_index_.find(members_, name);
+                if (pos != hash_index_type::npos)
+                {
+                    return std::make_pair(members_.begin() + pos,false);
+                }
+            }
             bool inserted;
             auto it = std::lower_bound(members_.begin(),members_.end(), name, 
                                        Comp());        
@@ -628,6 +706,7 @@ namespace jsoncons {
             {
                 members_.emplace_back(key_type(name.begin(),name.end(), get_allocator()), 
                                             std::forward<Args>(args)...);
+                index_inserted(members_.size() - 1);
                 it = members_.begin() + members_.size() - 1;
                 inserted = true;
             }
@@ -640,6 +719,7 @@ namespace jsoncons {
                 it = members_.emplace(it,
                                             key_type(name.begin(),name.end(), get_allocator()),
                                             std::forward<Args>(args)...);
+                index_inserted(it - members_.begin());
                 inserted = true;
             }
             return std::make_pair(it,inserted);
@@ -666,6 +746,7 @@ namespace jsoncons {
             {
                 members_.emplace_back(key_type(name.begin(),name.end()), 
                                             std::forward<Args>(args)...);
+                index_inserted(members_.size() - 1);
                 it = members_.begin() + (members_.size() - 1);
             }
             else if (it->key() == name)
@@ -676,6 +757,7 @@ namespace jsoncons {
                 it = members_.emplace(it,
                                             key_type(name.begin(),name.end()),
                                             std::forward<Args>(args)...);
+                index_inserted(it - members_.begin());
             }
 
             return it;
@@ -701,6 +783,7 @@ namespace jsoncons {
             {
                 members_.emplace_back(key_type(name.begin(),name.end(), get_allocator()), 
                                             std::forward<Args>(args)...);
+                index_inserted(members_.size() - 1);
                 it = members_.begin() + (members_.size() - 1);
             }
             else if (it->key() == name)
@@ -711,6 +794,7 @@ namespace jsoncons {
                 it = members_.emplace(it,
                                             key_type(name.begin(),name.end(), get_allocator()),
                                             std::forward<Args>(args)...);
+                index_inserted(it - members_.begin());
             }
             return it;
         }
@@ -737,6 +821,7 @@ namespace jsoncons {
             {
                 members_.emplace_back(key_type(name.begin(),name.end()), 
                                             std::forward<T>(value));
+                index_inserted(members_.size() - 1);
                 it = members_.begin() + (members_.size() - 1);
             }
             else if (it->key() == name)
@@ -748,6 +833,7 @@ namespace jsoncons {
                 it = members_.emplace(it,
                                             key_type(name.begin(),name.end()),
                                             std::forward<T>(value));
+                index_inserted(it - members_.begin());
             }
             return it;
         }
@@ -772,6 +858,7 @@ namespace jsoncons {
             {
                 members_.emplace_back(key_type(name.begin(),name.end(), get_allocator()), 
                                             std::forward<T>(value),get_allocator());
+                index_inserted(members_.size() - 1);
                 it = members_.begin() + (members_.size() - 1);
             }
             else if (it->key() == name)
@@ -783,6 +870,7 @@ namespace jsoncons {
                 it = members_.emplace(it,
                                             key_type(name.begin(),name.end(), get_allocator()),
                                             std::forward<T>(value),get_allocator());
+                index_inserted(it - members_.begin());
             }
             return it;
         }
@@ -808,10 +896,12 @@ namespace jsoncons {
                 if (pos == members_.end() )
                 {
                     members_.emplace_back(*it);
+                    index_inserted(members_.size() - 1);
                 }
                 else if ((*it).key() != pos->key())
                 {
-                    members_.emplace(pos,*it);
+                    pos = members_.emplace(pos,*it);
+                    index_inserted(pos - members_.begin());
                 }
             }
         }
@@ -844,11 +934,13 @@ namespace jsoncons {
                 if (pos == members_.end() )
                 {
                     members_.emplace_back(*it);
+                    index_inserted(members_.size() - 1);
                     hint = members_.begin() + (members_.size() - 1);
                 }
                 else if ((*it).key() != pos->key())
                 {
                     hint = members_.emplace(pos,*it);
+                    index_inserted(hint - members_.begin());
                 }
             }
         }
@@ -874,6 +966,7 @@ namespace jsoncons {
                 if (pos == members_.end() )
                 {
                     members_.emplace_back(*it);
+                    index_inserted(members_.size() - 1);
                 }
                 else 
                 {
@@ -910,6 +1003,7 @@ namespace jsoncons {
                 if (pos == members_.end() )
                 {
                     members_.emplace_back(*it);
+                    index_inserted(members_.size() - 1);
                     hint = members_.begin() + (members_.size() - 1);
                 }
                 else 
@@ -931,6 +1025,51 @@ namespace jsoncons {
         }
     private:
 
+        // Adds the member at pos to the hash index, call after inserting it
+        void index_inserted(std::size_t pos)
+        {
+            if (hash_index_.active())
+            {
+                if (pos + 1 < members_.size())
+                {
+                    hash_index_.shift(pos, 1);
+                }
+                hash_index_.insert(hash_index_type::hash(members_[pos].key()), pos);
+            }
+            else if (members_.size() >= hash_index_type::threshold)
+            {
+                hash_index_.build(members_);
+            }
+        }
+
+        // Removes the members at [pos1, pos2) from the hash index, call before erasing them
+        void index_erasing(std::size_t pos1, std::size_t pos2)
+        {
+            if (hash_index_.active())
+            {
+                for (std::size_t i = pos1; i < pos2; ++i)
+                {
+                    hash_index_.erase(hash_index_type::hash(members_[i].key()), i);
+                }
+                if (pos2 < members_.size())
+                {
+                    hash_index_.shift(pos2, -static_cast<std::ptrdiff_t>(pos2 - pos1));
+                }
+            }
+        }
+
+        void build_hash_index()
+        {
+            if (members_.size() >= hash_index_type::threshold)
+            {
+                hash_index_.build(members_);
+            }
+            else
+            {
+                hash_index_.clear();
+            }
+        }
+
         void flatten_and_destroy() noexcept
         {
             if (!members_.empty())
@@ -975,9 +1114,13 @@ namespace jsoncons {
         typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<std::size_t> index_allocator_type;
         //using index_container_type = typename implementation_policy::template sequence_container_type<std::size_t,index_allocator_type>;
         using index_container_type = SequenceContainer<std::size_t,index_allocator_type>;
+        using hash_index_type = detail::object_hash_index<allocator_type>;
 
+        // Small objects are looked up through index_, positions sorted by key,
+        // large objects through hash_index_, only one of them is in use
         key_value_container_type members_;
         index_container_type index_;
+        hash_index_type hash_index_;
 
         struct Comp
         {
@@ -1003,35 +1146,40 @@ namespace jsoncons {
         order_preserving_json_object(const allocator_type& alloc)
             : allocator_holder<allocator_type>(alloc), 
               members_(key_value_allocator_type(alloc)), 
-              index_(index_allocator_type(alloc))
+              index_(index_allocator_type(alloc)),
+              hash_index_(alloc)
         {
         }
 
         order_preserving_json_object(const order_preserving_json_object& val)
             : allocator_holder<allocator_type>(val.get_allocator()), 
               members_(val.members_),
-              index_(val.index_)
+              index_(val.index_),
+              hash_index_(val.hash_index_)
         {
         }
 
         order_preserving_json_object(order_preserving_json_object&& val)
             : allocator_holder<allocator_type>(val.get_allocator()), 
               members_(std::move(val.members_)),
-              index_(std::move(val.index_))
+              index_(std::move(val.index_)),
+              hash_index_(std::move(val.hash_index_))
         {
         }
 
         order_preserving_json_object(const order_preserving_json_object& val, const allocator_type& alloc) 
             : allocator_holder<allocator_type>(alloc), 
               members_(val.members_,key_value_allocator_type(alloc)),
-              index_(val.index_,index_allocator_type(alloc))
+              index_(val.index_,index_allocator_type(alloc)),
+              hash_index_(val.hash_index_,alloc)
         {
         }
 
         order_preserving_json_object(order_preserving_json_object&& val,const allocator_type& alloc) 
             : allocator_holder<allocator_type>(alloc), 
               members_(std::move(val.members_),key_value_allocator_type(alloc)),
-              index_(std::move(val.index_),index_allocator_type(alloc))
+              index_(std::move(val.index_),index_allocator_type(alloc)),
+              hash_index_(std::move(val.hash_index_),alloc)
         {
         }
 
@@ -1045,7 +1193,7 @@ namespace jsoncons {
                 members_.emplace_back(get_key_value<KeyT,Json>()(*s));
             }
 
-            build_index();
+            build_sorted_index();
             auto last_unique = std::unique(index_.begin(), index_.end(),
                 [&](std::size_t a, std::size_t b) { return !(members_.at(a).key().compare(members_.at(b).key())); });
 
@@ -1075,7 +1223,8 @@ namespace jsoncons {
                     const allocator_type& alloc)
             : allocator_holder<allocator_type>(alloc), 
               members_(key_value_allocator_type(alloc)), 
-              index_(index_allocator_type(alloc))
+              index_(index_allocator_type(alloc)),
+              hash_index_(alloc)
         {
             std::size_t count = std::distance(first,last);
             members_.reserve(count);
@@ -1084,7 +1233,7 @@ namespace jsoncons {
                 members_.emplace_back(get_key_value<KeyT,Json>()(*s));
             }
 
-            build_index();
+            build_sorted_index();
             auto last_unique = std::unique(index_.begin(), index_.end(),
                 [&](std::size_t a, std::size_t b) { return !(members_.at(a).key().compare(members_.at(b).key())); });
 
@@ -1113,7 +1262,8 @@ namespace jsoncons {
                     const allocator_type& alloc = allocator_type())
             : allocator_holder<allocator_type>(alloc), 
               members_(key_value_allocator_type(alloc)), 
-              index_(index_allocator_type(alloc))
+              index_(index_allocator_type(alloc)),
+              hash_index_(alloc)
         {
             members_.reserve(init.size());
             for (auto& item : init)
@@ -1138,12 +1288,15 @@ namespace jsoncons {
             allocator_holder<allocator_type>::operator=(val.get_allocator());
             members_ = val.members_;
             index_ = val.index_;
+            hash_index_ = val.hash_index_;
             return *this;
         }
 
         void swap(order_preserving_json_object& val) noexcept
         {
             members_.swap(val.members_);
+            index_.swap(val.index_);
+            hash_index_.swap(val.hash_index_);
         }
 
         bool empty() const
@@ -1179,6 +1332,7 @@ namespace jsoncons {
         {
             members_.clear();
             index_.clear();
+            hash_index_.clear();
         }
 
         void shrink_to_fit() 
@@ -1213,6 +1367,11 @@ namespace jsoncons {
 
         iterator find(const string_view_type& name) noexcept
         {
+            if (hash_index_.active())
+            {
+                std::size_t pos = hash_index_.find(members_, name);
+                return pos == hash_index_type::npos ? members_.end() : members_.begin() + pos;
+            }
             auto p = std::equal_range(index_.begin(),index_.end(), name, 
                                         Comp(members_));        
             return p.first == p.second ? members_.end() : members_.begin() + *p.first;
@@ -1220,6 +1379,11 @@ namespace jsoncons {
 
         const_iterator find(const string_view_type& name) const noexcept
         {
+            if (hash_index_.active())
+            {
+                std::size_t pos = hash_index_.find(members_, name);
+                return pos == hash_index_type::npos ? members_.end() : members_.begin() + pos;
+            }
             auto p = std::equal_range(index_.begin(),index_.end(), name, 
                                         Comp(members_));        
             return p.first == p.second ? members_.end() : members_.begin() + *p.first;
@@ -1297,7 +1461,7 @@ namespace jsoncons {
                 members_.emplace_back(convert(*s));
             }
 
-            build_index();
+            build_sorted_index();
             auto last_unique = std::unique(index_.begin(), index_.end(),
                 [&](std::size_t a, std::size_t b) { return !(members_.at(a).key().compare(members_.at(b).key())); });
 
@@ -1690,7 +1854,29 @@ namespace jsoncons {
 
         std::pair<std::size_t,bool> insert_index_entry(const string_view_type& key, std::size_t pos)
         {
-            JSONCONS_ASSERT(pos <= index_.size());
+            JSONCONS_ASSERT(pos <= members_.size());
+
+            if (!hash_index_.active() && members_.size() + 1 >= hash_index_type::threshold)
+            {
+                hash_index_.build(members_);
+                index_.clear();
+                index_.shrink_to_fit();
+            }
+            if (hash_index_.active())
+            {
+                uint32_t h = hash_index_type::hash(key);
+                std::size_t found = hash_index_.find(members_, key, h);
+                if (found != hash_index_type::npos)
+                {
+                    return std::make_pair(found,false);
+                }
+                if (pos < members_.size())
+                {
+                    hash_index_.shift(pos, 1);
+                }
+                hash_index_.insert(h, pos);
+                return std::make_pair(pos,true);
+            }
 
             auto it = std::lower_bound(index_.begin(),index_.end(), key, 
                                         Comp(members_));        
@@ -1732,7 +1918,20 @@ namespace jsoncons {
         void erase_index_entries(std::size_t pos1, std::size_t pos2)
         {
             JSONCONS_ASSERT(pos1 <= pos2);
-            JSONCONS_ASSERT(pos2 <= index_.size());
+            JSONCONS_ASSERT(pos2 <= members_.size());
+
+            if (hash_index_.active())
+            {
+                for (std::size_t i = pos1; i < pos2; ++i)
+                {
+                    hash_index_.erase(hash_index_type::hash(members_[i].key()), i);
+                }
+                if (pos2 < members_.size())
+                {
+                    hash_index_.shift(pos2, -static_cast<std::ptrdiff_t>(pos2 - pos1));
+                }
+                return;
+            }
 
             const size_t offset = pos2 - pos1;
             const size_t n = index_.size() - offset;
@@ -1755,6 +1954,21 @@ namespace jsoncons {
         }
 
         void build_index()
+        {
+            if (members_.size() >= hash_index_type::threshold)
+            {
+                hash_index_.build(members_);
+                index_.clear();
+                index_.shrink_to_fit();
+            }
+            else
+            {
+                hash_index_.clear();
+                build_sorted_index();
+            }
+        }
+
+        void build_sorted_index()
         {
             index_.clear();
             index_.reserve(members_.size());
@@ -21,6 +21,7 @@
 #include <jsoncons/json_visitor.hpp>
 #include <jsoncons/json_error.hpp>
 #include <jsoncons/detail/parse_number.hpp>
+#include <jsoncons/detail/simd_scan.hpp>
 
 #define JSONCONS_ILLEGAL_CONTROL_CHARACTER \
         case 0x00:case 0x01:case 0x02:case 0x03:case 0x04:case 0x05:case 0x06:case 0x07:case 0x08:case 0x0b: \
@@ -161,6 +162,12 @@ private:
     std::vector<json_parse_state,parse_state_allocator_type> state_stack_;
     std::vector<std::pair<string_view_type,double>> string_double_map_;
 
+    // Container skipping
+    enum class skip_state : uint8_t {value, string, escape, slash, line_comment, block_comment, block_comment_star};
+    skip_state skip_state_;
+    std::size_t skip_depth_;
+    bool skip_cr_;
+
     // Noncopyable and nonmoveable
     basic_json_parser(const basic_json_parser&) = delete;
     basic_json_parser& operator=(const basic_json_parser&) = delete;
@@ -203,7 +210,10 @@ public:
          more_(true),
          done_(false),
          string_buffer_(alloc),
-         state_stack_(alloc)
+         state_stack_(alloc),
+         skip_state_(skip_state::value),
+         skip_depth_(0),
+         skip_cr_(false)
     {
         string_buffer_.reserve(initial_string_buffer_capacity_);
 
@@ -293,9 +303,12 @@ public:
             {
                 case ' ':
                 case '\t':
-                    ++input_ptr_;
-                    ++position_;
+                {
+                    const char_type* p = jsoncons::detail::skip_blanks(input_ptr_ + 1, local_input_end);
+                    position_ += (p - input_ptr_);
+                    input_ptr_ = p;
                     break;
+                }
                 case '\r': 
                     push_state(state_);
                     ++input_ptr_;
@@ -493,6 +506,9 @@ public:
         position_ = 0;
         mark_position_ = 0;
         nesting_depth_ = 0;
+        skip_state_ = skip_state::value;
+        skip_depth_ = 0;
+        skip_cr_ = false;
     }
 
     void restart()
@@ -546,6 +562,139 @@ public:
         input_ptr_ = begin_input_;
     }
 
+    // Called after begin_object or begin_array, advances to the bracket that
+    // closes the object or array, counting brackets outside of strings and
+    // comments. The skipped text is not otherwise validated. Returns false if
+    // the buffer is exhausted first, the scan resumes after the next update.
+    bool skip_container()
+    {
+        JSONCONS_ASSERT(state_ == json_parse_state::expect_member_name_or_end ||
+                        state_ == json_parse_state::expect_value_or_end);
+
+        const char_type* p = input_ptr_;
+        const char_type* local_input_end = end_input_;
+        while (p != local_input_end)
+        {
+            switch (skip_state_)
+            {
+                case skip_state::value:
+                    p = jsoncons::detail::find_bracket_special(p, local_input_end);
+                    if (p == local_input_end)
+                    {
+                        break;
+                    }
+                    switch (*p)
+                    {
+                        case '{':
+                        case '[':
+                            ++skip_depth_;
+                            break;
+                        case '}':
+                        case ']':
+                            if (skip_depth_ == 0)
+                            {
+                                skip_to(p);
+                                skip_state_ = skip_state::value;
+                                skip_cr_ = false;
+                                state_ = json_parse_state::expect_comma_or_end;
+                                return true;
+                            }
+                            --skip_depth_;
+                            break;
+                        case '\"':
+                            skip_state_ = skip_state::string;
+                            break;
+                        case '/':
+                            skip_state_ = skip_state::slash;
+                            break;
+                        case '\r':
+                        case '\n':
+                            skip_line_break(p);
+                            break;
+                        default:
+                            break;
+                    }
+                    ++p;
+                    break;
+                case skip_state::string:
+                    p = jsoncons::detail::find_string_special(p, local_input_end);
+                    if (p != local_input_end)
+                    {
+                        switch (*p)
+                        {
+                            case '\"':
+                                skip_state_ = skip_state::value;
+                                break;
+                            case '\\':
+                                skip_state_ = skip_state::escape;
+                                break;
+                            default:
+                                skip_line_break(p);
+                                break;
+                        }
+                        ++p;
+                    }
+                    break;
+                case skip_state::escape:
+                    skip_state_ = skip_state::string;
+                    ++p;
+                    break;
+                case skip_state::slash:
+                    switch (*p)
+                    {
+                        case '/':
+                            skip_state_ = skip_state::line_comment;
+                            ++p;
+                            break;
+                        case '*':
+                            skip_state_ = skip_state::block_comment;
+                            ++p;
+                            break;
+                        default:
+                            skip_state_ = skip_state::value;
+                            break;
+                    }
+                    break;
+                case skip_state::line_comment:
+                    switch (*p)
+                    {
+                        case '\r':
+                        case '\n':
+                            skip_state_ = skip_state::value;
+                            break;
+                        default:
+                            ++p;
+                            break;
+                    }
+                    break;
+                case skip_state::block_comment:
+                case skip_state::block_comment_star:
+                    switch (*p)
+                    {
+                        case '*':
+                            skip_state_ = skip_state::block_comment_star;
+                            break;
+                        case '/':
+                            skip_state_ = skip_state_ == skip_state::block_comment_star ? skip_state::value : skip_state::block_comment;
+                            break;
+                        case '\r':
+                        case '\n':
+                            skip_line_break(p);
+                            skip_state_ = skip_state::block_comment;
+                            break;
+                        default:
+                            skip_state_ = skip_state::block_comment;
+                            break;
+                    }
+                    ++p;
+                    break;
+            }
+        }
+        skip_cr_ = p != input_ptr_ ? *(p-1) == '\r' : skip_cr_;
+        skip_to(p);
+        return false;
+    }
+
     void parse_some(basic_json_visitor<char_type>& visitor)
     {
         std::error_code ec;
@@ -1747,6 +1896,11 @@ public:
 
     void parse_number(basic_json_visitor<char_type>& visitor, std::error_code& ec)
     {
+        if (string_buffer_.size() == 1 && parse_number_in_buffer(visitor, ec))
+        {
+            return;
+        }
+
         const char_type* local_input_end = end_input_;
 
         switch (state_)
@@ -1842,7 +1996,7 @@ zero:
                 state_ = json_parse_state::expect_comma_or_end;
                 return;
             case '.':
-                string_buffer_.push_back(to_double_.get_decimal_point());
+                string_buffer_.push_back('.');
                 ++input_ptr_;
                 ++position_;
                 goto fraction1;
@@ -1925,7 +2079,7 @@ integer:
                 ++position_;
                 goto integer;
             case '.':
-                string_buffer_.push_back(to_double_.get_decimal_point());
+                string_buffer_.push_back('.');
                 ++input_ptr_;
                 ++position_;
                 goto fraction1;
@@ -2200,6 +2354,11 @@ exp3:
 string_u1:
         while (input_ptr_ < local_input_end)
         {
+            input_ptr_ = jsoncons::detail::find_string_special(input_ptr_, local_input_end);
+            if (input_ptr_ == local_input_end)
+            {
+                break;
+            }
             switch (*input_ptr_)
             {
                 JSONCONS_ILLEGAL_CONTROL_CHARACTER:
@@ -2678,6 +2837,174 @@ escape_u8:
     }
 private:
 
+    // A line break in skipped text, a line feed following a carriage return
+    // was counted with the carriage return
+    void skip_line_break(const char_type* p)
+    {
+        if (*p == '\n' && (p != input_ptr_ ? *(p-1) == '\r' : skip_cr_))
+        {
+            return;
+        }
+        ++line_;
+        mark_position_ = position_ + static_cast<std::size_t>(p - input_ptr_) + 1;
+    }
+
+    void skip_to(const char_type* p)
+    {
+        position_ += static_cast<std::size_t>(p - input_ptr_);
+        input_ptr_ = p;
+    }
+
+    static bool is_digit(char_type c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    // Parses a number that ends within the current buffer in one pass over
+    // its characters, accumulating integers as it goes. string_buffer_ holds
+    // the sign or first digit. Returns false, having consumed nothing, if the
+    // number runs to the end of the buffer, isn't well formed or isn't followed
+    // by a delimiter, leaving those cases to the state machine.
+    bool parse_number_in_buffer(basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    {
+        const char_type* p = input_ptr_;
+        const char_type* local_input_end = end_input_;
+        const bool negative = string_buffer_[0] == '-';
+
+        char_type first = string_buffer_[0];
+        if (negative)
+        {
+            if (p == local_input_end || !is_digit(*p))
+            {
+                return false;
+            }
+            first = *p++;
+        }
+        const char_type* digits = p;
+        uint64_t mantissa = static_cast<uint64_t>(first - '0');
+        if (first == '0')
+        {
+            if (p != local_input_end && is_digit(*p))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            while (p != local_input_end && is_digit(*p))
+            {
+                mantissa = mantissa*10 + static_cast<uint64_t>(*p - '0');
+                ++p;
+            }
+        }
+        // Integers of up to 18 digits can't overflow the mantissa
+        const bool is_long_integer = (p - digits) >= 18;
+        bool is_fraction = false;
+        if (p != local_input_end && *p == '.')
+        {
+            ++p;
+            if (p == local_input_end || !is_digit(*p))
+            {
+                return false;
+            }
+            while (p != local_input_end && is_digit(*p))
+            {
+                ++p;
+            }
+            is_fraction = true;
+        }
+        if (p != local_input_end && (*p == 'e' || *p == 'E'))
+        {
+            ++p;
+            if (p != local_input_end && (*p == '+' || *p == '-'))
+            {
+                ++p;
+            }
+            if (p == local_input_end || !is_digit(*p))
+            {
+                return false;
+            }
+            while (p != local_input_end && is_digit(*p))
+            {
+                ++p;
+            }
+            is_fraction = true;
+        }
+        if (p == local_input_end)
+        {
+            return false;
+        }
+        switch (*p)
+        {
+            case ',': case ']': case '}': case ' ': case '\t': case '\r': case '\n':
+                break;
+            default:
+                return false;
+        }
+
+        if (is_fraction || is_long_integer)
+        {
+            string_buffer_.append(input_ptr_, p);
+        }
+        position_ += (p - input_ptr_);
+        input_ptr_ = p;
+
+        if (is_fraction)
+        {
+            end_fraction_value(visitor, ec);
+        }
+        else if (is_long_integer)
+        {
+            end_integer_value(visitor, ec);
+        }
+        else
+        {
+            if (negative)
+            {
+                more_ = visitor.int64_value(-static_cast<int64_t>(mantissa), semantic_tag::none, *this, ec);
+            }
+            else
+            {
+                more_ = visitor.uint64_value(mantissa, semantic_tag::none, *this, ec);
+            }
+            after_value(ec);
+        }
+        if (ec) return true;
+
+        // The delimiter is handled as in parse_number
+        switch (*input_ptr_)
+        {
+            case '\r':
+                ++input_ptr_;
+                ++position_;
+                push_state(state_);
+                state_ = json_parse_state::cr;
+                break;
+            case '\n':
+                ++input_ptr_;
+                ++line_;
+                ++position_;
+                mark_position_ = position_;
+                break;
+            case ' ':case '\t':
+                skip_space();
+                break;
+            case '}':
+            case ']':
+                state_ = json_parse_state::expect_comma_or_end;
+                break;
+            case ',':
+                begin_member_or_element(ec);
+                if (ec) return true;
+                ++input_ptr_;
+                ++position_;
+                break;
+            default:
+                break;
+        }
+        return true;
+    }
+
     void end_integer_value(basic_json_visitor<char_type>& visitor, std::error_code& ec)
     {
         if (string_buffer_[0] == '-')
@@ -7,7 +7,10 @@
 #ifndef JSONCONS_JSON_TRAITS_MACROS_HPP
 #define JSONCONS_JSON_TRAITS_MACROS_HPP
 
-#include <algorithm> // std::swap
+#include <algorithm> // std::swap, std::sort
+#include <array>
+#include <bitset>
+#include <cstdint>
 #include <iterator> // std::iterator_traits, std::input_iterator_tag
 #include <jsoncons/config/jsoncons_config.hpp> // JSONCONS_EXPAND, JSONCONS_QUOTE
 #include <jsoncons/traits_extension.hpp>
@@ -17,6 +20,9 @@
 #include <type_traits> // std::enable_if
 #include <utility>
 #include <jsoncons/json_type_traits.hpp>
+#include <jsoncons/json_object.hpp>
+#include <jsoncons/decode_traits.hpp>
+#include <jsoncons/encode_traits.hpp>
 
 namespace jsoncons
 {
@@ -52,23 +58,43 @@ namespace jsoncons
         using string_view_type = typename Json::string_view_type; 
 
         template <class OutputType> 
-        static void set_udt_member(const Json&, const string_view_type&, const OutputType&) 
+        static void set_udt_member(const Json&, const string_view_type&, const OutputType&)
         { 
         } 
         template <class OutputType> 
-        static void set_udt_member(const Json& j, const string_view_type& key, OutputType& val) 
+        static void set_udt_member(const Json& j, const string_view_type& key, OutputType& val)
+        {
+            val = j.at(key).template as<OutputType>();
+        }
+
+        template <class T, class From, class OutputType>
+        static void set_udt_member(const Json&, const string_view_type&, From, const OutputType&)
+        {
+        }
+        template <class T, class From, class OutputType>
+        static void set_udt_member(const Json& j, const string_view_type& key, From from, OutputType& val)
+        {
+            val = from(j.at(key).template as<T>());
+        }
+
+        template <class OutputType>
+        static void set_udt_member_value(const Json&, const OutputType&)
+        {
+        }
+        template <class OutputType>
+        static void set_udt_member_value(const Json& value, OutputType& val)
         { 
-            val = j.at(key).template as<OutputType>(); 
+            val = value.template as<OutputType>();
         } 
 
         template <class T, class From, class OutputType> 
-        static void set_udt_member(const Json&, const string_view_type&, From, const OutputType&) 
+        static void set_udt_member_value(const Json&, From, const OutputType&)
         { 
         } 
         template <class T, class From, class OutputType> 
-        static void set_udt_member(const Json& j, const string_view_type& key, From from, OutputType& val) 
+        static void set_udt_member_value(const Json& value, From from, OutputType& val)
         { 
-            val = from(j.at(key).template as<T>()); 
+            val = from(value.template as<T>());
         } 
         template <class U> 
         static void set_optional_json_member(const string_view_type& key, const std::shared_ptr<U>& val, Json& j) 
@@ -91,6 +117,184 @@ namespace jsoncons
             j.try_emplace(key, val); 
         } 
     };
+
+    template <class Object>
+    struct is_sorted_json_object : std::false_type
+    {};
+
+    template <class KeyT,class Json,template<typename,typename> class SequenceContainer>
+    struct is_sorted_json_object<sorted_json_object<KeyT,Json,SequenceContainer>> : std::true_type
+    {};
+
+    // Maps a member name to its index in the declared members with one hash
+    // and at most one string compare. The hash looks at the length and the
+    // first, middle and last characters, and the seed is chosen when the
+    // table is built so that the declared names land in distinct slots.
+    // Names that can't be separated that way share a probe sequence.
+
+    template <class CharT,std::size_t N>
+    class json_traits_member_index
+    {
+    public:
+        using string_view_type = jsoncons::basic_string_view<CharT>;
+    private:
+        static constexpr std::size_t table_size(std::size_t n, std::size_t size = 2)
+        {
+            return size >= n ? size : table_size(n, size*2);
+        }
+        static constexpr std::size_t capacity = table_size(2*N);
+        static constexpr uint32_t max_seed = 64;
+
+        std::array<string_view_type,N> names_;
+        std::array<std::size_t,capacity> slots_; // index+1, or 0 if empty
+        uint32_t seed_;
+    public:
+        json_traits_member_index(const std::array<string_view_type,N>& names)
+            : names_(names), seed_(0)
+        {
+            std::size_t fewest = (std::numeric_limits<std::size_t>::max)();
+            for (uint32_t seed = 0; seed < max_seed && fewest > 0; ++seed)
+            {
+                std::size_t collisions = build(seed);
+                if (collisions < fewest)
+                {
+                    fewest = collisions;
+                    seed_ = seed;
+                }
+            }
+            build(seed_);
+        }
+
+        const std::array<string_view_type,N>& names() const
+        {
+            return names_;
+        }
+
+        // Returns N if name is not one of the declared names
+        std::size_t find(const string_view_type& name) const noexcept
+        {
+            std::size_t slot = hash(name, seed_);
+            while (slots_[slot] != 0)
+            {
+                std::size_t i = slots_[slot] - 1;
+                if (names_[i].size() == name.size() && names_[i] == name)
+                {
+                    return i;
+                }
+                slot = (slot + 1) & (capacity - 1);
+            }
+            return N;
+        }
+    private:
+        static std::size_t hash(const string_view_type& name, uint32_t seed) noexcept
+        {
+            using uchar_type = typename std::make_unsigned<CharT>::type;
+
+            uint32_t h = static_cast<uint32_t>(name.size());
+            if (!name.empty())
+            {
+                h = h*31 + static_cast<uchar_type>(name[0]);
+                h = h*31 + static_cast<uchar_type>(name[name.size()/2]);
+                h = h*31 + static_cast<uchar_type>(name[name.size()-1]);
+            }
+            h = (h ^ seed) * 2654435761u;
+            return static_cast<std::size_t>(h ^ (h >> 16)) & (capacity - 1);
+        }
+
+        // Returns the number of names that didn't get their own slot
+        std::size_t build(uint32_t seed) noexcept
+        {
+            slots_.fill(0);
+            std::size_t collisions = 0;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                std::size_t slot = hash(names_[i], seed);
+                if (slots_[slot] != 0)
+                {
+                    ++collisions;
+                    while (slots_[slot] != 0)
+                    {
+                        slot = (slot + 1) & (capacity - 1);
+                    }
+                }
+                slots_[slot] = i + 1;
+            }
+            return collisions;
+        }
+    };
+
+    template <class CharT,std::size_t N>
+    constexpr std::size_t json_traits_member_index<CharT,N>::capacity;
+
+    // Reads and writes members for the decode_traits and encode_traits
+    // that the member traits macros generate
+
+    template <class CharT>
+    struct json_traits_stream_helper
+    {
+        using string_view_type = jsoncons::basic_string_view<CharT>;
+
+        template <class T, class Json, class TempAllocator>
+        static void decode_member(basic_staj_cursor<CharT>& cursor, json_decoder<Json,TempAllocator>& decoder,
+                                  T& val, std::error_code& ec)
+        {
+            val = decode_traits<T,CharT>::decode(cursor, decoder, ec);
+        }
+        template <class T, class Json, class TempAllocator>
+        static void decode_member(basic_staj_cursor<CharT>& cursor, json_decoder<Json,TempAllocator>&,
+                                  const T&, std::error_code& ec)
+        {
+            cursor.skip(ec);
+        }
+
+        template <class T, class Json>
+        static void encode_member(const string_view_type& key, const T& val,
+                                  basic_json_visitor<CharT>& encoder, const Json& proto, std::error_code& ec)
+        {
+            encoder.key(key, ser_context(), ec);
+            if (ec) return;
+            encode_traits<T,CharT>::encode(val, encoder, proto, ec);
+        }
+
+        // Whether to_json would add a non-mandatory member, see json_traits_helper::set_optional_json_member
+        template <class U>
+        static bool is_optional_member_set(const std::shared_ptr<U>& val)
+        {
+            return val ? true : false;
+        }
+        template <class U>
+        static bool is_optional_member_set(const std::unique_ptr<U>& val)
+        {
+            return val ? true : false;
+        }
+        template <class U>
+        static bool is_optional_member_set(const jsoncons::optional<U>& val)
+        {
+            return val.has_value();
+        }
+        template <class U>
+        static bool is_optional_member_set(const U&)
+        {
+            return true;
+        }
+
+        // The order in which an object of type Json holds the members, by index
+        template <class Json, std::size_t N>
+        static std::array<std::size_t,N> member_order(const std::array<string_view_type,N>& names)
+        {
+            std::array<std::size_t,N> order;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                order[i] = i;
+            }
+            if (is_sorted_json_object<typename Json::object>::value)
+            {
+                std::sort(order.begin(), order.end(),
+                          [&names](std::size_t a, std::size_t b){return names[a] < names[b];});
+            }
+            return order;
+        }
+    };
 }
 
 #if defined(_MSC_VER)
@@ -263,12 +467,12 @@ namespace jsoncons
 
 #define JSONCONS_N_MEMBER_AS(Prefix,P2,P3, Member, Count) JSONCONS_N_MEMBER_AS_LAST(Prefix,P2,P3, Member, Count)
 #define JSONCONS_N_MEMBER_AS_LAST(Prefix,P2,P3, Member, Count) \
-    if ((num_params-Count) < num_mandatory_params2 || ajson.contains(json_traits_macro_names<char_type,value_type>::Member##_str(char_type{}))) \
-        {json_traits_helper<Json>::set_udt_member(ajson,json_traits_macro_names<char_type,value_type>::Member##_str(char_type{}),aval.Member);}
+    if (amembers[num_params-Count]) \
+        {json_traits_helper<Json>::set_udt_member_value(*amembers[num_params-Count],aval.Member);}
 
 #define JSONCONS_ALL_MEMBER_AS(Prefix, P2,P3,Member, Count) JSONCONS_ALL_MEMBER_AS_LAST(Prefix,P2,P3, Member, Count)
 #define JSONCONS_ALL_MEMBER_AS_LAST(Prefix,P2,P3, Member, Count) \
-    json_traits_helper<Json>::set_udt_member(ajson,json_traits_macro_names<char_type,value_type>::Member##_str(char_type{}),aval.Member);
+    json_traits_helper<Json>::set_udt_member_value(*amembers[num_params-Count],aval.Member);
 
 #define JSONCONS_TO_JSON(Prefix, P2, P3, Member, Count) JSONCONS_TO_JSON_LAST(Prefix, P2, P3, Member, Count)
 #define JSONCONS_TO_JSON_LAST(Prefix, P2, P3, Member, Count) if ((num_params-Count) < num_mandatory_params2) \
@@ -279,6 +483,31 @@ namespace jsoncons
 #define JSONCONS_ALL_TO_JSON_LAST(Prefix, P2, P3, Member, Count) \
     ajson.try_emplace(json_traits_macro_names<char_type,value_type>::Member##_str(char_type{}), aval.Member);
 
+#define JSONCONS_MEMBER_NAME_VIEW(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_NAME_VIEW_LAST(Prefix, P2, P3, Member, Count)
+#define JSONCONS_MEMBER_NAME_VIEW_LAST(Prefix, P2, P3, Member, Count) string_view_type(json_traits_macro_names<char_type,value_type>::Member##_str(char_type{})),
+
+#define JSONCONS_MEMBER_DECODE(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_DECODE_LAST(Prefix, P2, P3, Member, Count)
+#define JSONCONS_MEMBER_DECODE_LAST(Prefix, P2, P3, Member, Count) \
+    case num_params-Count: \
+        cursor.next(ec); \
+        if (ec) return aval; \
+        json_traits_stream_helper<char_type>::decode_member(cursor, decoder, aval.Member, ec); \
+        found.set(num_params-Count); \
+        break;
+
+#define JSONCONS_MEMBER_COUNT(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_COUNT_LAST(Prefix, P2, P3, Member, Count)
+#define JSONCONS_MEMBER_COUNT_LAST(Prefix, P2, P3, Member, Count) \
+    if ((num_params-Count) < num_mandatory_params2 || json_traits_stream_helper<char_type>::is_optional_member_set(aval.Member)) ++count;
+
+#define JSONCONS_MEMBER_ENCODE(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_ENCODE_LAST(Prefix, P2, P3, Member, Count)
+#define JSONCONS_MEMBER_ENCODE_LAST(Prefix, P2, P3, Member, Count) \
+    case num_params-Count: \
+        if ((num_params-Count) < num_mandatory_params2 || json_traits_stream_helper<char_type>::is_optional_member_set(aval.Member)) \
+        { \
+            json_traits_stream_helper<char_type>::encode_member(json_traits_macro_names<char_type,value_type>::Member##_str(char_type{}), aval.Member, encoder, proto, ec); \
+        } \
+        break;
+
 #define JSONCONS_MEMBER_TRAITS_BASE(AsT,ToJ,NumTemplateParams,ValueType,NumMandatoryParams1,NumMandatoryParams2, ...)  \
 namespace jsoncons \
 { \
@@ -297,15 +526,37 @@ namespace jsoncons \
         constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
         constexpr static size_t num_mandatory_params1 = NumMandatoryParams1; \
         constexpr static size_t num_mandatory_params2 = NumMandatoryParams2; \
-        static bool is(const Json& ajson) noexcept \
+        static const json_traits_member_index<char_type,num_params>& member_index() \
         { \
+            static const json_traits_member_index<char_type,num_params> aindex( \
+                std::array<string_view_type,num_params>{{JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_NAME_VIEW, ,,, __VA_ARGS__)}}); \
+            return aindex; \
+        } \
+        static bool find_members(const Json& ajson, std::array<const Json*,num_params>& amembers) noexcept \
+        { \
+            amembers.fill(nullptr); \
             if (!ajson.is_object()) return false; \
-            JSONCONS_VARIADIC_REP_N(JSONCONS_N_MEMBER_IS, ,,, __VA_ARGS__)\
+            const auto& aindex = member_index(); \
+            for (const auto& kv : ajson.object_range()) \
+            { \
+                std::size_t i = aindex.find(kv.key()); \
+                if (i < num_params) amembers[i] = std::addressof(kv.value()); \
+            } \
+            for (std::size_t i = 0; i < num_mandatory_params1; ++i) \
+            { \
+                if (!amembers[i]) return false; \
+            } \
             return true; \
         } \
+        static bool is(const Json& ajson) noexcept \
+        { \
+            std::array<const Json*,num_params> amembers; \
+            return find_members(ajson, amembers); \
+        } \
         static value_type as(const Json& ajson) \
         { \
-            if (!is(ajson)) JSONCONS_THROW(conv_error(conv_errc::conversion_failed, "Not a " # ValueType)); \
+            std::array<const Json*,num_params> amembers; \
+            if (!find_members(ajson, amembers)) JSONCONS_THROW(conv_error(conv_errc::conversion_failed, "Not a " # ValueType)); \
             value_type aval{}; \
             JSONCONS_VARIADIC_REP_N(AsT, ,,, __VA_ARGS__) \
             return aval; \
@@ -316,63 +567,178 @@ namespace jsoncons \
             JSONCONS_VARIADIC_REP_N(ToJ, ,,, __VA_ARGS__) \
             return ajson; \
         } \
+        template <class TempAllocator> \
+        static value_type decode(basic_staj_cursor<char_type>& cursor, \
+                                 json_decoder<Json,TempAllocator>& decoder, \
+                                 std::error_code& ec) \
+        { \
+            value_type aval{}; \
+            if (cursor.current().event_type() != staj_event_type::begin_object) \
+            { \
+                ec = conv_errc::conversion_failed; \
+                return aval; \
+            } \
+            const auto& aindex = member_index(); \
+            std::bitset<num_params> found; \
+            cursor.next(ec); \
+            while (!ec && cursor.current().event_type() != staj_event_type::end_object) \
+            { \
+                if (cursor.current().event_type() != staj_event_type::key) \
+                { \
+                    ec = json_errc::expected_key; \
+                    return aval; \
+                } \
+                auto key = cursor.current().template get<string_view_type>(ec); \
+                if (ec) return aval; \
+                switch (aindex.find(key)) \
+                { \
+                    JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_DECODE, ,,, __VA_ARGS__) \
+                    default: \
+                        cursor.next(ec); \
+                        if (ec) return aval; \
+                        cursor.skip(ec); \
+                        break; \
+                } \
+                if (ec) return aval; \
+                cursor.next(ec); \
+            } \
+            for (std::size_t i = 0; !ec && i < num_mandatory_params1; ++i) \
+            { \
+                if (!found[i]) \
+                { \
+                    ec = conv_errc::conversion_failed; \
+                } \
+            } \
+            return aval; \
+        } \
+        static void encode(const value_type& aval, \
+                           basic_json_visitor<char_type>& encoder, \
+                           const Json& proto, \
+                           std::error_code& ec) \
+        { \
+            static const std::array<std::size_t,num_params> order = json_traits_stream_helper<char_type>::template member_order<Json>(member_index().names()); \
+            std::size_t count = 0; \
+            JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_COUNT, ,,, __VA_ARGS__) \
+            encoder.begin_object(count, semantic_tag::none, ser_context(), ec); \
+            for (std::size_t i = 0; !ec && i < num_params; ++i) \
+            { \
+                switch (order[i]) \
+                { \
+                    JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_ENCODE, ,,, __VA_ARGS__) \
+                    default: \
+                        break; \
+                } \
+            } \
+            if (ec) return; \
+            encoder.end_object(ser_context(), ec); \
+        } \
+    }; \
+} \
+  /**/
+
+// decode_traits and encode_traits that read members from a cursor and write them
+// to a visitor directly, without going through a basic_json value. They forward
+// to json_type_traits, which JSONCONS_TYPE_TRAITS_FRIEND gives access to private members.
+
+#define JSONCONS_MEMBER_STREAM_TRAITS(NumTemplateParams,ValueType)  \
+namespace jsoncons \
+{ \
+    template<typename ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct decode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams), ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        template <class Json,class TempAllocator> \
+        static value_type decode(basic_staj_cursor<ChT>& cursor, \
+                                 json_decoder<Json,TempAllocator>& decoder, \
+                                 std::error_code& ec) \
+        { \
+            return json_type_traits<Json,value_type>::decode(cursor, decoder, ec); \
+        } \
+    }; \
+    template<typename ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct encode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams), ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        template <class Json> \
+        static void encode(const value_type& val, \
+                           basic_json_visitor<ChT>& encoder, \
+                           const Json& proto, \
+                           std::error_code& ec) \
+        { \
+            json_type_traits<Json,value_type>::encode(val, encoder, proto, ec); \
+        } \
     }; \
 } \
   /**/
 
 #define JSONCONS_N_MEMBER_TRAITS(ValueType,NumMandatoryParams,...)  \
     JSONCONS_MEMBER_TRAITS_BASE(JSONCONS_N_MEMBER_AS, JSONCONS_TO_JSON,0, ValueType,NumMandatoryParams,NumMandatoryParams, __VA_ARGS__) \
+    JSONCONS_MEMBER_STREAM_TRAITS(0, ValueType) \
     namespace jsoncons { template <> struct is_json_type_traits_declared<ValueType> : public std::true_type {}; } \
   /**/
 
 #define JSONCONS_TPL_N_MEMBER_TRAITS(NumTemplateParams, ValueType,NumMandatoryParams, ...)  \
     JSONCONS_MEMBER_TRAITS_BASE(JSONCONS_N_MEMBER_AS, JSONCONS_TO_JSON,NumTemplateParams, ValueType,NumMandatoryParams,NumMandatoryParams, __VA_ARGS__) \
+    JSONCONS_MEMBER_STREAM_TRAITS(NumTemplateParams, ValueType) \
     namespace jsoncons { template <JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_TPL_PARAM, NumTemplateParams)> struct is_json_type_traits_declared<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams)> : public std::true_type {}; } \
   /**/
 
 #define JSONCONS_ALL_MEMBER_TRAITS(ValueType, ...)  \
     JSONCONS_MEMBER_TRAITS_BASE(JSONCONS_ALL_MEMBER_AS,JSONCONS_ALL_TO_JSON,0,ValueType, JSONCONS_NARGS(__VA_ARGS__), JSONCONS_NARGS(__VA_ARGS__),__VA_ARGS__) \
+    JSONCONS_MEMBER_STREAM_TRAITS(0, ValueType) \
     namespace jsoncons { template <> struct is_json_type_traits_declared<ValueType> : public std::true_type {}; } \
   /**/
 
 #define JSONCONS_TPL_ALL_MEMBER_TRAITS(NumTemplateParams, ValueType, ...)  \
     JSONCONS_MEMBER_TRAITS_BASE(JSONCONS_ALL_MEMBER_AS,JSONCONS_ALL_TO_JSON,NumTemplateParams,ValueType, JSONCONS_NARGS(__VA_ARGS__), JSONCONS_NARGS(__VA_ARGS__),__VA_ARGS__) \
+    JSONCONS_MEMBER_STREAM_TRAITS(NumTemplateParams, ValueType) \
     namespace jsoncons { template <JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_TPL_PARAM, NumTemplateParams)> struct is_json_type_traits_declared<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams)> : public std::true_type {}; } \
   /**/ 
 
 #define JSONCONS_MEMBER_NAME_IS(P1, P2, P3, Seq, Count) JSONCONS_MEMBER_NAME_IS_LAST(P1, P2, P3, Seq, Count)
-#define JSONCONS_MEMBER_NAME_IS_LAST(P1, P2, P3, Seq, Count) if ((num_params-Count) < num_mandatory_params1 && JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_MEMBER_NAME_IS_,JSONCONS_NARGS Seq) Seq)
-#define JSONCONS_MEMBER_NAME_IS_2(Member, Name) !ajson.contains(Name)) return false;
+#define JSONCONS_MEMBER_NAME_IS_LAST(P1, P2, P3, Seq, Count) \
+    { \
+        const Json* amember = amembers[num_params-Count]; \
+        if (!amember && (num_params-Count) < num_mandatory_params1) return false; \
+        JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_MEMBER_NAME_IS_,JSONCONS_NARGS Seq) Seq) \
+    }
+#define JSONCONS_MEMBER_NAME_IS_2(Member, Name)
 #define JSONCONS_MEMBER_NAME_IS_3(Member, Name, Mode) JSONCONS_MEMBER_NAME_IS_2(Member, Name)
 #define JSONCONS_MEMBER_NAME_IS_4(Member, Name, Mode, Match) JSONCONS_MEMBER_NAME_IS_6(Member, Name, Mode, Match, , )
 #define JSONCONS_MEMBER_NAME_IS_5(Member, Name, Mode, Match, Into) JSONCONS_MEMBER_NAME_IS_6(Member, Name, Mode, Match, Into, )
-#define JSONCONS_MEMBER_NAME_IS_6(Member, Name, Mode, Match, Into, From) !ajson.contains(Name)) return false; \
-    JSONCONS_TRY{if (!Match(ajson.at(Name).template as<typename std::decay<decltype(Into((std::declval<value_type*>())->Member))>::type>())) return false;} \
-    JSONCONS_CATCH(...) {return false;}
+#define JSONCONS_MEMBER_NAME_IS_6(Member, Name, Mode, Match, Into, From) if (amember) \
+    { \
+        JSONCONS_TRY{if (!Match(amember->template as<typename std::decay<decltype(Into((std::declval<value_type*>())->Member))>::type>())) return false;} \
+        JSONCONS_CATCH(...) {return false;} \
+    }
+
+#define JSONCONS_MEMBER_NAME_NAME_VIEW(P1, P2, P3, Seq, Count) JSONCONS_MEMBER_NAME_NAME_VIEW_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_MEMBER_NAME_NAME_VIEW_LAST(P1, P2, P3, Seq, Count) string_view_type(JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_MEMBER_NAME_NAME_VIEW_,JSONCONS_NARGS Seq) Seq)),
+#define JSONCONS_MEMBER_NAME_NAME_VIEW_2(Member, Name) Name
+#define JSONCONS_MEMBER_NAME_NAME_VIEW_3(Member, Name, Mode) Name
+#define JSONCONS_MEMBER_NAME_NAME_VIEW_4(Member, Name, Mode, Match) Name
+#define JSONCONS_MEMBER_NAME_NAME_VIEW_5(Member, Name, Mode, Match, Into) Name
+#define JSONCONS_MEMBER_NAME_NAME_VIEW_6(Member, Name, Mode, Match, Into, From) Name
 
 #define JSONCONS_N_MEMBER_NAME_AS(P1, P2, P3, Seq, Count) JSONCONS_N_MEMBER_NAME_AS_LAST(P1, P2, P3, Seq, Count)
-#define JSONCONS_N_MEMBER_NAME_AS_LAST(P1, P2, P3, Seq, Count) JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_N_MEMBER_NAME_AS_,JSONCONS_NARGS Seq) Seq)
+#define JSONCONS_N_MEMBER_NAME_AS_LAST(P1, P2, P3, Seq, Count) \
+    if (const Json* amember = amembers[num_params-Count]) \
+    { \
+        JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_N_MEMBER_NAME_AS_,JSONCONS_NARGS Seq) Seq) \
+    }
 #define JSONCONS_N_MEMBER_NAME_AS_2(Member, Name) \
-    if (ajson.contains(Name)) {json_traits_helper<Json>::set_udt_member(ajson,Name,aval.Member);}
+    json_traits_helper<Json>::set_udt_member_value(*amember,aval.Member);
 #define JSONCONS_N_MEMBER_NAME_AS_3(Member, Name, Mode) Mode(JSONCONS_N_MEMBER_NAME_AS_2(Member, Name))
 #define JSONCONS_N_MEMBER_NAME_AS_4(Member, Name, Mode, Match) \
-    Mode(if (ajson.contains(Name)) {json_traits_helper<Json>::set_udt_member(ajson,Name,aval.Member);})
+    Mode(json_traits_helper<Json>::set_udt_member_value(*amember,aval.Member);)
 #define JSONCONS_N_MEMBER_NAME_AS_5(Member, Name, Mode, Match, Into) \
-    Mode(if (ajson.contains(Name)) {json_traits_helper<Json>::template set_udt_member<typename std::decay<decltype(Into((std::declval<value_type*>())->Member))>::type>(ajson,Name,aval.Member);})
+    Mode(json_traits_helper<Json>::template set_udt_member_value<typename std::decay<decltype(Into((std::declval<value_type*>())->Member))>::type>(*amember,aval.Member);)
 #define JSONCONS_N_MEMBER_NAME_AS_6(Member, Name, Mode, Match, Into, From) \
-    Mode(if (ajson.contains(Name)) {json_traits_helper<Json>::template set_udt_member<typename std::decay<decltype(Into((std::declval<value_type*>())->Member))>::type>(ajson,Name,From,aval.Member);})
-
-#define JSONCONS_ALL_MEMBER_NAME_AS(P1, P2, P3, Seq, Count) JSONCONS_ALL_MEMBER_NAME_AS_LAST(P1, P2, P3, Seq, Count)
-#define JSONCONS_ALL_MEMBER_NAME_AS_LAST(P1, P2, P3, Seq, Count) JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_ALL_MEMBER_NAME_AS_,JSONCONS_NARGS Seq) Seq)
-#define JSONCONS_ALL_MEMBER_NAME_AS_2(Member, Name) \
-    json_traits_helper<Json>::set_udt_member(ajson,Name,aval.Member);
-#define JSONCONS_ALL_MEMBER_NAME_AS_3(Member, Name, Mode) Mode(JSONCONS_ALL_MEMBER_NAME_AS_2(Member, Name))
-#define JSONCONS_ALL_MEMBER_NAME_AS_4(Member, Name, Mode, Match) \
-    Mode(json_traits_helper<Json>::set_udt_member(ajson,Name,aval.Member);)
-#define JSONCONS_ALL_MEMBER_NAME_AS_5(Member, Name, Mode, Match, Into) \
-    Mode(json_traits_helper<Json>::template set_udt_member<typename std::decay<decltype(Into((std::declval<value_type*>())->Member))>::type>(ajson,Name,aval.Member);)
-#define JSONCONS_ALL_MEMBER_NAME_AS_6(Member, Name, Mode, Match, Into, From) \
-    Mode(json_traits_helper<Json>::template set_udt_member<typename std::decay<decltype(Into((std::declval<value_type*>())->Member))>::type>(ajson,Name,From,aval.Member);)
+    Mode(json_traits_helper<Json>::template set_udt_member_value<typename std::decay<decltype(Into((std::declval<value_type*>())->Member))>::type>(*amember,From,aval.Member);)
+
+// All members are present once find_members has succeeded
+#define JSONCONS_ALL_MEMBER_NAME_AS(P1, P2, P3, Seq, Count) JSONCONS_N_MEMBER_NAME_AS_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_ALL_MEMBER_NAME_AS_LAST(P1, P2, P3, Seq, Count) JSONCONS_N_MEMBER_NAME_AS_LAST(P1, P2, P3, Seq, Count)
 
 #define JSONCONS_N_MEMBER_NAME_TO_JSON(P1, P2, P3, Seq, Count) JSONCONS_N_MEMBER_NAME_TO_JSON_LAST(P1, P2, P3, Seq, Count)
 #define JSONCONS_N_MEMBER_NAME_TO_JSON_LAST(P1, P2, P3, Seq, Count) if ((num_params-Count) < num_mandatory_params2) JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_N_MEMBER_NAME_TO_JSON_,JSONCONS_NARGS Seq) Seq)
@@ -409,15 +775,34 @@ namespace jsoncons \
         constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
         constexpr static size_t num_mandatory_params1 = NumMandatoryParams1; \
         constexpr static size_t num_mandatory_params2 = NumMandatoryParams2; \
-        static bool is(const Json& ajson) noexcept \
+        static const json_traits_member_index<char_type,num_params>& member_index() \
         { \
+            static const json_traits_member_index<char_type,num_params> aindex( \
+                std::array<string_view_type,num_params>{{JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_NAME_NAME_VIEW,,,, __VA_ARGS__)}}); \
+            return aindex; \
+        } \
+        static bool find_members(const Json& ajson, std::array<const Json*,num_params>& amembers) noexcept \
+        { \
+            amembers.fill(nullptr); \
             if (!ajson.is_object()) return false; \
+            const auto& aindex = member_index(); \
+            for (const auto& kv : ajson.object_range()) \
+            { \
+                std::size_t i = aindex.find(kv.key()); \
+                if (i < num_params) amembers[i] = std::addressof(kv.value()); \
+            } \
             JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_NAME_IS,,,, __VA_ARGS__)\
             return true; \
         } \
+        static bool is(const Json& ajson) noexcept \
+        { \
+            std::array<const Json*,num_params> amembers; \
+            return find_members(ajson, amembers); \
+        } \
         static value_type as(const Json& ajson) \
         { \
-            if (!is(ajson)) JSONCONS_THROW(conv_error(conv_errc::conversion_failed, "Not a " # ValueType)); \
+            std::array<const Json*,num_params> amembers; \
+            if (!find_members(ajson, amembers)) JSONCONS_THROW(conv_error(conv_errc::conversion_failed, "Not a " # ValueType)); \
             value_type aval{}; \
             JSONCONS_VARIADIC_REP_N(AsT,,,, __VA_ARGS__) \
             return aval; \
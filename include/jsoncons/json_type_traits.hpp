@@ -1727,7 +1727,7 @@ namespace variant_detail
             {
                 jsoncons::string_view sv = j.as_string_view();
                 null_back_insertable_byte_container cont;
-                auto result = decode_base16(sv.begin(), sv.end(), cont);
+                auto result = decode_base16(sv.data(), sv.data() + sv.size(), cont);
                 return result.ec == conv_errc::success ? true : false;
             }
             return false;
@@ -1752,7 +1752,7 @@ namespace variant_detail
                 else
                 {
                     jsoncons::string_view sv = j.as_string_view();
-                    auto result = decode_base16(sv.begin(), sv.end(), bits);
+                    auto result = decode_base16(sv.data(), sv.data() + sv.size(), bits);
                     if (result.ec != conv_errc::success)
                     {
                         JSONCONS_THROW(conv_error(conv_errc::not_bitset));
@@ -0,0 +1,428 @@
+// Copyright 2022 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_NDJSON_READER_HPP
+#define JSONCONS_NDJSON_READER_HPP
+
+#include <algorithm> // std::find
+#include <cstddef>
+#include <deque>
+#include <exception> // std::current_exception
+#include <functional> // std::function
+#include <future> // std::promise, std::future
+#include <istream> // std::basic_istream
+#include <memory> // std::shared_ptr
+#include <string>
+#include <system_error>
+#include <utility> // std::move
+#include <vector>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/detail/thread_pool.hpp>
+
+namespace jsoncons {
+
+    class ndjson_options
+    {
+        std::size_t num_threads_;
+        std::size_t chunk_size_;
+        std::size_t max_in_flight_bytes_;
+    public:
+        ndjson_options()
+            : num_threads_(0), chunk_size_(1024*1024), max_in_flight_bytes_(64*1024*1024)
+        {
+        }
+
+        // The number of worker threads, 0 means one per hardware thread
+        std::size_t num_threads() const
+        {
+            return num_threads_;
+        }
+
+        ndjson_options& num_threads(std::size_t value)
+        {
+            num_threads_ = value;
+            return *this;
+        }
+
+        // The size of the chunks handed to the workers, a chunk is extended
+        // to the end of the line it would otherwise split
+        std::size_t chunk_size() const
+        {
+            return chunk_size_;
+        }
+
+        ndjson_options& chunk_size(std::size_t value)
+        {
+            chunk_size_ = value == 0 ? 1 : value;
+            return *this;
+        }
+
+        // The most input, in bytes, that is being parsed or waiting to be
+        // delivered at any one time. At least one chunk is always in flight.
+        std::size_t max_in_flight_bytes() const
+        {
+            return max_in_flight_bytes_;
+        }
+
+        ndjson_options& max_in_flight_bytes(std::size_t value)
+        {
+            max_in_flight_bytes_ = value;
+            return *this;
+        }
+    };
+
+    template <class Json>
+    struct ndjson_record
+    {
+        // The line of the record in the input, starting at 1
+        std::size_t line;
+        // The parsed value, null if the record failed to parse
+        Json value;
+        // The parse error, e.g. json_errc::unexpected_eof
+        std::error_code ec;
+        // The column of the parse error
+        std::size_t column;
+    };
+
+    // Parses newline-delimited JSON on a pool of worker threads. The input is
+    // split into chunks at line boundaries, each worker parses the lines of a
+    // chunk into values with its own parser and decoder, and the records are
+    // delivered to the caller, on the calling thread, in input order. Blank
+    // lines are skipped. A line that fails to parse is reported as a record
+    // with an error code and does not stop the reader.
+
+    template <class Json>
+    class ndjson_reader
+    {
+    public:
+        using value_type = Json;
+        using char_type = typename Json::char_type;
+        using string_view_type = jsoncons::basic_string_view<char_type>;
+        using record_type = ndjson_record<Json>;
+    private:
+        struct chunk
+        {
+            string_view_type data;
+            std::shared_ptr<std::basic_string<char_type>> owner;
+        };
+
+        struct chunk_result
+        {
+            std::vector<record_type> records;
+            std::size_t line_count;
+        };
+
+        struct pending_chunk
+        {
+            std::future<chunk_result> result;
+            std::size_t size;
+            std::shared_ptr<std::basic_string<char_type>> owner;
+        };
+
+        class string_chunker
+        {
+            string_view_type input_;
+            std::size_t chunk_size_;
+            std::size_t pos_;
+        public:
+            string_chunker(const string_view_type& input, std::size_t chunk_size)
+                : input_(input), chunk_size_(chunk_size), pos_(0)
+            {
+            }
+
+            bool next(chunk& c)
+            {
+                if (pos_ == input_.size())
+                {
+                    return false;
+                }
+                std::size_t end = (input_.size() - pos_) <= chunk_size_ ? input_.size() : pos_ + chunk_size_;
+                if (end < input_.size() && input_[end-1] != '\n')
+                {
+                    const char_type* p = std::find(input_.data() + end, input_.data() + input_.size(), '\n');
+                    end = (p == input_.data() + input_.size()) ? input_.size() : static_cast<std::size_t>(p - input_.data()) + 1;
+                }
+                c.data = string_view_type(input_.data() + pos_, end - pos_);
+                pos_ = end;
+                return true;
+            }
+        };
+
+        class stream_chunker
+        {
+            std::basic_istream<char_type>& is_;
+            std::size_t chunk_size_;
+            std::basic_string<char_type> carry_;
+            bool eof_;
+        public:
+            stream_chunker(std::basic_istream<char_type>& is, std::size_t chunk_size)
+                : is_(is), chunk_size_(chunk_size), eof_(false)
+            {
+            }
+
+            bool next(chunk& c)
+            {
+                auto buffer = std::make_shared<std::basic_string<char_type>>();
+                buffer->swap(carry_);
+                while (!eof_)
+                {
+                    std::size_t old_size = buffer->size();
+                    buffer->resize(old_size + chunk_size_);
+                    is_.read(&(*buffer)[old_size], static_cast<std::streamsize>(chunk_size_));
+                    std::size_t count = static_cast<std::size_t>(is_.gcount());
+                    buffer->resize(old_size + count);
+                    if (is_.bad())
+                    {
+                        JSONCONS_THROW(ser_error(json_errc::source_error));
+                    }
+                    if (count < chunk_size_)
+                    {
+                        eof_ = true;
+                        break;
+                    }
+                    // Cut the chunk after the last newline in the data just read
+                    std::size_t pos = buffer->size();
+                    while (pos > old_size && (*buffer)[pos-1] != '\n')
+                    {
+                        --pos;
+                    }
+                    if (pos > old_size)
+                    {
+                        carry_.assign(buffer->data() + pos, buffer->size() - pos);
+                        buffer->resize(pos);
+                        break;
+                    }
+                }
+                if (buffer->empty())
+                {
+                    return false;
+                }
+                c.data = string_view_type(buffer->data(), buffer->size());
+                c.owner = std::move(buffer);
+                return true;
+            }
+        };
+
+        ndjson_options options_;
+        basic_json_decode_options<char_type> decode_options_;
+    public:
+        explicit ndjson_reader(const ndjson_options& options = ndjson_options(),
+                               const basic_json_decode_options<char_type>& decode_options = basic_json_decode_options<char_type>())
+            : options_(options), decode_options_(decode_options)
+        {
+        }
+
+        // Calls f with each record in input order, until f returns false.
+        // Returns the number of records delivered.
+        std::size_t read(const string_view_type& input, std::function<bool(record_type&)> f) const
+        {
+            string_chunker chunker(input, options_.chunk_size());
+            return run(chunker, f);
+        }
+
+        std::size_t read(std::basic_istream<char_type>& is, std::function<bool(record_type&)> f) const
+        {
+            stream_chunker chunker(is, options_.chunk_size());
+            return run(chunker, f);
+        }
+
+        // Replays each record's value to visitor in input order, and stops
+        // at the first record that fails to parse
+        void read(const string_view_type& input, basic_json_visitor<char_type>& visitor) const
+        {
+            std::error_code ec;
+            std::size_t line = 0;
+            std::size_t column = 0;
+            string_chunker chunker(input, options_.chunk_size());
+            replay(chunker, visitor, ec, line, column);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec, line, column));
+            }
+        }
+
+        void read(const string_view_type& input, basic_json_visitor<char_type>& visitor, std::error_code& ec) const
+        {
+            std::size_t line = 0;
+            std::size_t column = 0;
+            string_chunker chunker(input, options_.chunk_size());
+            replay(chunker, visitor, ec, line, column);
+        }
+
+        void read(std::basic_istream<char_type>& is, basic_json_visitor<char_type>& visitor) const
+        {
+            std::error_code ec;
+            std::size_t line = 0;
+            std::size_t column = 0;
+            stream_chunker chunker(is, options_.chunk_size());
+            replay(chunker, visitor, ec, line, column);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec, line, column));
+            }
+        }
+
+        void read(std::basic_istream<char_type>& is, basic_json_visitor<char_type>& visitor, std::error_code& ec) const
+        {
+            std::size_t line = 0;
+            std::size_t column = 0;
+            stream_chunker chunker(is, options_.chunk_size());
+            replay(chunker, visitor, ec, line, column);
+        }
+
+    private:
+        template <class Chunker>
+        void replay(Chunker& chunker, basic_json_visitor<char_type>& visitor,
+                    std::error_code& ec, std::size_t& line, std::size_t& column) const
+        {
+            run(chunker, [&](record_type& record) -> bool
+            {
+                if (record.ec)
+                {
+                    ec = record.ec;
+                    line = record.line;
+                    column = record.column;
+                    return false;
+                }
+                record.value.dump(visitor, ec);
+                if (ec)
+                {
+                    line = record.line;
+                    return false;
+                }
+                return true;
+            });
+        }
+
+        template <class Chunker, class F>
+        std::size_t run(Chunker& chunker, F f) const
+        {
+            // Declared before the pool, so that the chunks outlive the workers
+            std::deque<pending_chunk> pending;
+            jsoncons::detail::thread_pool pool(options_.num_threads() == 0 ? jsoncons::detail::thread_pool::default_size() : options_.num_threads());
+
+            std::size_t in_flight_bytes = 0;
+            std::size_t line_offset = 0;
+            std::size_t count = 0;
+            bool more_input = true;
+            while (true)
+            {
+                while (more_input && (pending.empty() || in_flight_bytes < options_.max_in_flight_bytes()))
+                {
+                    chunk c;
+                    if (!chunker.next(c))
+                    {
+                        more_input = false;
+                        break;
+                    }
+                    auto promise = std::make_shared<std::promise<chunk_result>>();
+                    pending.push_back(pending_chunk{promise->get_future(), c.data.size(), c.owner});
+                    in_flight_bytes += c.data.size();
+
+                    const string_view_type data = c.data;
+                    pool.submit([this, promise, data]()
+                    {
+                        JSONCONS_TRY
+                        {
+                            promise->set_value(parse_chunk(data));
+                        }
+                        JSONCONS_CATCH(...)
+                        {
+                            promise->set_exception(std::current_exception());
+                        }
+                    });
+                }
+                if (pending.empty())
+                {
+                    break;
+                }
+
+                chunk_result result = pending.front().result.get();
+                in_flight_bytes -= pending.front().size;
+                pending.pop_front();
+
+                for (auto& record : result.records)
+                {
+                    record.line += line_offset;
+                    ++count;
+                    if (!f(record))
+                    {
+                        return count;
+                    }
+                }
+                line_offset += result.line_count;
+            }
+            return count;
+        }
+
+        static bool is_blank(const char_type* first, const char_type* last)
+        {
+            for (; first != last; ++first)
+            {
+                if (!(*first == ' ' || *first == '\t' || *first == '\r'))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        chunk_result parse_chunk(const string_view_type& data) const
+        {
+            chunk_result result;
+            result.line_count = 0;
+
+            basic_json_parser<char_type> parser(decode_options_);
+            json_decoder<Json> decoder;
+
+            const char_type* p = data.data();
+            const char_type* end = data.data() + data.size();
+            while (p != end)
+            {
+                const char_type* line_end = std::find(p, end, '\n');
+                ++result.line_count;
+                if (!is_blank(p, line_end))
+                {
+                    record_type record{result.line_count, Json::null(), std::error_code(), 0};
+
+                    parser.reinitialize();
+                    parser.update(p, static_cast<std::size_t>(line_end - p));
+                    parser.parse_some(decoder, record.ec);
+                    if (!record.ec)
+                    {
+                        parser.finish_parse(decoder, record.ec);
+                    }
+                    if (!record.ec)
+                    {
+                        parser.check_done(record.ec);
+                    }
+                    if (!record.ec && !decoder.is_valid())
+                    {
+                        record.ec = json_errc::unexpected_eof;
+                    }
+                    if (record.ec)
+                    {
+                        record.column = parser.column();
+                        decoder.reset();
+                    }
+                    else
+                    {
+                        record.value = decoder.get_result();
+                    }
+                    result.records.push_back(std::move(record));
+                }
+                p = line_end == end ? end : line_end + 1;
+            }
+            return result;
+        }
+    };
+
+} // namespace jsoncons
+
+#endif
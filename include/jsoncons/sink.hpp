@@ -14,6 +14,7 @@
 #include <cmath>
 #include <exception>
 #include <memory> // std::addressof
+#include <iterator> // std::advance
 #include <cstring> // std::memcpy
 #include <jsoncons/config/jsoncons_config.hpp>
 #include <jsoncons/traits_extension.hpp>
@@ -278,12 +279,65 @@ namespace jsoncons {
         {
         }
 
+        void append(const uint8_t* s, std::size_t length)
+        {
+            append(s, length, std::integral_constant<bool,traits_extension::is_range_insertable<Container,const uint8_t*>::value>());
+        }
+
         void push_back(uint8_t ch)
         {
             buf_ptr->push_back(static_cast<value_type>(ch));
         }
+
+        // The container size after the bytes written so far
+        std::size_t position() const
+        {
+            return buf_ptr->size();
+        }
+
+        // Overwrites length bytes that were written at position offset
+        void patch(std::size_t offset, const uint8_t* s, std::size_t length)
+        {
+            auto it = buf_ptr->begin();
+            std::advance(it, offset);
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                *it++ = static_cast<value_type>(s[i]);
+            }
+        }
+    private:
+        void append(const uint8_t* s, std::size_t length, std::true_type)
+        {
+            buf_ptr->insert(buf_ptr->end(), s, s+length);
+        }
+
+        void append(const uint8_t* s, std::size_t length, std::false_type)
+        {
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                buf_ptr->push_back(static_cast<value_type>(s[i]));
+            }
+        }
     };
 
+    // is_seekable_sink
+
+    template <class Sink>
+    using
+    sink_patch_t = decltype(std::declval<Sink&>().patch(std::size_t(), std::declval<const uint8_t*>(), std::size_t()));
+
+    // Sinks that can overwrite bytes already written, given their position
+    template <class Sink>
+    using
+    is_seekable_sink = traits_extension::is_detected<sink_patch_t, Sink>;
+
+    // is_appendable_sink
+
+    // Binary sinks that accept a block of bytes in one append call
+    template <class Sink>
+    using
+    is_appendable_sink = traits_extension::has_append<Sink, uint8_t>;
+
 } // namespace jsoncons
 
 #endif
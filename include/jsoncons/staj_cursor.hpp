@@ -972,7 +972,7 @@ private:
         state_ = staj_cursor_state::typed_array;
         data_ = typed_array_view(v.data(), v.size());
         index_ = 0;
-        return this->begin_array(tag, context, ec);
+        return this->begin_array(data_.size(), tag, context, ec);
     }
 
     bool visit_typed_array(const jsoncons::span<const uint16_t>& data, 
@@ -983,7 +983,7 @@ private:
         state_ = staj_cursor_state::typed_array;
         data_ = typed_array_view(data.data(), data.size());
         index_ = 0;
-        return this->begin_array(tag, context, ec);
+        return this->begin_array(data_.size(), tag, context, ec);
     }
 
     bool visit_typed_array(const jsoncons::span<const uint32_t>& data, 
@@ -994,7 +994,7 @@ private:
         state_ = staj_cursor_state::typed_array;
         data_ = typed_array_view(data.data(), data.size());
         index_ = 0;
-        return this->begin_array(tag, context, ec);
+        return this->begin_array(data_.size(), tag, context, ec);
     }
 
     bool visit_typed_array(const jsoncons::span<const uint64_t>& data, 
@@ -1005,7 +1005,7 @@ private:
         state_ = staj_cursor_state::typed_array;
         data_ = typed_array_view(data.data(), data.size());
         index_ = 0;
-        return this->begin_array(tag, context, ec);
+        return this->begin_array(data_.size(), tag, context, ec);
     }
 
     bool visit_typed_array(const jsoncons::span<const int8_t>& data, 
@@ -1016,7 +1016,7 @@ private:
         state_ = staj_cursor_state::typed_array;
         data_ = typed_array_view(data.data(), data.size());
         index_ = 0;
-        return this->begin_array(tag, context, ec);
+        return this->begin_array(data_.size(), tag, context, ec);
     }
 
     bool visit_typed_array(const jsoncons::span<const int16_t>& data, 
@@ -1027,7 +1027,7 @@ private:
         state_ = staj_cursor_state::typed_array;
         data_ = typed_array_view(data.data(), data.size());
         index_ = 0;
-        return this->begin_array(tag, context, ec);
+        return this->begin_array(data_.size(), tag, context, ec);
     }
 
     bool visit_typed_array(const jsoncons::span<const int32_t>& data, 
@@ -1038,7 +1038,7 @@ private:
         state_ = staj_cursor_state::typed_array;
         data_ = typed_array_view(data.data(), data.size());
         index_ = 0;
-        return this->begin_array(tag, context, ec);
+        return this->begin_array(data_.size(), tag, context, ec);
     }
 
     bool visit_typed_array(const jsoncons::span<const int64_t>& data, 
@@ -1049,7 +1049,7 @@ private:
         state_ = staj_cursor_state::typed_array;
         data_ = typed_array_view(data.data(), data.size());
         index_ = 0;
-        return this->begin_array(tag, context, ec);
+        return this->begin_array(data_.size(), tag, context, ec);
     }
 
     bool visit_typed_array(half_arg_t, const jsoncons::span<const uint16_t>& data, 
@@ -1060,7 +1060,7 @@ private:
         state_ = staj_cursor_state::typed_array;
         data_ = typed_array_view(data.data(), data.size());
         index_ = 0;
-        return this->begin_array(tag, context, ec);
+        return this->begin_array(data_.size(), tag, context, ec);
     }
 
     bool visit_typed_array(const jsoncons::span<const float>& data, 
@@ -1071,7 +1071,7 @@ private:
         state_ = staj_cursor_state::typed_array;
         data_ = typed_array_view(data.data(), data.size());
         index_ = 0;
-        return this->begin_array(tag, context, ec);
+        return this->begin_array(data_.size(), tag, context, ec);
     }
 
     bool visit_typed_array(const jsoncons::span<const double>& data, 
@@ -1082,7 +1082,7 @@ private:
         state_ = staj_cursor_state::typed_array;
         data_ = typed_array_view(data.data(), data.size());
         index_ = 0;
-        return this->begin_array(tag, context, ec);
+        return this->begin_array(data_.size(), tag, context, ec);
     }
 /*
     bool visit_typed_array(const jsoncons::span<const float128_type>&, 
@@ -1145,6 +1145,54 @@ public:
     virtual void next(std::error_code& ec) = 0;
 
     virtual const ser_context& context() const = 0;
+
+    // If the current event is begin_object or begin_array, advances to the
+    // matching end_object or end_array event, otherwise does nothing. As with
+    // read_to, a subsequent call to next moves past the value.
+    virtual void skip()
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,context().line(),context().column()));
+        }
+    }
+
+    virtual void skip(std::error_code& ec)
+    {
+        std::size_t level = 0;
+        switch (current().event_type())
+        {
+            case staj_event_type::begin_object:
+            case staj_event_type::begin_array:
+                level = 1;
+                break;
+            default:
+                return;
+        }
+        while (level > 0)
+        {
+            next(ec);
+            if (ec || done())
+            {
+                return;
+            }
+            switch (current().event_type())
+            {
+                case staj_event_type::begin_object:
+                case staj_event_type::begin_array:
+                    ++level;
+                    break;
+                case staj_event_type::end_object:
+                case staj_event_type::end_array:
+                    --level;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
 };
 
 template<class CharT>
@@ -1202,6 +1250,26 @@ public:
         }
     }
 
+    // Skips through the underlying cursor, then moves past the end event
+    // if the predicate rejects it, as next() would
+    void skip() override
+    {
+        cursor_->skip();
+        while (!done() && !pred_(current(),context()))
+        {
+            cursor_->next();
+        }
+    }
+
+    void skip(std::error_code& ec) override
+    {
+        cursor_->skip(ec);
+        while (!done() && !ec && !pred_(current(),context()))
+        {
+            cursor_->next(ec);
+        }
+    }
+
     const ser_context& context() const override
     {
         return cursor_->context();
@@ -452,10 +452,22 @@ namespace traits_extension {
     using
     container_insert_t = decltype(std::declval<Container>().insert(std::declval<typename Container::value_type>()));
 
+    template<class Container, class InputIt>
+    using
+    container_range_insert_t = decltype(std::declval<Container>().insert(std::declval<Container>().end(), std::declval<InputIt>(), std::declval<InputIt>()));
+
     template<class Container>
     using
     container_reserve_t = decltype(std::declval<Container>().reserve(typename Container::size_type()));
 
+    template<class Container, class CharT>
+    using
+    container_append_t = decltype(std::declval<Container>().append(std::declval<const CharT*>(), std::size_t()));
+
+    template<class Container>
+    using
+    container_resize_t = decltype(std::declval<Container>().resize(typename Container::size_type()));
+
     template<class Container>
     using
     container_data_t = decltype(std::declval<Container>().data());
@@ -561,6 +573,18 @@ namespace traits_extension {
     using
     has_reserve = is_detected<container_reserve_t, Container>;
 
+    // has_append
+
+    template<class Container, class CharT>
+    using
+    has_append = is_detected<container_append_t, Container, CharT>;
+
+    // has_resize
+
+    template<class Container>
+    using
+    has_resize = is_detected<container_resize_t, Container>;
+
     // is_back_insertable
 
     template<class Container>
@@ -579,6 +603,12 @@ namespace traits_extension {
     using
     is_insertable = is_detected<container_insert_t, Container>;
 
+    // is_range_insertable
+
+    template<class Container, class InputIt>
+    using
+    is_range_insertable = is_detected<container_range_insert_t, Container, InputIt>;
+
     // has_data, has_data_exact
 
     template<class Container>
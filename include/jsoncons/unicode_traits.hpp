@@ -24,6 +24,7 @@
 #include <limits>
 #include <jsoncons/config/compiler_support.hpp>
 #include <jsoncons/traits_extension.hpp>
+#include <jsoncons/detail/simd_unicode.hpp>
 
 namespace jsoncons { namespace unicode_traits {
 
@@ -543,6 +544,32 @@ namespace jsoncons { namespace unicode_traits {
         return convert_result<CharT>{first,result} ;
     }
 
+    // append_code_units appends code units that need no transcoding, ASCII or UTF-8 to UTF-8, to target
+
+    template <class CharT,class Container>
+    typename std::enable_if<traits_extension::has_data<Container>::value && traits_extension::has_resize<Container>::value>::type
+    append_code_units(const CharT* first, const CharT* last, Container& target)
+    {
+        std::size_t length = static_cast<std::size_t>(last - first);
+        if (length > 0)
+        {
+            std::size_t size = target.size();
+            target.resize(size + length);
+            jsoncons::detail::copy_ascii(first, length, &target[0] + size);
+        }
+    }
+
+    template <class CharT,class Container>
+    typename std::enable_if<!(traits_extension::has_data<Container>::value && traits_extension::has_resize<Container>::value)>::type
+    append_code_units(const CharT* first, const CharT* last, Container& target)
+    {
+        using value_type = typename Container::value_type;
+        for (; first != last; ++first)
+        {
+            target.push_back(static_cast<value_type>(static_cast<typename std::make_unsigned<CharT>::type>(*first)));
+        }
+    }
+
     // convert
 
     template <class CharT,class Container>
@@ -558,6 +585,14 @@ namespace jsoncons { namespace unicode_traits {
         const CharT* last = data + length;
         while (data != last) 
         {
+            const CharT* valid = reinterpret_cast<const CharT*>(jsoncons::detail::skip_valid_utf8(
+                reinterpret_cast<const char*>(data), reinterpret_cast<const char*>(last)));
+            append_code_units(data, valid, target);
+            data = valid;
+            if (data == last)
+            {
+                break;
+            }
             std::size_t len = trailing_bytes_for_utf8[static_cast<uint8_t>(*data)] + 1;
             if (len > (std::size_t)(last - data))
             {
@@ -595,6 +630,16 @@ namespace jsoncons { namespace unicode_traits {
         const CharT* last = data + length;
         while (data != last) 
         {
+            if (static_cast<uint32_t>(*data) < 0x80)
+            {
+                const CharT* ascii_last = jsoncons::detail::skip_ascii(data, last);
+                append_code_units(data, ascii_last, target);
+                data = ascii_last;
+                if (data == last)
+                {
+                    break;
+                }
+            }
             unsigned short extra_bytes_to_read = trailing_bytes_for_utf8[static_cast<uint8_t>(*data)];
             if (extra_bytes_to_read >= last - data) 
             {
@@ -672,6 +717,16 @@ namespace jsoncons { namespace unicode_traits {
         const CharT* last = data + length;
         while (data < last) 
         {
+            if (static_cast<uint32_t>(*data) < 0x80)
+            {
+                const CharT* ascii_last = jsoncons::detail::skip_ascii(data, last);
+                append_code_units(data, ascii_last, target);
+                data = ascii_last;
+                if (data == last)
+                {
+                    break;
+                }
+            }
             uint32_t ch = 0;
             unsigned short extra_bytes_to_read = trailing_bytes_for_utf8[static_cast<uint8_t>(*data)];
             if (extra_bytes_to_read >= last - data) 
@@ -754,6 +809,16 @@ namespace jsoncons { namespace unicode_traits {
 
         const CharT* last = data + length;
         while (data < last) {
+            if (static_cast<uint32_t>(*data) < 0x80)
+            {
+                const CharT* ascii_last = jsoncons::detail::skip_ascii(data, last);
+                append_code_units(data, ascii_last, target);
+                data = ascii_last;
+                if (data == last)
+                {
+                    break;
+                }
+            }
             unsigned short bytes_to_write = 0;
             const uint32_t byteMask = 0xBF;
             const uint32_t byteMark = 0x80; 
@@ -965,6 +1030,16 @@ namespace jsoncons { namespace unicode_traits {
         const CharT* last = data + length;
         while (data < last) 
         {
+            if (static_cast<uint32_t>(*data) < 0x80)
+            {
+                const CharT* ascii_last = jsoncons::detail::skip_ascii(data, last);
+                append_code_units(data, ascii_last, target);
+                data = ascii_last;
+                if (data == last)
+                {
+                    break;
+                }
+            }
             unsigned short bytes_to_write = 0;
             const uint32_t byteMask = 0xBF;
             const uint32_t byteMark = 0x80; 
@@ -1132,6 +1207,12 @@ namespace jsoncons { namespace unicode_traits {
         const CharT* last = data + length;
         while (data != last) 
         {
+            data = reinterpret_cast<const CharT*>(jsoncons::detail::skip_valid_utf8(
+                reinterpret_cast<const char*>(data), reinterpret_cast<const char*>(last)));
+            if (data == last)
+            {
+                break;
+            }
             std::size_t len = static_cast<std::size_t>(trailing_bytes_for_utf8[static_cast<uint8_t>(*data)]) + 1;
             if (len > (std::size_t)(last - data))
             {
@@ -1158,6 +1239,11 @@ namespace jsoncons { namespace unicode_traits {
         const CharT* last = data + length;
         while (data != last) 
         {
+            data = jsoncons::detail::skip_non_surrogates(data, last);
+            if (data == last)
+            {
+                break;
+            }
             uint32_t ch = *data++;
             /* If we have a surrogate pair, validate to uint32_t data. */
             if (is_high_surrogate(ch)) 
@@ -1204,6 +1290,11 @@ namespace jsoncons { namespace unicode_traits {
         const CharT* last = data + length;
         while (data != last) 
         {
+            data = jsoncons::detail::skip_non_surrogates(data, last);
+            if (data == last)
+            {
+                break;
+            }
             uint32_t ch = *data++;
             /* UTF-16 surrogate values are illegal in UTF-32 */
             if (is_surrogate(ch)) 
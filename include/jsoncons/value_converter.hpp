@@ -59,13 +59,13 @@ namespace jsoncons {
             switch (tag)
             {
                 case semantic_tag::base64:
-                    encode_base64(value.begin(), value.end(), s);
+                    encode_base64(value.data(), value.data() + value.size(), s);
                     break;
                 case semantic_tag::base16:
-                    encode_base16(value.begin(), value.end(), s);
+                    encode_base16(value.data(), value.data() + value.size(), s);
                     break;
                 default:
-                    encode_base64url(value.begin(), value.end(), s);
+                    encode_base64url(value.data(), value.data() + value.size(), s);
                     break;
             }
             return s;
@@ -78,13 +78,13 @@ namespace jsoncons {
             switch (tag)
             {
                 case semantic_tag::base64:
-                    encode_base64(value.begin(), value.end(), s);
+                    encode_base64(value.data(), value.data() + value.size(), s);
                     break;
                 case semantic_tag::base16:
-                    encode_base16(value.begin(), value.end(), s);
+                    encode_base16(value.data(), value.data() + value.size(), s);
                     break;
                 default:
-                    encode_base64url(value.begin(), value.end(), s);
+                    encode_base64url(value.data(), value.data() + value.size(), s);
                     break;
             }
 
@@ -175,7 +175,7 @@ namespace jsoncons {
             {
                 case semantic_tag::base16:
                 {
-                    auto res = decode_base16(value.begin(), value.end(), bytes);
+                    auto res = decode_base16(value.data(), value.data() + value.size(), bytes);
                     if (res.ec != conv_errc::success)
                     {
                         ec = conv_errc::not_byte_string;
@@ -184,12 +184,12 @@ namespace jsoncons {
                 }
                 case semantic_tag::base64:
                 {
-                    decode_base64(value.begin(), value.end(), bytes);
+                    decode_base64(value.data(), value.data() + value.size(), bytes);
                     break;
                 }
                 case semantic_tag::base64url:
                 {
-                    decode_base64url(value.begin(), value.end(), bytes);
+                    decode_base64url(value.data(), value.data() + value.size(), bytes);
                     break;
                 }
                 default:
@@ -217,7 +217,7 @@ namespace jsoncons {
             {
                 case semantic_tag::base16:
                 {
-                    auto res = decode_base16(s.begin(), s.end(), bytes);
+                    auto res = decode_base16(s.data(), s.data() + s.size(), bytes);
                     if (res.ec != conv_errc::success)
                     {
                         ec = conv_errc::not_byte_string;
@@ -226,12 +226,12 @@ namespace jsoncons {
                 }
                 case semantic_tag::base64:
                 {
-                    decode_base64(s.begin(), s.end(), bytes);
+                    decode_base64(s.data(), s.data() + s.size(), bytes);
                     break;
                 }
                 case semantic_tag::base64url:
                 {
-                    decode_base64url(s.begin(), s.end(), bytes);
+                    decode_base64url(s.data(), s.data() + s.size(), bytes);
                     break;
                 }
                 default:
@@ -199,6 +199,37 @@ public:
         read_next(ec);
     }
 
+    void skip() override
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    // Steps over the elements of a document or array using its length, without
+    // producing events for them, then reads the end_object or end_array event
+    void skip(std::error_code& ec) override
+    {
+        if (done())
+        {
+            return;
+        }
+        switch (cursor_visitor_.event().event_type())
+        {
+            case staj_event_type::begin_object:
+            case staj_event_type::begin_array:
+                break;
+            default:
+                return;
+        }
+        parser_.skip_container(ec);
+        if (ec) return;
+        read_next(ec);
+    }
+
     const ser_context& context() const override
     {
         return *this;
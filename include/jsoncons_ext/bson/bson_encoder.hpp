@@ -12,6 +12,8 @@
 #include <limits> // std::numeric_limits
 #include <memory>
 #include <utility> // std::move
+#include <cstring> // std::memcpy
+#include <iterator> // std::back_inserter
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_visitor.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
@@ -86,6 +88,14 @@ private:
     std::vector<stack_item> stack_;
     std::vector<uint8_t> buffer_;
     int nesting_depth_;
+    // Seekable sinks receive the document as it is written, buffer_ holds
+    // only the bytes after buffer_offset_, and lengths that have already
+    // been passed to the sink are patched in place
+    bool seekable_;
+    std::size_t buffer_offset_;
+    std::size_t sink_offset_;
+
+    static constexpr std::size_t flush_threshold = 16384;
 
     // Noncopyable and nonmoveable
     basic_bson_encoder(const basic_bson_encoder&) = delete;
@@ -105,7 +115,10 @@ public:
        : sink_(std::forward<Sink>(sink)),
          options_(options),
          alloc_(alloc), 
-         nesting_depth_(0)
+         nesting_depth_(0),
+         seekable_(false),
+         buffer_offset_(0),
+         sink_offset_(0)
     {
     }
 
@@ -119,6 +132,9 @@ public:
         stack_.clear();
         buffer_.clear();
         nesting_depth_ = 0;
+        seekable_ = false;
+        buffer_offset_ = 0;
+        sink_offset_ = 0;
     }
 
     void reset(Sink&& sink)
@@ -142,7 +158,7 @@ private:
             ec = bson_errc::max_nesting_depth_exceeded;
             return false;
         } 
-        if (buffer_.size() > 0)
+        if (offset() > 0)
         {
             if (stack_.empty())
             {
@@ -151,8 +167,11 @@ private:
             }
             before_value(jsoncons::bson::bson_type::document_type);
         }
-
-        stack_.emplace_back(jsoncons::bson::bson_container_type::document, buffer_.size());
+        else
+        {
+            begin_document();
+        }
+        stack_.emplace_back(jsoncons::bson::bson_container_type::document, offset());
         buffer_.insert(buffer_.end(), sizeof(int32_t), 0);
 
         return true;
@@ -165,16 +184,13 @@ private:
 
         buffer_.push_back(0x00);
 
-        std::size_t length = buffer_.size() - stack_.back().offset();
-        binary::native_to_little(static_cast<uint32_t>(length), buffer_.begin()+stack_.back().offset());
+        std::size_t length = offset() - stack_.back().offset();
+        patch_length(stack_.back().offset(), length);
 
         stack_.pop_back();
         if (stack_.empty())
         {
-            for (auto c : buffer_)
-            {
-                sink_.push_back(c);
-            }
+            end_document();
         }
         return true;
     }
@@ -186,7 +202,7 @@ private:
             ec = bson_errc::max_nesting_depth_exceeded;
             return false;
         } 
-        if (buffer_.size() > 0)
+        if (offset() > 0)
         {
             if (stack_.empty())
             {
@@ -195,7 +211,11 @@ private:
             }
             before_value(jsoncons::bson::bson_type::array_type);
         }
-        stack_.emplace_back(jsoncons::bson::bson_container_type::array, buffer_.size());
+        else
+        {
+            begin_document();
+        }
+        stack_.emplace_back(jsoncons::bson::bson_container_type::array, offset());
         buffer_.insert(buffer_.end(), sizeof(int32_t), 0);
         return true;
     }
@@ -207,23 +227,20 @@ private:
 
         buffer_.push_back(0x00);
 
-        std::size_t length = buffer_.size() - stack_.back().offset();
-        binary::native_to_little(static_cast<uint32_t>(length), buffer_.begin()+stack_.back().offset());
+        std::size_t length = offset() - stack_.back().offset();
+        patch_length(stack_.back().offset(), length);
 
         stack_.pop_back();
         if (stack_.empty())
         {
-            for (auto c : buffer_)
-            {
-                sink_.push_back(c);
-            }
+            end_document();
         }
         return true;
     }
 
     bool visit_key(const string_view_type& name, const ser_context&, std::error_code&) override
     {
-        stack_.back().member_offset(buffer_.size());
+        stack_.back().member_offset(offset());
         buffer_.push_back(0x00); // reserve space for code
         for (auto c : name)
         {
@@ -340,22 +357,15 @@ private:
                         before_value(jsoncons::bson::bson_type::string_type);
                         break;
                 }
-                std::size_t offset = buffer_.size();
-                buffer_.insert(buffer_.end(), sizeof(int32_t), 0);
-                std::size_t string_offset = buffer_.size();
                 auto sink = unicode_traits::validate(sv.data(), sv.size());
                 if (sink.ec != unicode_traits::conv_errc())
                 {
                     ec = bson_errc::invalid_utf8_text_string;
                     return false;
                 }
-                for (auto c : sv)
-                {
-                    buffer_.push_back(c);
-                }
+                binary::native_to_little(static_cast<uint32_t>(sv.size()+1), std::back_inserter(buffer_));
+                buffer_.insert(buffer_.end(), sv.begin(), sv.end());
                 buffer_.push_back(0x00);
-                std::size_t length = buffer_.size() - string_offset;
-                binary::native_to_little(static_cast<uint32_t>(length), buffer_.begin()+offset);
                 break;
         }
 
@@ -374,18 +384,9 @@ private:
         }
         before_value(jsoncons::bson::bson_type::binary_type);
 
-        std::size_t offset = buffer_.size();
-        buffer_.insert(buffer_.end(), sizeof(int32_t), 0);
-        std::size_t string_offset = buffer_.size();
-
+        binary::native_to_little(static_cast<uint32_t>(b.size()), std::back_inserter(buffer_));
         buffer_.push_back(0x80); // default subtype
-
-        for (auto c : b)
-        {
-            buffer_.push_back(c);
-        }
-        std::size_t length = buffer_.size() - string_offset - 1;
-        binary::native_to_little(static_cast<uint32_t>(length), buffer_.begin()+offset);
+        buffer_.insert(buffer_.end(), b.begin(), b.end());
 
         return true;
     }
@@ -402,18 +403,9 @@ private:
         }
         before_value(jsoncons::bson::bson_type::binary_type);
 
-        std::size_t offset = buffer_.size();
-        buffer_.insert(buffer_.end(), sizeof(int32_t), 0);
-        std::size_t string_offset = buffer_.size();
-
+        binary::native_to_little(static_cast<uint32_t>(b.size()), std::back_inserter(buffer_));
         buffer_.push_back(static_cast<uint8_t>(ext_tag)); // default subtype
-
-        for (auto c : b)
-        {
-            buffer_.push_back(c);
-        }
-        std::size_t length = buffer_.size() - string_offset - 1;
-        binary::native_to_little(static_cast<uint32_t>(length), buffer_.begin()+offset);
+        buffer_.insert(buffer_.end(), b.begin(), b.end());
 
         return true;
     }
@@ -556,7 +548,7 @@ private:
         JSONCONS_ASSERT(!stack_.empty());
         if (stack_.back().is_object())
         {
-            buffer_[stack_.back().member_offset()] = code;
+            patch(stack_.back().member_offset(), &code, 1);
         }
         else
         {
@@ -565,6 +557,98 @@ private:
             buffer_.insert(buffer_.end(), name.begin(), name.end());
             buffer_.push_back(0x00);
         }
+        if (seekable_ && buffer_.size() >= flush_threshold)
+        {
+            flush_buffer();
+        }
+    }
+
+    // The offset of the next byte from the start of the document
+    std::size_t offset() const
+    {
+        return buffer_offset_ + buffer_.size();
+    }
+
+    void begin_document()
+    {
+        begin_document(std::integral_constant<bool,is_seekable_sink<Sink>::value>());
+    }
+
+    void begin_document(std::true_type)
+    {
+        seekable_ = true;
+        sink_offset_ = sink_.position();
+    }
+
+    void begin_document(std::false_type)
+    {
+        seekable_ = false;
+    }
+
+    void end_document()
+    {
+        if (seekable_)
+        {
+            flush_buffer();
+        }
+        else
+        {
+            append_to_sink(buffer_.data(), buffer_.size());
+        }
+    }
+
+    void flush_buffer()
+    {
+        append_to_sink(buffer_.data(), buffer_.size());
+        buffer_offset_ += buffer_.size();
+        buffer_.clear();
+    }
+
+    void append_to_sink(const uint8_t* s, std::size_t length)
+    {
+        append_to_sink(s, length, std::integral_constant<bool,is_appendable_sink<Sink>::value>());
+    }
+
+    void append_to_sink(const uint8_t* s, std::size_t length, std::true_type)
+    {
+        sink_.append(s, length);
+    }
+
+    void append_to_sink(const uint8_t* s, std::size_t length, std::false_type)
+    {
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            sink_.push_back(s[i]);
+        }
+    }
+
+    void patch_length(std::size_t offset, std::size_t length)
+    {
+        uint8_t buf[sizeof(int32_t)];
+        binary::native_to_little(static_cast<uint32_t>(length), buf);
+        patch(offset, buf, sizeof(int32_t));
+    }
+
+    void patch(std::size_t offset, const uint8_t* s, std::size_t length)
+    {
+        if (offset >= buffer_offset_)
+        {
+            std::memcpy(buffer_.data() + (offset - buffer_offset_), s, length);
+        }
+        else
+        {
+            patch_sink(sink_offset_ + offset, s, length, std::integral_constant<bool,is_seekable_sink<Sink>::value>());
+        }
+    }
+
+    void patch_sink(std::size_t offset, const uint8_t* s, std::size_t length, std::true_type)
+    {
+        sink_.patch(offset, s, length);
+    }
+
+    void patch_sink(std::size_t, const uint8_t*, std::size_t, std::false_type)
+    {
+        JSONCONS_UNREACHABLE();
     }
 };
 
@@ -206,6 +206,31 @@ public:
         }
     }
 
+    // Skips the elements of the document or array just begun using its length,
+    // and leaves the terminating null byte to parse
+    void skip_container(std::error_code& ec)
+    {
+        more_ = true;
+        parse_state& state = state_stack_.back();
+        JSONCONS_ASSERT(state.mode == parse_mode::document || state.mode == parse_mode::array);
+        if (JSONCONS_UNLIKELY(state.length <= state.pos))
+        {
+            ec = bson_errc::size_mismatch;
+            more_ = false;
+            return;
+        }
+        std::size_t length = state.length - state.pos - 1;
+        std::size_t position = source_.position();
+        source_.ignore(length);
+        std::size_t n = source_.position() - position;
+        state.pos += n;
+        if (JSONCONS_UNLIKELY(n != length))
+        {
+            ec = bson_errc::unexpected_eof;
+            more_ = false;
+        }
+    }
+
 private:
 
     void begin_document(json_visitor& visitor, std::error_code& ec)
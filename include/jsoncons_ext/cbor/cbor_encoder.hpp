@@ -19,6 +19,7 @@
 #include <jsoncons/detail/parse_number.hpp>
 #include <jsoncons_ext/cbor/cbor_error.hpp>
 #include <jsoncons_ext/cbor/cbor_options.hpp>
+#include <jsoncons_ext/cbor/cbor_stringref_table.hpp>
 
 namespace jsoncons { namespace cbor {
 
@@ -81,8 +82,6 @@ private:
 
     };
 
-    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<std::pair<const string_type,size_t>> string_size_allocator_type;
-    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<std::pair<const byte_string_type,size_t>> byte_string_size_allocator_type;
     typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<stack_item> stack_item_allocator_type;
 
     Sink sink_;
@@ -90,8 +89,7 @@ private:
     allocator_type alloc_;
 
     std::vector<stack_item,stack_item_allocator_type> stack_;
-    std::map<string_type,size_t,std::less<string_type>,string_size_allocator_type> stringref_map_;
-    std::map<byte_string_type,size_t,std::less<byte_string_type>,byte_string_size_allocator_type> bytestringref_map_;
+    jsoncons::cbor::detail::stringref_table<allocator_type> stringref_map_;
     std::size_t next_stringref_ = 0;
     int nesting_depth_;
 
@@ -111,10 +109,7 @@ public:
          options_(options), 
          alloc_(alloc),
          stack_(alloc),
-#if !defined(JSONCONS_NO_MAP_CONS_TAKES_ALLOCATOR) 
-         stringref_map_(alloc),
-         bytestringref_map_(alloc),
-#endif 
+         stringref_map_(options.max_stringrefs(), alloc),
          nesting_depth_(0)        
     {
         if (options.pack_strings())
@@ -138,7 +133,6 @@ public:
     {
         stack_.clear();
         stringref_map_.clear();
-        bytestringref_map_.clear();
         next_stringref_ = 0;
         nesting_depth_ = 0;
     }
@@ -361,17 +355,17 @@ private:
 
         if (options_.pack_strings() && sv.size() >= jsoncons::cbor::detail::min_length_for_stringref(next_stringref_))
         {
-            string_type s(sv.data(), sv.size(), alloc_);
-            auto it = stringref_map_.find(s);
-            if (it == stringref_map_.end())
+            uint64_t ref;
+            if (stringref_map_.find_or_insert(jsoncons::cbor::detail::cbor_major_type::text_string, 
+                                              reinterpret_cast<const uint8_t*>(sv.data()), sv.size(), next_stringref_, ref))
             {
-                stringref_map_.emplace(std::make_pair(std::move(s), next_stringref_++));
-                write_utf8_string(sv);
+                write_tag(25);
+                write_uint64_value(ref);
             }
             else
             {
-                write_tag(25);
-                write_uint64_value(it->second);
+                ++next_stringref_;
+                write_utf8_string(sv);
             }
         }
         else
@@ -912,17 +906,17 @@ private:
         }
         if (options_.pack_strings() && b.size() >= jsoncons::cbor::detail::min_length_for_stringref(next_stringref_))
         {
-            byte_string_type bs(b.data(), b.size(), alloc_);
-            auto it = bytestringref_map_.find(bs);
-            if (it == bytestringref_map_.end())
+            uint64_t ref;
+            if (stringref_map_.find_or_insert(jsoncons::cbor::detail::cbor_major_type::byte_string, 
+                                              b.data(), b.size(), next_stringref_, ref))
             {
-                bytestringref_map_.emplace(std::make_pair(bs, next_stringref_++));
-                write_byte_string_value(bs);
+                write_tag(25);
+                write_uint64_value(ref);
             }
             else
             {
-                write_tag(25);
-                write_uint64_value(it->second);
+                ++next_stringref_;
+                write_byte_string_value(b);
             }
         }
         else
@@ -941,18 +935,18 @@ private:
     {
         if (options_.pack_strings() && b.size() >= jsoncons::cbor::detail::min_length_for_stringref(next_stringref_))
         {
-            byte_string_type bs(b.data(), b.size(), alloc_);
-            auto it = bytestringref_map_.find(bs);
-            if (it == bytestringref_map_.end())
+            uint64_t ref;
+            if (stringref_map_.find_or_insert(jsoncons::cbor::detail::cbor_major_type::byte_string, 
+                                              b.data(), b.size(), next_stringref_, ref))
             {
-                bytestringref_map_.emplace(std::make_pair(bs, next_stringref_++));
-                write_tag(ext_tag);
-                write_byte_string_value(bs);
+                write_tag(25);
+                write_uint64_value(ref);
             }
             else
             {
-                write_tag(25);
-                write_uint64_value(it->second);
+                ++next_stringref_;
+                write_tag(ext_tag);
+                write_byte_string_value(b);
             }
         }
         else
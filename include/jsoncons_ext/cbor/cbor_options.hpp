@@ -56,10 +56,12 @@ class cbor_encode_options : public virtual cbor_options_common
 
     bool use_stringref_;
     bool use_typed_arrays_;
+    std::size_t max_stringrefs_;
 public:
     cbor_encode_options()
         : use_stringref_(false),
-          use_typed_arrays_(false)
+          use_typed_arrays_(false),
+          max_stringrefs_((std::numeric_limits<std::size_t>::max)())
     {
     }
 
@@ -68,6 +70,11 @@ public:
         return use_stringref_;
     }
 
+    std::size_t max_stringrefs() const 
+    {
+        return max_stringrefs_;
+    }
+
     bool use_typed_arrays() const 
     {
         return use_typed_arrays_;
@@ -80,6 +87,7 @@ public:
     using cbor_options_common::max_nesting_depth;
     using cbor_encode_options::pack_strings;
     using cbor_encode_options::use_typed_arrays;
+    using cbor_encode_options::max_stringrefs;
 
     cbor_options& max_nesting_depth(int value)
     {
@@ -99,6 +107,12 @@ public:
         return *this;
     }
 
+    cbor_options& max_stringrefs(std::size_t value)
+    {
+        this->max_stringrefs_ = value;
+        return *this;
+    }
+
 #if !defined(JSONCONS_NO_DEPRECATED)
     JSONCONS_DEPRECATED_MSG("Instead, use use_typed_arrays(bool)")
     cbor_options& enable_typed_arrays(bool value)
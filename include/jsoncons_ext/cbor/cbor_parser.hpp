@@ -19,6 +19,7 @@
 #include <jsoncons_ext/cbor/cbor_error.hpp>
 #include <jsoncons_ext/cbor/cbor_detail.hpp>
 #include <jsoncons_ext/cbor/cbor_options.hpp>
+#include <jsoncons_ext/cbor/cbor_stringref_table.hpp>
 #include <jsoncons/json_visitor2.hpp>
 
 namespace jsoncons { namespace cbor {
@@ -86,8 +87,6 @@ class basic_cbor_parser : public ser_context
     using byte_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<uint8_t>;                  
     using tag_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<uint64_t>;                 
     using parse_state_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<parse_state>;                         
-    using stringref_map = std::vector<mapped_string>;
-    using stringref_map_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<stringref_map>;                           
 
     using string_type = std::basic_string<char_type,char_traits_type,char_allocator_type>;
 
@@ -111,8 +110,9 @@ class basic_cbor_parser : public ser_context
     std::vector<uint8_t,byte_allocator_type> typed_array_;
     std::vector<std::size_t> shape_;
     std::size_t index_; // TODO: Never used!
-    std::vector<stringref_map,stringref_map_allocator_type> stringref_map_stack_;
+    jsoncons::cbor::detail::stringref_stack stringref_map_stack_;
     int nesting_depth_;
+    std::vector<std::size_t> skip_stack_; // items left in each skipped container, or max if ended by a break
 
     struct read_byte_string_from_buffer
     {
@@ -165,7 +165,6 @@ public:
          state_stack_(alloc),
          typed_array_(alloc),
          index_(0),
-         stringref_map_stack_(alloc),
          nesting_depth_(0)
     {
         state_stack_.emplace_back(parse_mode::root,0);
@@ -188,6 +187,7 @@ public:
         typed_array_.clear();
         stringref_map_stack_.clear();
         nesting_depth_ = 0;
+        skip_stack_.clear();
     }
 
     template <class Sourceable>
@@ -334,7 +334,194 @@ public:
             }
         }
     }
+
+    // Whether the items of the array or map just begun can be skipped with
+    // skip_container. Not if they may add to an enclosing stringref namespace.
+    bool can_skip_container() const
+    {
+        const parse_state& state = state_stack_.back();
+        switch (state.mode)
+        {
+            case parse_mode::array:
+            case parse_mode::indefinite_array:
+            case parse_mode::map_key:
+            case parse_mode::indefinite_map_key:
+                return stringref_map_stack_.empty() || state.pop_stringref_map_stack;
+            default:
+                return false;
+        }
+    }
+
+    // Skips the items of the array or map just begun, reading only the heads
+    // of the nested data items, and leaves the end of the container to parse
+    void skip_container(std::error_code& ec)
+    {
+        const std::size_t indefinite = (std::numeric_limits<std::size_t>::max)();
+
+        more_ = true;
+        parse_state& state = state_stack_.back();
+        skip_stack_.clear();
+        switch (state.mode)
+        {
+            case parse_mode::array:
+                skip_stack_.push_back(state.length - state.index);
+                state.index = state.length;
+                break;
+            case parse_mode::map_key:
+                skip_stack_.push_back(2*(state.length - state.index));
+                state.index = state.length;
+                break;
+            default:
+                skip_stack_.push_back(indefinite);
+                break;
+        }
+
+        while (!skip_stack_.empty())
+        {
+            if (skip_stack_.back() == indefinite)
+            {
+                auto c = source_.peek();
+                if (c.eof)
+                {
+                    ec = cbor_errc::unexpected_eof;
+                    more_ = false;
+                    return;
+                }
+                if (c.value == 0xff)
+                {
+                    if (skip_stack_.size() == 1)
+                    {
+                        return;
+                    }
+                    source_.ignore(1);
+                    skip_stack_.pop_back();
+                    continue;
+                }
+            }
+            else if (skip_stack_.back() == 0)
+            {
+                skip_stack_.pop_back();
+                continue;
+            }
+            else
+            {
+                --skip_stack_.back();
+            }
+            skip_item(ec);
+            if (!more_)
+            {
+                return;
+            }
+        }
+    }
 private:
+    struct skip_chunk
+    {
+        basic_cbor_parser<Source,Allocator>* parser;
+
+        bool operator()(Source&, std::size_t length, std::error_code& ec)
+        {
+            parser->skip_bytes(length, ec);
+            return parser->more_;
+        }
+    };
+
+    void skip_bytes(std::size_t length, std::error_code& ec)
+    {
+        std::size_t position = source_.position();
+        source_.ignore(length);
+        if (source_.position() - position < length)
+        {
+            ec = cbor_errc::unexpected_eof;
+            more_ = false;
+        }
+    }
+
+    // Skips a data item, or the head of an array or map, pushing its
+    // number of items onto skip_stack_
+    void skip_item(std::error_code& ec)
+    {
+        auto c = source_.peek();
+        while (!c.eof && get_major_type(c.value) == jsoncons::cbor::detail::cbor_major_type::semantic_tag)
+        {
+            get_uint64_value(ec);
+            if (!more_)
+            {
+                return;
+            }
+            c = source_.peek();
+        }
+        if (c.eof)
+        {
+            ec = cbor_errc::unexpected_eof;
+            more_ = false;
+            return;
+        }
+        jsoncons::cbor::detail::cbor_major_type major_type = get_major_type(c.value);
+        uint8_t info = get_additional_information_value(c.value);
+
+        switch (major_type)
+        {
+            case jsoncons::cbor::detail::cbor_major_type::byte_string:
+            case jsoncons::cbor::detail::cbor_major_type::text_string:
+            {
+                skip_chunk func{this};
+                iterate_string_chunks(func, major_type, ec);
+                break;
+            }
+            case jsoncons::cbor::detail::cbor_major_type::array:
+            case jsoncons::cbor::detail::cbor_major_type::map:
+            {
+                if (info == jsoncons::cbor::detail::additional_info::indefinite_length)
+                {
+                    source_.ignore(1);
+                    skip_stack_.push_back((std::numeric_limits<std::size_t>::max)());
+                }
+                else
+                {
+                    std::size_t len = get_size(ec);
+                    if (!more_)
+                    {
+                        return;
+                    }
+                    skip_stack_.push_back(major_type == jsoncons::cbor::detail::cbor_major_type::map ? 2*len : len);
+                }
+                break;
+            }
+            case jsoncons::cbor::detail::cbor_major_type::unsigned_integer:
+            case jsoncons::cbor::detail::cbor_major_type::negative_integer:
+            case jsoncons::cbor::detail::cbor_major_type::simple:
+                switch (info)
+                {
+                    case 0x18:
+                        skip_bytes(2, ec);
+                        break;
+                    case 0x19:
+                        skip_bytes(3, ec);
+                        break;
+                    case 0x1a:
+                        skip_bytes(5, ec);
+                        break;
+                    case 0x1b:
+                        skip_bytes(9, ec);
+                        break;
+                    case 0x1c:
+                    case 0x1d:
+                    case 0x1e:
+                    case jsoncons::cbor::detail::additional_info::indefinite_length:
+                        ec = cbor_errc::unknown_type;
+                        more_ = false;
+                        return;
+                    default:
+                        source_.ignore(1);
+                        break;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
     void read_item(json_visitor2& visitor, std::error_code& ec)
     {
         read_tags(ec);
@@ -364,25 +551,25 @@ private:
                 if (!stringref_map_stack_.empty() && other_tags_[stringref_tag])
                 {
                     other_tags_[stringref_tag] = false;
-                    if (val >= stringref_map_stack_.back().size())
+                    if (val >= stringref_map_stack_.size())
                     {
                         ec = cbor_errc::stringref_too_large;
                         more_ = false;
                         return;
                     }
-                    stringref_map::size_type index = (stringref_map::size_type)val;
+                    std::size_t index = (std::size_t)val;
                     if (index != val)
                     {
                         ec = cbor_errc::number_too_large;
                         more_ = false;
                         return;
                     }
-                    auto& str = stringref_map_stack_.back().at(index);
+                    const auto& str = stringref_map_stack_.at(index);
                     switch (str.type)
                     {
                         case jsoncons::cbor::detail::cbor_major_type::text_string:
                         {
-                            handle_string(visitor, jsoncons::basic_string_view<char>(str.s.data(),str.s.length()),ec);
+                            handle_string(visitor, jsoncons::basic_string_view<char>(reinterpret_cast<const char*>(str.data),str.length),ec);
                             if (ec)
                             {
                                 return;
@@ -391,7 +578,7 @@ private:
                         }
                         case jsoncons::cbor::detail::cbor_major_type::byte_string:
                         {
-                            read_byte_string_from_buffer read(byte_string_view(str.bytes));
+                            read_byte_string_from_buffer read(byte_string_view(str.data,str.length));
                             write_byte_string(read, visitor, ec);
                             if (ec)
                             {
@@ -599,7 +786,7 @@ private:
         bool pop_stringref_map_stack = false;
         if (other_tags_[stringref_namespace_tag])
         {
-            stringref_map_stack_.emplace_back(alloc_);
+            stringref_map_stack_.push_namespace();
             other_tags_[stringref_namespace_tag] = false;
             pop_stringref_map_stack = true;
         }
@@ -633,7 +820,7 @@ private:
         more_ = visitor.end_array(*this, ec);
         if (state_stack_.back().pop_stringref_map_stack)
         {
-            stringref_map_stack_.pop_back();
+            stringref_map_stack_.pop_namespace();
         }
         state_stack_.pop_back();
     }
@@ -649,7 +836,7 @@ private:
         bool pop_stringref_map_stack = false;
         if (other_tags_[stringref_namespace_tag])
         {
-            stringref_map_stack_.emplace_back(alloc_);
+            stringref_map_stack_.push_namespace();
             other_tags_[stringref_namespace_tag] = false;
             pop_stringref_map_stack = true;
         }
@@ -682,7 +869,7 @@ private:
         more_ = visitor.end_object(*this, ec);
         if (state_stack_.back().pop_stringref_map_stack)
         {
-            stringref_map_stack_.pop_back();
+            stringref_map_stack_.pop_namespace();
         }
         state_stack_.pop_back();
     }
@@ -712,9 +899,10 @@ private:
         iterate_string_chunks(func, major_type, ec);
         if (!stringref_map_stack_.empty() && 
             info != jsoncons::cbor::detail::additional_info::indefinite_length &&
-            s.length() >= jsoncons::cbor::detail::min_length_for_stringref(stringref_map_stack_.back().size()))
+            s.length() >= jsoncons::cbor::detail::min_length_for_stringref(stringref_map_stack_.size()))
         {
-            stringref_map_stack_.back().emplace_back(s);
+            stringref_map_stack_.push_back(jsoncons::cbor::detail::cbor_major_type::text_string, 
+                                           reinterpret_cast<const uint8_t*>(s.data()), s.length());
         }
     }
 
@@ -782,9 +970,9 @@ private:
                     return more;
                 }
                 if (!stringref_map_stack_.empty() &&
-                    v.size() >= jsoncons::cbor::detail::min_length_for_stringref(stringref_map_stack_.back().size()))
+                    v.size() >= jsoncons::cbor::detail::min_length_for_stringref(stringref_map_stack_.size()))
                 {
-                    stringref_map_stack_.back().emplace_back(v);
+                    stringref_map_stack_.push_back(jsoncons::cbor::detail::cbor_major_type::byte_string, v.data(), v.size());
                 }
                 break;
             }
@@ -0,0 +1,269 @@
+// Copyright 2022 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_CBOR_CBOR_STRINGREF_TABLE_HPP
+#define JSONCONS_CBOR_CBOR_STRINGREF_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy, std::memcmp
+#include <limits> // std::numeric_limits
+#include <memory> // std::allocator_traits
+#include <vector>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/arena_allocator.hpp>
+#include <jsoncons_ext/cbor/cbor_detail.hpp>
+
+namespace jsoncons { namespace cbor { namespace detail {
+
+    // Copies of the strings in stringref tables, packed into blocks allocated
+    // from an arena. The copies live until clear() or the destructor.
+
+    class stringref_storage
+    {
+        static constexpr std::size_t initial_block_size = 1024;
+        static constexpr std::size_t max_block_size = 1024*1024;
+
+        arena arena_;
+        uint8_t* current_;
+        uint8_t* end_;
+        std::size_t block_size_;
+    public:
+        stringref_storage() noexcept
+            : current_(nullptr), end_(nullptr), block_size_(initial_block_size)
+        {
+        }
+
+        stringref_storage(const stringref_storage&) = delete;
+        stringref_storage& operator=(const stringref_storage&) = delete;
+
+        const uint8_t* store(const uint8_t* data, std::size_t length)
+        {
+            if (length > static_cast<std::size_t>(end_ - current_))
+            {
+                std::size_t size = length > block_size_ ? length : block_size_;
+                current_ = static_cast<uint8_t*>(arena_.allocate(size, 1));
+                end_ = current_ + size;
+                if (block_size_ < max_block_size)
+                {
+                    block_size_ *= 2;
+                }
+            }
+            uint8_t* p = current_;
+            if (length > 0)
+            {
+                std::memcpy(p, data, length);
+            }
+            current_ += length;
+            return p;
+        }
+
+        void clear() noexcept
+        {
+            arena_.release();
+            current_ = nullptr;
+            end_ = nullptr;
+            block_size_ = initial_block_size;
+        }
+    };
+
+    // Maps the text and byte strings written by a cbor encoder in pack_strings mode
+    // to their stringref indexes. An open addressing hash table with linear probing,
+    // the strings are copied into a stringref_storage. Once max_size strings are
+    // held, further strings are not added.
+
+    template <class Allocator>
+    class stringref_table
+    {
+        struct slot
+        {
+            const uint8_t* data;
+            std::size_t length;
+            uint64_t ref;
+            uint32_t hash;
+            cbor_major_type type;
+        };
+
+        using slot_allocator_type = typename std::allocator_traits<Allocator>:: template rebind_alloc<slot>;
+
+        static constexpr uint64_t empty_ref = (std::numeric_limits<uint64_t>::max)();
+        static constexpr std::size_t min_capacity = 64;
+
+        std::vector<slot,slot_allocator_type> slots_;
+        std::size_t size_;
+        std::size_t max_size_;
+        stringref_storage storage_;
+    public:
+        explicit stringref_table(std::size_t max_size = (std::numeric_limits<std::size_t>::max)(),
+                                 const Allocator& alloc = Allocator())
+            : slots_(slot_allocator_type(alloc)), size_(0), max_size_(max_size)
+        {
+        }
+
+        stringref_table(const stringref_table&) = delete;
+        stringref_table& operator=(const stringref_table&) = delete;
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        // If the table has a string of this type equal to [data, data+length), sets
+        // ref to its index and returns true. Otherwise adds the string with index
+        // next_ref, if there is room, and returns false.
+        bool find_or_insert(cbor_major_type type, const uint8_t* data, std::size_t length,
+                            uint64_t next_ref, uint64_t& ref)
+        {
+            if (slots_.empty())
+            {
+                if (max_size_ == 0)
+                {
+                    return false;
+                }
+                slots_.assign(min_capacity, slot{nullptr, 0, empty_ref, 0, type});
+            }
+            const uint32_t h = hash(type, data, length);
+            const std::size_t mask = slots_.size() - 1;
+            std::size_t i = h & mask;
+            while (slots_[i].ref != empty_ref)
+            {
+                const slot& s = slots_[i];
+                if (s.hash == h && s.type == type && s.length == length &&
+                    (length == 0 || std::memcmp(s.data, data, length) == 0))
+                {
+                    ref = s.ref;
+                    return true;
+                }
+                i = (i + 1) & mask;
+            }
+            if (size_ < max_size_)
+            {
+                slots_[i] = slot{storage_.store(data, length), length, next_ref, h, type};
+                ++size_;
+                if (2*size_ > slots_.size())
+                {
+                    grow();
+                }
+            }
+            return false;
+        }
+
+        void clear() noexcept
+        {
+            slots_.clear();
+            size_ = 0;
+            storage_.clear();
+        }
+    private:
+        static uint32_t hash(cbor_major_type type, const uint8_t* data, std::size_t length) noexcept
+        {
+            // FNV-1a, followed by a finalizer to spread the high bits into the
+            // low bits used for the slot
+            uint32_t h = 2166136261u ^ static_cast<uint32_t>(type);
+            h *= 16777619u;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                h ^= data[i];
+                h *= 16777619u;
+            }
+            h ^= h >> 16;
+            h *= 0x85ebca6bu;
+            h ^= h >> 13;
+            return h;
+        }
+
+        void grow()
+        {
+            std::vector<slot,slot_allocator_type> old(slots_.get_allocator());
+            old.swap(slots_);
+            slots_.assign(2*old.size(), slot{nullptr, 0, empty_ref, 0, cbor_major_type::text_string});
+            const std::size_t mask = slots_.size() - 1;
+            for (const auto& s : old)
+            {
+                if (s.ref != empty_ref)
+                {
+                    std::size_t i = s.hash & mask;
+                    while (slots_[i].ref != empty_ref)
+                    {
+                        i = (i + 1) & mask;
+                    }
+                    slots_[i] = s;
+                }
+            }
+        }
+    };
+
+    // The strings of the stringref namespaces open in a cbor parser. The strings
+    // of a namespace follow those of the namespace that encloses it.
+
+    class stringref_stack
+    {
+    public:
+        struct entry
+        {
+            cbor_major_type type;
+            const uint8_t* data;
+            std::size_t length;
+        };
+    private:
+        std::vector<entry> entries_;
+        std::vector<std::size_t> namespaces_;
+        stringref_storage storage_;
+    public:
+        stringref_stack() = default;
+
+        stringref_stack(const stringref_stack&) = delete;
+        stringref_stack& operator=(const stringref_stack&) = delete;
+
+        bool empty() const noexcept
+        {
+            return namespaces_.empty();
+        }
+
+        // The number of strings in the innermost namespace
+        std::size_t size() const noexcept
+        {
+            return entries_.size() - namespaces_.back();
+        }
+
+        const entry& at(std::size_t index) const
+        {
+            return entries_[namespaces_.back() + index];
+        }
+
+        void push_namespace()
+        {
+            namespaces_.push_back(entries_.size());
+        }
+
+        void pop_namespace()
+        {
+            entries_.resize(namespaces_.back());
+            namespaces_.pop_back();
+            if (namespaces_.empty())
+            {
+                storage_.clear();
+            }
+        }
+
+        void push_back(cbor_major_type type, const uint8_t* data, std::size_t length)
+        {
+            entries_.push_back(entry{type, storage_.store(data, length), length});
+        }
+
+        void clear() noexcept
+        {
+            entries_.clear();
+            namespaces_.clear();
+            storage_.clear();
+        }
+    };
+
+} // namespace detail
+} // namespace cbor
+} // namespace jsoncons
+
+#endif
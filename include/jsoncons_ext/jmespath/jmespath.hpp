@@ -18,11 +18,18 @@
 #include <algorithm> // std::stable_sort, std::reverse
 #include <cmath> // std::abs
 #include <jsoncons/json.hpp>
+#include <jsoncons/detail/object_pool.hpp>
 #include <jsoncons_ext/jmespath/jmespath_error.hpp>
 
 namespace jsoncons { 
 namespace jmespath {
 
+    template <class Json,class JsonReference = const Json&>
+    class search_result;
+
+    template <class Json,class JsonReference = const Json&>
+    class evaluation_context;
+
     enum class operator_kind
     {
         default_op, // Identifier, CurrentNode, Index, MultiSelectList, MultiSelectHash, FunctionExpression
@@ -382,13 +389,37 @@ namespace jmespath {
         using pointer = typename std::conditional<std::is_const<typename std::remove_reference<JsonReference>::type>::value,typename Json::const_pointer,typename Json::pointer>::type;
         typedef typename Json::const_pointer const_pointer;
 
-        std::vector<std::unique_ptr<Json>> temp_storage_;
+        jsoncons::detail::object_pool<Json> temp_storage_;
 
     public:
+        dynamic_resources() = default;
+        dynamic_resources(const dynamic_resources&) = delete;
+        dynamic_resources(dynamic_resources&&) = default;
+
         ~dynamic_resources()
         {
         }
 
+        dynamic_resources& operator=(const dynamic_resources&) = delete;
+        dynamic_resources& operator=(dynamic_resources&&) = default;
+
+        // Destroys the temporaries of the last evaluation, keeping their
+        // storage, so that the resources can be used for another evaluation
+        void reset() noexcept
+        {
+            temp_storage_.clear();
+        }
+
+        std::size_t temp_count() const noexcept
+        {
+            return temp_storage_.size();
+        }
+
+        std::size_t block_count() const noexcept
+        {
+            return temp_storage_.block_count();
+        }
+
         reference number_type_name() 
         {
             static Json number_type_name(JSONCONS_STRING_CONSTANT(char_type, "number"));
@@ -452,10 +483,7 @@ namespace jmespath {
         template <typename... Args>
         Json* create_json(Args&& ... args)
         {
-            auto temp = jsoncons::make_unique<Json>(std::forward<Args>(args)...);
-            Json* ptr = temp.get();
-            temp_storage_.emplace_back(std::move(temp));
-            return ptr;
+            return temp_storage_.create(std::forward<Args>(args)...);
         }
     };
 
@@ -3380,6 +3408,54 @@ namespace jmespath {
                 return deep_copy(*evaluate_tokens(doc, output_stack_, dynamic_storage, ec));
             }
 
+            Json evaluate(evaluation_context<Json,JsonReference>& context, reference doc)
+            {
+                std::error_code ec;
+                Json result = evaluate(context, doc, ec);
+                if (ec)
+                {
+                    JSONCONS_THROW(jmespath_error(ec));
+                }
+                return result;
+            }
+
+            Json evaluate(evaluation_context<Json,JsonReference>& context, reference doc, std::error_code& ec)
+            {
+                if (output_stack_.empty())
+                {
+                    return Json::null();
+                }
+                context.resources_.reset();
+                return deep_copy(*evaluate_tokens(doc, output_stack_, context.resources_, ec));
+            }
+
+            search_result<Json,JsonReference> evaluate_view(reference doc)
+            {
+                std::error_code ec;
+                auto result = evaluate_view(doc, ec);
+                if (ec)
+                {
+                    JSONCONS_THROW(jmespath_error(ec));
+                }
+                return result;
+            }
+
+            search_result<Json,JsonReference> evaluate_view(reference doc, std::error_code& ec)
+            {
+                dynamic_resources<Json,JsonReference> dynamic_storage;
+                if (output_stack_.empty())
+                {
+                    pointer ptr = std::addressof(dynamic_storage.null_value());
+                    return search_result<Json,JsonReference>(std::move(dynamic_storage), ptr);
+                }
+                pointer ptr = evaluate_tokens(doc, output_stack_, dynamic_storage, ec);
+                if (ec)
+                {
+                    ptr = std::addressof(dynamic_storage.null_value());
+                }
+                return search_result<Json,JsonReference>(std::move(dynamic_storage), ptr);
+            }
+
             static jmespath_expression compile(const string_view_type& expr)
             {
                 jsoncons::jmespath::detail::jmespath_evaluator<Json,const Json&> evaluator;
@@ -5157,6 +5233,88 @@ namespace jmespath {
 
     } // detail
 
+    // The result of jmespath_expression::evaluate_view. Values selected from the
+    // document are not copied, the result refers to them in place. Values computed
+    // during evaluation, such as function results and projections, are owned by
+    // the search_result. The document and the expression must outlive it.
+
+    template <class Json,class JsonReference>
+    class search_result
+    {
+        using pointer = typename std::conditional<std::is_const<typename std::remove_reference<JsonReference>::type>::value,typename Json::const_pointer,typename Json::pointer>::type;
+
+        detail::dynamic_resources<Json,JsonReference> resources_;
+        pointer value_;
+    public:
+        search_result(detail::dynamic_resources<Json,JsonReference>&& resources, pointer value)
+            : resources_(std::move(resources)), value_(value)
+        {
+        }
+
+        search_result(const search_result&) = delete;
+        search_result(search_result&&) = default;
+
+        search_result& operator=(const search_result&) = delete;
+        search_result& operator=(search_result&&) = default;
+
+        const Json& value() const
+        {
+            return *value_;
+        }
+
+        const Json& operator*() const
+        {
+            return *value_;
+        }
+
+        const Json* operator->() const
+        {
+            return value_;
+        }
+
+        // Returns a copy of the result that does not depend on the document
+        Json materialize() const
+        {
+            return deep_copy(*value_);
+        }
+    };
+
+    // Holds the temporaries created while evaluating an expression, so that their
+    // storage can be reused by later evaluations. Not thread safe, use one per thread.
+
+    template <class Json,class JsonReference>
+    class evaluation_context
+    {
+        friend class detail::jmespath_evaluator<Json,JsonReference>;
+
+        detail::dynamic_resources<Json,JsonReference> resources_;
+    public:
+        evaluation_context() = default;
+        evaluation_context(const evaluation_context&) = delete;
+        evaluation_context(evaluation_context&&) = default;
+
+        evaluation_context& operator=(const evaluation_context&) = delete;
+        evaluation_context& operator=(evaluation_context&&) = default;
+
+        // Destroys the temporaries of the last evaluation
+        void reset() noexcept
+        {
+            resources_.reset();
+        }
+
+        // The number of temporaries created by the last evaluation
+        std::size_t temp_count() const noexcept
+        {
+            return resources_.temp_count();
+        }
+
+        // The number of blocks of storage for temporaries allocated by this context
+        std::size_t allocation_count() const noexcept
+        {
+            return resources_.block_count();
+        }
+    };
+
     template <class Json>
     using jmespath_expression = typename jsoncons::jmespath::detail::jmespath_evaluator<Json,const Json&>::jmespath_expression;
 
@@ -0,0 +1,90 @@
+// Copyright 2022 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSONPATCH_DIFF_OPTIONS_HPP
+#define JSONCONS_JSONPATCH_DIFF_OPTIONS_HPP
+
+#include <cstddef>
+#include <string>
+#include <jsoncons/config/jsoncons_config.hpp>
+
+namespace jsoncons { namespace jsonpatch {
+
+enum class array_diff_kind : uint8_t
+{
+    by_position, // compare elements at the same index
+    lcs          // match elements with a longest common subsequence
+};
+
+template <class CharT>
+class basic_diff_options
+{
+public:
+    using char_type = CharT;
+    using string_type = std::basic_string<CharT>;
+
+    static constexpr std::size_t default_max_edit_distance = 1000;
+private:
+    array_diff_kind array_diff_;
+    std::size_t max_edit_distance_;
+    string_type identity_key_;
+public:
+    basic_diff_options()
+        : array_diff_(array_diff_kind::by_position),
+          max_edit_distance_(default_max_edit_distance)
+    {
+    }
+
+    basic_diff_options(const basic_diff_options&) = default;
+    basic_diff_options(basic_diff_options&&) = default;
+    basic_diff_options& operator=(const basic_diff_options&) = default;
+    basic_diff_options& operator=(basic_diff_options&&) = default;
+
+    array_diff_kind array_diff() const
+    {
+        return array_diff_;
+    }
+
+    basic_diff_options& array_diff(array_diff_kind value)
+    {
+        array_diff_ = value;
+        return *this;
+    }
+
+    // With array_diff_kind::lcs, the most elements that may be added and removed
+    // between two arrays before falling back to comparing by position. Time is
+    // O((n+m)*d) and memory O(d*d) for arrays of sizes n and m with d edits.
+    std::size_t max_edit_distance() const
+    {
+        return max_edit_distance_;
+    }
+
+    basic_diff_options& max_edit_distance(std::size_t value)
+    {
+        max_edit_distance_ = value;
+        return *this;
+    }
+
+    // If not empty, arrays whose elements are all objects with a unique value
+    // for this member are diffed by matching elements with equal values.
+    const string_type& identity_key() const
+    {
+        return identity_key_;
+    }
+
+    basic_diff_options& identity_key(const string_type& value)
+    {
+        identity_key_ = value;
+        return *this;
+    }
+};
+
+using diff_options = basic_diff_options<char>;
+using wdiff_options = basic_diff_options<wchar_t>;
+
+}}
+
+#endif
@@ -10,11 +10,15 @@
 #include <string>
 #include <vector> 
 #include <memory>
-#include <algorithm> // std::min
+#include <map>
+#include <limits> // std::numeric_limits
+#include <functional> // std::less, std::reference_wrapper
+#include <algorithm> // std::min, std::reverse, std::lower_bound
 #include <utility> // std::move
 #include <jsoncons/json.hpp>
 #include <jsoncons_ext/jsonpointer/jsonpointer.hpp>
 #include <jsoncons_ext/jsonpatch/jsonpatch_error.hpp>
+#include <jsoncons_ext/jsonpatch/diff_options.hpp>
 
 namespace jsoncons { namespace jsonpatch {
 
@@ -80,482 +84,1086 @@ namespace detail {
         }
     };
 
-    template<class Json>
-    jsonpointer::basic_json_pointer<typename Json::char_type> definite_path(const Json& root, jsonpointer::basic_json_pointer<typename Json::char_type>& location)
+    // Applies the operations of a JSON Patch in place. The patch is parsed 
+    // before the document is touched. The parent nodes resolved for the last
+    // operation are kept, so that an operation that shares a prefix with the
+    // one before it resolves only the rest of its path. Each change is recorded
+    // in an undo log, holding the values that were removed or replaced, and 
+    // the log is played back in reverse if an operation fails or throws.
+
+    template <class Json>
+    class patch_applier
     {
         using char_type = typename Json::char_type;
         using string_type = std::basic_string<char_type>;
+        using json_pointer_type = jsonpointer::basic_json_pointer<char_type>;
+        using token_list = std::vector<string_type>;
 
-        auto rit = location.rbegin();
-        if (rit == location.rend())
-        {
-            return location;
-        }
-
-        if (*rit != jsonpatch_names<char_type>::dash_name())
-        {
-            return location;
-        }
-
-        std::vector<string_type> tokens;
-        for (auto it = location.begin(); it != location.rbegin().base()-1; ++it)
-        {
-            tokens.push_back(*it);
-        }
-        jsonpointer::basic_json_pointer<char_type> pointer(tokens);
+        static constexpr std::size_t npos = (std::numeric_limits<std::size_t>::max)();
 
-        std::error_code ec;
+        enum class op_kind {none,test,add,remove,replace,move,copy};
 
-        Json val = jsonpointer::get(root, pointer, ec);
-        if (ec || !val.is_array())
+        struct operation
         {
-            return location;
-        }
-        string_type last_token;
-        jsoncons::detail::from_integer(val.size(), last_token);
-        tokens.emplace_back(std::move(last_token));
-
-        return jsonpointer::basic_json_pointer<char_type>(std::move(tokens));
-    }
+            op_kind kind;
+            token_list path;
+            token_list from;
+            const Json* value;
 
-    enum class op_type {add,remove,replace};
-    enum class state_type {begin,abort,commit};
+            operation()
+                : kind(op_kind::none), value(nullptr)
+            {
+            }
+        };
 
-    template <class Json>
-    struct operation_unwinder
-    {
-        using char_type = typename Json::char_type;
-        using string_type = std::basic_string<char_type>;
-        using json_pointer_type = jsonpointer::basic_json_pointer<char_type>;
+        enum class undo_kind {add,remove,replace};
 
-        struct entry
+        // Undoes a change at a location. For an array element, index is the position 
+        // of the element. If carried is set, the value comes from, or goes to, the 
+        // carried slot rather than the entry, which lets a move be undone without 
+        // copying the moved value.
+        struct undo_entry
         {
-            op_type op;
-            json_pointer_type path;
+            undo_kind kind;
+            const token_list* path;
+            std::size_t index;
+            bool carried;
             Json value;
 
-            entry(op_type op, const json_pointer_type& path, const Json& value)
-                : op(op), path(path), value(value)
+            undo_entry(undo_kind kind, const token_list* path, std::size_t index, bool carried, Json&& value)
+                : kind(kind), path(path), index(index), carried(carried), value(std::move(value))
             {
             }
+        };
 
-            entry(const entry&) = default;
+        // Plays back the undo log on destruction, unless dismissed
+        class rollback_guard
+        {
+            patch_applier* applier_;
+        public:
+            explicit rollback_guard(patch_applier& applier)
+                : applier_(std::addressof(applier))
+            {
+            }
 
-            entry(entry&&) = default;
+            rollback_guard(const rollback_guard&) = delete;
+            rollback_guard& operator=(const rollback_guard&) = delete;
 
-            entry& operator=(const entry&) = default;
+            ~rollback_guard() noexcept
+            {
+                if (applier_ != nullptr)
+                {
+                    applier_->undo();
+                }
+            }
 
-            entry& operator=(entry&&) = default;
+            void dismiss() noexcept
+            {
+                applier_ = nullptr;
+            }
         };
 
-        Json& target;
-        state_type state;
-        std::vector<entry> stack;
+        Json& target_;
+        std::vector<operation> operations_;
+        std::vector<undo_entry> undo_log_;
+        Json carried_;
 
-        operation_unwinder(Json& j)
-            : target(j), state(state_type::begin)
+        // cached_nodes_[i] is the node at the first i tokens of cached_path_
+        std::vector<const string_type*> cached_path_;
+        std::vector<Json*> cached_nodes_;
+    public:
+        explicit patch_applier(Json& target)
+            : target_(target)
         {
         }
 
-        ~operation_unwinder() noexcept
+        patch_applier(const patch_applier&) = delete;
+        patch_applier& operator=(const patch_applier&) = delete;
+
+        void apply(const Json& patch, std::error_code& ec)
         {
-            std::error_code ec;
-            if (state != state_type::commit)
+            parse(patch, ec);
+            if (ec)
+            {
+                return;
+            }
+            // A move logs two changes, the others at most one, so that recording
+            // a change never reallocates the log
+            undo_log_.reserve(2*operations_.size());
+            rollback_guard guard(*this);
+            for (const auto& op : operations_)
+            {
+                execute(op, ec);
+                if (ec)
+                {
+                    return;
+                }
+            }
+            guard.dismiss();
+            undo_log_.clear();
+        }
+
+    private:
+        void parse(const Json& patch, std::error_code& ec)
+        {
+            operations_.reserve(patch.size());
+            for (const auto& item : patch.array_range())
             {
-                for (auto it = stack.rbegin(); it != stack.rend(); ++it)
+                operations_.emplace_back();
+                operation& op = operations_.back();
+
+                auto it_op = item.find(jsonpatch_names<char_type>::op_name());
+                if (it_op == item.object_range().end())
+                {
+                    ec = jsonpatch_errc::invalid_patch;
+                    return;
+                }
+                string_type name = it_op->value().template as<string_type>();
+                if (name == jsonpatch_names<char_type>::test_name())
+                {
+                    op.kind = op_kind::test;
+                }
+                else if (name == jsonpatch_names<char_type>::add_name())
+                {
+                    op.kind = op_kind::add;
+                }
+                else if (name == jsonpatch_names<char_type>::remove_name())
+                {
+                    op.kind = op_kind::remove;
+                }
+                else if (name == jsonpatch_names<char_type>::replace_name())
+                {
+                    op.kind = op_kind::replace;
+                }
+                else if (name == jsonpatch_names<char_type>::move_name())
+                {
+                    op.kind = op_kind::move;
+                }
+                else if (name == jsonpatch_names<char_type>::copy_name())
+                {
+                    op.kind = op_kind::copy;
+                }
+
+                auto it_path = item.find(jsonpatch_names<char_type>::path_name());
+                if (it_path == item.object_range().end() || 
+                    !parse_pointer(it_path->value().template as<string_type>(), op.path))
+                {
+                    ec = jsonpatch_errc::invalid_patch;
+                    return;
+                }
+
+                switch (op.kind)
                 {
-                    if (it->op == op_type::add)
+                    case op_kind::test:
+                    case op_kind::add:
+                    case op_kind::replace:
                     {
-                        jsonpointer::add(target,it->path,it->value,ec);
-                        if (ec)
+                        auto it_value = item.find(jsonpatch_names<char_type>::value_name());
+                        if (it_value == item.object_range().end())
                         {
-                            //std::cout << "add: " << it->path << std::endl;
-                            break;
+                            ec = jsonpatch_errc::invalid_patch;
+                            return;
                         }
+                        op.value = std::addressof(it_value->value());
+                        break;
                     }
-                    else if (it->op == op_type::remove)
+                    case op_kind::move:
+                    case op_kind::copy:
                     {
-                        jsonpointer::remove(target,it->path,ec);
-                        if (ec)
+                        auto it_from = item.find(jsonpatch_names<char_type>::from_name());
+                        if (it_from == item.object_range().end())
                         {
-                            //std::cout << "remove: " << it->path << std::endl;
-                            break;
+                            ec = jsonpatch_errc::invalid_patch;
+                            return;
                         }
-                    }
-                    else if (it->op == op_type::replace)
-                    {
-                        jsonpointer::replace(target,it->path,it->value,ec);
-                        if (ec)
+                        if (!parse_pointer(it_from->value().template as<string_type>(), op.from))
                         {
-                            //std::cout << "replace: " << it->path << std::endl;
-                            break;
+                            ec = op.kind == op_kind::move ? jsonpatch_errc::move_failed : jsonpatch_errc::copy_failed;
+                            return;
                         }
+                        break;
                     }
+                    default:
+                        break;
                 }
             }
         }
-    };
 
-    template <class Json>
-    Json from_diff(const Json& source, const Json& target, const typename Json::string_view_type& path)
-    {
-        using char_type = typename Json::char_type;
+        static bool parse_pointer(const string_type& s, token_list& tokens)
+        {
+            std::error_code ec;
+            auto location = json_pointer_type::parse(s, ec);
+            if (ec)
+            {
+                return false;
+            }
+            tokens.assign(location.begin(), location.end());
+            return true;
+        }
+
+        void execute(const operation& op, std::error_code& ec)
+        {
+            switch (op.kind)
+            {
+                case op_kind::test:
+                {
+                    Json* val = resolve(op.path);
+                    if (val == nullptr || *val != *(op.value))
+                    {
+                        ec = jsonpatch_errc::test_failed;
+                    }
+                    break;
+                }
+                case op_kind::add:
+                    if (!add(op.path, Json(*(op.value)), false))
+                    {
+                        ec = jsonpatch_errc::add_failed;
+                    }
+                    break;
+                case op_kind::remove:
+                    if (!remove(op.path, false))
+                    {
+                        ec = jsonpatch_errc::remove_failed;
+                    }
+                    break;
+                case op_kind::replace:
+                {
+                    Json* val = resolve(op.path);
+                    if (val == nullptr)
+                    {
+                        ec = jsonpatch_errc::replace_failed;
+                        break;
+                    }
+                    Json old_value(*(op.value));
+                    val->swap(old_value);
+                    undo_log_.emplace_back(undo_kind::replace, std::addressof(op.path), npos, false, std::move(old_value));
+                    break;
+                }
+                case op_kind::move:
+                    if (!remove(op.from, true))
+                    {
+                        ec = jsonpatch_errc::move_failed;
+                    }
+                    else if (!add(op.path, std::move(carried_), true))
+                    {
+                        ec = jsonpatch_errc::copy_failed;
+                    }
+                    break;
+                case op_kind::copy:
+                {
+                    Json* val = resolve(op.from);
+                    if (val == nullptr || !add(op.path, Json(*val), false))
+                    {
+                        ec = jsonpatch_errc::copy_failed;
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
 
-        Json result = typename Json::array();
+        // Returns the node at the first count tokens of path, reusing the nodes 
+        // resolved for the previous path as far as the two paths agree. Afterwards
+        // the cache holds no node below the returned node, so that changes made 
+        // to its members leave the cache valid.
+        Json* resolve_prefix(const token_list& path, std::size_t count)
+        {
+            std::size_t common = 0;
+            while (common < cached_path_.size() && common < count && *cached_path_[common] == path[common])
+            {
+                ++common;
+            }
+            cached_path_.resize(common);
+            if (cached_nodes_.empty())
+            {
+                cached_nodes_.push_back(std::addressof(target_));
+            }
+            cached_nodes_.resize(common + 1);
 
-        if (source == target)
+            for (std::size_t i = common; i < count; ++i)
+            {
+                std::error_code ec;
+                Json* node = jsonpointer::detail::resolve(cached_nodes_.back(), path[i], false, ec);
+                if (ec)
+                {
+                    return nullptr;
+                }
+                cached_path_.push_back(std::addressof(path[i]));
+                cached_nodes_.push_back(node);
+            }
+            return cached_nodes_.back();
+        }
+
+        Json* resolve_parent(const token_list& path)
         {
-            return result;
+            return resolve_prefix(path, path.size() - 1);
         }
 
-        if (source.is_array() && target.is_array())
+        Json* resolve(const token_list& path)
         {
-            std::size_t common = (std::min)(source.size(),target.size());
-            for (std::size_t i = 0; i < common; ++i)
-            {
-                std::basic_string<char_type> ss(path); 
-                ss.push_back('/');
-                jsoncons::detail::from_integer(i,ss);
-                auto temp_diff = from_diff(source[i],target[i],ss);
-                result.insert(result.array_range().end(),temp_diff.array_range().begin(),temp_diff.array_range().end());
-            }
-            // Element in source, not in target - remove
-            for (std::size_t i = source.size(); i-- > target.size();)
-            {
-                std::basic_string<char_type> ss(path); 
-                ss.push_back('/');
-                jsoncons::detail::from_integer(i,ss);
-                Json val(json_object_arg);
-                val.insert_or_assign(jsonpatch_names<char_type>::op_name(), jsonpatch_names<char_type>::remove_name());
-                val.insert_or_assign(jsonpatch_names<char_type>::path_name(), ss);
-                result.push_back(std::move(val));
-            }
-            // Element in target, not in source - add, 
-            // Fix contributed by Alexander rog13
-            for (std::size_t i = source.size(); i < target.size(); ++i)
-            {
-                const auto& a = target[i];
-                std::basic_string<char_type> ss(path); 
-                ss.push_back('/');
-                jsoncons::detail::from_integer(i,ss);
-                Json val(json_object_arg);
-                val.insert_or_assign(jsonpatch_names<char_type>::op_name(), jsonpatch_names<char_type>::add_name());
-                val.insert_or_assign(jsonpatch_names<char_type>::path_name(), ss);
-                val.insert_or_assign(jsonpatch_names<char_type>::value_name(), a);
-                result.push_back(std::move(val));
+            if (path.empty())
+            {
+                cached_path_.clear();
+                cached_nodes_.clear();
+                return std::addressof(target_);
+            }
+            Json* parent = resolve_parent(path);
+            if (parent == nullptr)
+            {
+                return nullptr;
             }
+            return resolve_child(parent, path.back());
         }
-        else if (source.is_object() && target.is_object())
+
+        static Json* resolve_child(Json* parent, const string_type& token)
         {
-            for (const auto& a : source.object_range())
+            std::error_code ec;
+            Json* node = jsonpointer::detail::resolve(parent, token, false, ec);
+            return ec ? nullptr : node;
+        }
+
+        static bool array_index(const Json& parent, const string_type& token, bool allow_end, std::size_t& index)
+        {
+            if (token.size() == 1 && token[0] == '-')
             {
-                std::basic_string<char_type> ss(path);
-                ss.push_back('/'); 
-                jsonpointer::escape(a.key(),ss);
-                auto it = target.find(a.key());
-                if (it != target.object_range().end())
+                index = parent.size();
+                return allow_end;
+            }
+            auto result = jsoncons::detail::to_integer_decimal(token.data(), token.size(), index);
+            if (!result)
+            {
+                return false;
+            }
+            return allow_end ? index <= parent.size() : index < parent.size();
+        }
+
+        // Adds value at path, replacing an existing object member
+        bool add(const token_list& path, Json&& value, bool carried)
+        {
+            if (path.empty())
+            {
+                resolve(path);
+                target_.swap(value);
+                undo_log_.emplace_back(undo_kind::replace, std::addressof(path), npos, carried, std::move(value));
+                return true;
+            }
+            Json* parent = resolve_parent(path);
+            if (parent == nullptr)
+            {
+                return false;
+            }
+            if (parent->is_array())
+            {
+                std::size_t index{0};
+                if (!array_index(*parent, path.back(), true, index))
                 {
-                    auto temp_diff = from_diff(a.value(),it->value(),ss);
-                    result.insert(result.array_range().end(),temp_diff.array_range().begin(),temp_diff.array_range().end());
+                    return false;
+                }
+                parent->insert(parent->array_range().begin() + index, std::move(value));
+                undo_log_.emplace_back(undo_kind::remove, std::addressof(path), index, carried, Json());
+            }
+            else if (parent->is_object())
+            {
+                auto it = parent->find(path.back());
+                if (it != parent->object_range().end())
+                {
+                    it->value().swap(value);
+                    undo_log_.emplace_back(undo_kind::replace, std::addressof(path), npos, carried, std::move(value));
                 }
                 else
                 {
-                    Json val(json_object_arg);
-                    val.insert_or_assign(jsonpatch_names<char_type>::op_name(), jsonpatch_names<char_type>::remove_name());
-                    val.insert_or_assign(jsonpatch_names<char_type>::path_name(), ss);
-                    result.push_back(std::move(val));
+                    parent->try_emplace(path.back(), std::move(value));
+                    undo_log_.emplace_back(undo_kind::remove, std::addressof(path), npos, carried, Json());
                 }
             }
-            for (const auto& a : target.object_range())
+            else
             {
-                auto it = source.find(a.key());
-                if (it == source.object_range().end())
+                return false;
+            }
+            return true;
+        }
+
+        // Removes the value at path. If carried is set, the value is moved to 
+        // the carried slot, otherwise to the undo log.
+        bool remove(const token_list& path, bool carried)
+        {
+            if (path.empty())
+            {
+                return false;
+            }
+            Json* parent = resolve_parent(path);
+            if (parent == nullptr)
+            {
+                return false;
+            }
+            Json removed;
+            std::size_t index = npos;
+            if (parent->is_array())
+            {
+                if (!array_index(*parent, path.back(), false, index))
                 {
-                    std::basic_string<char_type> ss(path); 
-                    ss.push_back('/');
-                    jsonpointer::escape(a.key(),ss);
-                    Json val(json_object_arg);
-                    val.insert_or_assign(jsonpatch_names<char_type>::op_name(), jsonpatch_names<char_type>::add_name());
-                    val.insert_or_assign(jsonpatch_names<char_type>::path_name(), ss);
-                    val.insert_or_assign(jsonpatch_names<char_type>::value_name(), a.value());
-                    result.push_back(std::move(val));
+                    return false;
+                }
+                auto it = parent->array_range().begin() + index;
+                it->swap(removed);
+                parent->erase(it);
+            }
+            else if (parent->is_object())
+            {
+                auto it = parent->find(path.back());
+                if (it == parent->object_range().end())
+                {
+                    return false;
                 }
+                it->value().swap(removed);
+                parent->erase(it);
+            }
+            else
+            {
+                return false;
+            }
+            if (carried)
+            {
+                carried_ = std::move(removed);
+                undo_log_.emplace_back(undo_kind::add, std::addressof(path), index, true, Json());
+            }
+            else
+            {
+                undo_log_.emplace_back(undo_kind::add, std::addressof(path), index, false, std::move(removed));
             }
+            return true;
         }
-        else
+
+        // Plays back the undo log, stopping at the first entry that cannot be undone
+        void undo() noexcept
         {
-            Json val(json_object_arg);
-            val.insert_or_assign(jsonpatch_names<char_type>::op_name(), jsonpatch_names<char_type>::replace_name());
-            val.insert_or_assign(jsonpatch_names<char_type>::path_name(), path);
-            val.insert_or_assign(jsonpatch_names<char_type>::value_name(), target);
-            result.push_back(std::move(val));
+            for (auto it = undo_log_.rbegin(); it != undo_log_.rend(); ++it)
+            {
+                if (!undo(*it))
+                {
+                    break;
+                }
+            }
+            undo_log_.clear();
         }
 
-        return result;
+        bool undo(undo_entry& entry) noexcept
+        {
+            const token_list& path = *entry.path;
+            JSONCONS_TRY
+            {
+                Json* parent = path.empty() ? nullptr : resolve_parent(path);
+                if (!path.empty() && parent == nullptr)
+                {
+                    return false;
+                }
+                switch (entry.kind)
+                {
+                    case undo_kind::add:
+                    {
+                        Json& value = entry.carried ? carried_ : entry.value;
+                        if (parent->is_array())
+                        {
+                            parent->insert(parent->array_range().begin() + entry.index, std::move(value));
+                        }
+                        else
+                        {
+                            parent->try_emplace(path.back(), std::move(value));
+                        }
+                        break;
+                    }
+                    case undo_kind::remove:
+                    {
+                        Json removed;
+                        if (parent->is_array())
+                        {
+                            auto it = parent->array_range().begin() + entry.index;
+                            it->swap(removed);
+                            parent->erase(it);
+                        }
+                        else
+                        {
+                            auto it = parent->find(path.back());
+                            it->value().swap(removed);
+                            parent->erase(it);
+                        }
+                        if (entry.carried)
+                        {
+                            carried_ = std::move(removed);
+                        }
+                        break;
+                    }
+                    case undo_kind::replace:
+                    {
+                        Json* slot = path.empty() ? resolve(path) : resolve_child(parent, path.back());
+                        if (slot == nullptr)
+                        {
+                            return false;
+                        }
+                        if (entry.carried)
+                        {
+                            carried_ = std::move(*slot);
+                        }
+                        slot->swap(entry.value);
+                        break;
+                    }
+                }
+            }
+            JSONCONS_CATCH(...)
+            {
+                return false;
+            }
+            return true;
+        }
+    };
+
+    template <class Json>
+    constexpr std::size_t patch_applier<Json>::npos;
+
+    template <class Json>
+    void from_diff(const Json& source, const Json& target, const typename Json::string_view_type& path,
+                   const basic_diff_options<typename Json::char_type>& options, Json& result);
+
+    template <class Json>
+    std::basic_string<typename Json::char_type> element_path(const typename Json::string_view_type& path, std::size_t index)
+    {
+        std::basic_string<typename Json::char_type> s(path); 
+        s.push_back('/');
+        jsoncons::detail::from_integer(index,s);
+        return s;
     }
-}
 
-template <class Json>
-void apply_patch(Json& target, const Json& patch, std::error_code& ec)
-{
-    using char_type = typename Json::char_type;
-    using string_type = std::basic_string<char_type>;
-    using json_pointer_type = jsonpointer::basic_json_pointer<char_type>;
+    template <class Json>
+    void add_operation(const typename Json::string_view_type& path, std::size_t index, const Json& value, Json& result)
+    {
+        using char_type = typename Json::char_type;
+
+        Json val(json_object_arg);
+        val.insert_or_assign(jsonpatch_names<char_type>::op_name(), jsonpatch_names<char_type>::add_name());
+        val.insert_or_assign(jsonpatch_names<char_type>::path_name(), element_path<Json>(path, index));
+        val.insert_or_assign(jsonpatch_names<char_type>::value_name(), value);
+        result.push_back(std::move(val));
+    }
+
+    template <class Json>
+    void remove_operation(const typename Json::string_view_type& path, std::size_t index, Json& result)
+    {
+        using char_type = typename Json::char_type;
 
-   jsoncons::jsonpatch::detail::operation_unwinder<Json> unwinder(target);
-   std::error_code local_ec;
+        Json val(json_object_arg);
+        val.insert_or_assign(jsonpatch_names<char_type>::op_name(), jsonpatch_names<char_type>::remove_name());
+        val.insert_or_assign(jsonpatch_names<char_type>::path_name(), element_path<Json>(path, index));
+        result.push_back(std::move(val));
+    }
 
-    // Validate
-     
-    for (const auto& operation : patch.array_range())
+    template <class Json>
+    void move_operation(const typename Json::string_view_type& path, std::size_t from, std::size_t to, Json& result)
     {
-        unwinder.state =jsoncons::jsonpatch::detail::state_type::begin;
+        using char_type = typename Json::char_type;
+
+        Json val(json_object_arg);
+        val.insert_or_assign(jsonpatch_names<char_type>::op_name(), jsonpatch_names<char_type>::move_name());
+        val.insert_or_assign(jsonpatch_names<char_type>::from_name(), element_path<Json>(path, from));
+        val.insert_or_assign(jsonpatch_names<char_type>::path_name(), element_path<Json>(path, to));
+        result.push_back(std::move(val));
+    }
+
+    // Diffs source[offset, offset+source_count) against target[offset, offset+target_count)
+    // element by element
 
-        auto it_op = operation.find(detail::jsonpatch_names<char_type>::op_name());
-        if (it_op == operation.object_range().end())
+    template <class Json>
+    void diff_arrays_by_position(const Json& source, const Json& target, 
+                                 std::size_t offset, std::size_t source_count, std::size_t target_count,
+                                 const typename Json::string_view_type& path,
+                                 const basic_diff_options<typename Json::char_type>& options, 
+                                 Json& result)
+    {
+        std::size_t common = (std::min)(source_count,target_count);
+        for (std::size_t i = offset; i < offset + common; ++i)
         {
-            ec = jsonpatch_errc::invalid_patch;
-            unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-            return;
+            auto ss = element_path<Json>(path, i);
+            from_diff(source[i],target[i],ss,options,result);
+        }
+        // Element in source, not in target - remove
+        for (std::size_t i = offset + source_count; i-- > offset + target_count;)
+        {
+            remove_operation(path, i, result);
+        }
+        // Element in target, not in source - add, 
+        // Fix contributed by Alexander rog13
+        for (std::size_t i = offset + source_count; i < offset + target_count; ++i)
+        {
+            add_operation(path, i, target[i], result);
         }
-        string_type op = it_op->value().template as<string_type>();
+    }
+
+    enum class edit_kind : uint8_t {keep, remove, insert};
+
+    // Myers' O((n+m)d) algorithm for the shortest edit script that turns 
+    // source[source_offset, source_offset+n) into target[target_offset, target_offset+m).
+    // Returns false if more than max_d edits are needed.
+
+    template <class Json>
+    bool shortest_edit_script(const Json& source, std::size_t source_offset, std::size_t n,
+                              const Json& target, std::size_t target_offset, std::size_t m,
+                              std::size_t max_d,
+                              std::vector<edit_kind>& script)
+    {
+        const std::ptrdiff_t N = static_cast<std::ptrdiff_t>(n);
+        const std::ptrdiff_t M = static_cast<std::ptrdiff_t>(m);
+        const std::ptrdiff_t max = static_cast<std::ptrdiff_t>((std::min)(n + m, max_d));
+
+        // v[k + max + 1] is the furthest x reached on diagonal k
+        std::vector<std::ptrdiff_t> v(2*max + 3, 0);
+        auto at = [max](std::ptrdiff_t k) {return static_cast<std::size_t>(k + max + 1);};
 
-        auto it_path = operation.find(detail::jsonpatch_names<char_type>::path_name());
-        if (it_path == operation.object_range().end())
+        // trace[d] holds v[-d..d] after step d
+        std::vector<std::vector<std::ptrdiff_t>> trace;
+
+        for (std::ptrdiff_t d = 0; d <= max; ++d)
         {
-            ec = jsonpatch_errc::invalid_patch;
-            unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-            return;
+            for (std::ptrdiff_t k = -d; k <= d; k += 2)
+            {
+                std::ptrdiff_t x = (k == -d || (k != d && v[at(k-1)] < v[at(k+1)])) ? v[at(k+1)] : v[at(k-1)] + 1;
+                std::ptrdiff_t y = x - k;
+                while (x < N && y < M && source[source_offset + x] == target[target_offset + y])
+                {
+                    ++x;
+                    ++y;
+                }
+                v[at(k)] = x;
+                if (x >= N && y >= M)
+                {
+                    // Walk back from (N,M) to (0,0)
+                    script.clear();
+                    for (std::ptrdiff_t e = d; e > 0; --e)
+                    {
+                        const auto& prev = trace[static_cast<std::size_t>(e-1)];
+                        auto prev_at = [e](std::ptrdiff_t kk) {return static_cast<std::size_t>(kk + e - 1);};
+                        std::ptrdiff_t kk = x - y;
+                        bool down = kk == -e || (kk != e && prev[prev_at(kk-1)] < prev[prev_at(kk+1)]);
+                        std::ptrdiff_t prev_k = down ? kk + 1 : kk - 1;
+                        std::ptrdiff_t prev_x = prev[prev_at(prev_k)];
+                        std::ptrdiff_t prev_y = prev_x - prev_k;
+                        std::ptrdiff_t start_x = down ? prev_x : prev_x + 1;
+                        while (x > start_x)
+                        {
+                            script.push_back(edit_kind::keep);
+                            --x;
+                            --y;
+                        }
+                        script.push_back(down ? edit_kind::insert : edit_kind::remove);
+                        x = prev_x;
+                        y = prev_y;
+                    }
+                    while (x > 0)
+                    {
+                        script.push_back(edit_kind::keep);
+                        --x;
+                    }
+                    std::reverse(script.begin(), script.end());
+                    return true;
+                }
+            }
+            trace.emplace_back(v.begin() + static_cast<std::ptrdiff_t>(at(-d)), v.begin() + static_cast<std::ptrdiff_t>(at(d)) + 1);
         }
-        string_type path = it_path->value().template as<string_type>();
-        auto location = json_pointer_type::parse(path, local_ec);
-        if (local_ec)
+        return false;
+    }
+
+    template <class Json>
+    void diff_arrays_by_lcs(const Json& source, const Json& target, 
+                            const typename Json::string_view_type& path,
+                            const basic_diff_options<typename Json::char_type>& options, 
+                            Json& result)
+    {
+        const std::size_t n = source.size();
+        const std::size_t m = target.size();
+
+        std::size_t prefix = 0;
+        while (prefix < n && prefix < m && source[prefix] == target[prefix])
+        {
+            ++prefix;
+        }
+        std::size_t suffix = 0;
+        while (suffix < n - prefix && suffix < m - prefix && source[n-1-suffix] == target[m-1-suffix])
         {
-            ec = jsonpatch_errc::invalid_patch;
-            unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
+            ++suffix;
+        }
+        const std::size_t source_count = n - prefix - suffix;
+        const std::size_t target_count = m - prefix - suffix;
+
+        std::vector<edit_kind> script;
+        if (!shortest_edit_script(source, prefix, source_count, target, prefix, target_count, 
+                                  options.max_edit_distance(), script))
+        {
+            diff_arrays_by_position(source, target, prefix, source_count, target_count, path, options, result);
             return;
         }
 
-        if (op ==jsoncons::jsonpatch::detail::jsonpatch_names<char_type>::test_name())
+        // Within each run of removals and insertions, pair removed and inserted 
+        // elements and diff them in place, then remove or add the rest
+        std::size_t index = prefix;
+        std::size_t i = prefix;
+        std::size_t j = prefix;
+        std::size_t pos = 0;
+        while (pos < script.size())
         {
-            Json val = jsonpointer::get(target,location,local_ec);
-            if (local_ec)
+            if (script[pos] == edit_kind::keep)
             {
-                ec = jsonpatch_errc::test_failed;
-                unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                return;
+                ++index;
+                ++i;
+                ++j;
+                ++pos;
+                continue;
             }
-            auto it_value = operation.find(detail::jsonpatch_names<char_type>::value_name());
-            if (it_value == operation.object_range().end())
+            std::size_t removed = 0;
+            std::size_t inserted = 0;
+            for (; pos < script.size() && script[pos] != edit_kind::keep; ++pos)
             {
-                ec = jsonpatch_errc::invalid_patch;
-                unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                return;
+                if (script[pos] == edit_kind::remove)
+                {
+                    ++removed;
+                }
+                else
+                {
+                    ++inserted;
+                }
             }
-            if (val != it_value->value())
+            std::size_t paired = (std::min)(removed, inserted);
+            for (std::size_t q = 0; q < paired; ++q)
             {
-                ec = jsonpatch_errc::test_failed;
-                unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                return;
+                auto ss = element_path<Json>(path, index);
+                from_diff(source[i+q], target[j+q], ss, options, result);
+                ++index;
+            }
+            for (std::size_t q = paired; q < removed; ++q)
+            {
+                remove_operation(path, index, result);
+            }
+            for (std::size_t q = paired; q < inserted; ++q)
+            {
+                add_operation(path, index, target[j+q], result);
+                ++index;
+            }
+            i += removed;
+            j += inserted;
+        }
+    }
+
+    // Tracks which of a fixed sequence of slots are occupied, and gives the
+    // position of an occupied slot among the occupied slots in O(log n)
+
+    class slot_counter
+    {
+        std::vector<std::size_t> tree_;
+        std::size_t size_;
+    public:
+        slot_counter(std::size_t slot_count)
+            : tree_(slot_count + 1, 0), size_(0)
+        {
+        }
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        void insert(std::size_t slot)
+        {
+            for (std::size_t i = slot + 1; i < tree_.size(); i += i & (~i + 1))
+            {
+                ++tree_[i];
             }
+            ++size_;
         }
-        else if (op ==jsoncons::jsonpatch::detail::jsonpatch_names<char_type>::add_name())
+
+        void erase(std::size_t slot)
         {
-            auto it_value = operation.find(detail::jsonpatch_names<char_type>::value_name());
-            if (it_value == operation.object_range().end())
+            for (std::size_t i = slot + 1; i < tree_.size(); i += i & (~i + 1))
             {
-                ec = jsonpatch_errc::invalid_patch;
-                unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                return;
+                --tree_[i];
+            }
+            --size_;
+        }
+
+        // The number of occupied slots before slot
+        std::size_t position(std::size_t slot) const
+        {
+            std::size_t count = 0;
+            for (std::size_t i = slot; i > 0; i -= i & (~i + 1))
+            {
+                count += tree_[i];
             }
-            Json val = it_value->value();
-            auto npath = jsonpatch::detail::definite_path(target,location);
+            return count;
+        }
+    };
+
+    // Diffs arrays of objects matched by the identity key member. Returns false, 
+    // without adding to result, if an element is not an object, or has no key,
+    // or shares its key with another element of the same array.
+
+    template <class Json>
+    bool diff_arrays_by_key(const Json& source, const Json& target, 
+                            const typename Json::string_view_type& path,
+                            const basic_diff_options<typename Json::char_type>& options, 
+                            Json& result)
+    {
+        using key_map = std::map<std::reference_wrapper<const Json>,std::size_t,std::less<Json>>;
 
-            std::error_code insert_ec;
-            jsonpointer::add_if_absent(target,npath,val,insert_ec); // try insert without replace
-            if (insert_ec) // try a replace
+        const auto& key_name = options.identity_key();
+        auto index_keys = [&key_name](const Json& a, key_map& keys) -> bool
+        {
+            std::size_t i = 0;
+            for (const auto& item : a.array_range())
             {
-                std::error_code select_ec;
-                Json orig_val = jsonpointer::get(target,npath,select_ec);
-                if (select_ec) // shouldn't happen
+                if (!item.is_object())
                 {
-                    ec = jsonpatch_errc::add_failed;
-                    unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                    return;
+                    return false;
                 }
-                std::error_code replace_ec;
-                jsonpointer::replace(target,npath,val,replace_ec);
-                if (replace_ec)
+                auto it = item.find(key_name);
+                if (it == item.object_range().end() || !keys.emplace(std::cref(it->value()), i).second)
                 {
-                    ec = jsonpatch_errc::add_failed;
-                    unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                    return;
+                    return false;
                 }
-                unwinder.stack.emplace_back(detail::op_type::replace,npath,orig_val);
-            }
-            else // insert without replace succeeded
-            {
-                unwinder.stack.emplace_back(detail::op_type::remove,npath,Json::null());
+                ++i;
             }
+            return true;
+        };
+
+        key_map source_keys;
+        key_map target_keys;
+        if (!index_keys(source, source_keys) || !index_keys(target, target_keys))
+        {
+            return false;
         }
-        else if (op ==jsoncons::jsonpatch::detail::jsonpatch_names<char_type>::remove_name())
+
+        const std::size_t n = source.size();
+        const std::size_t m = target.size();
+        const std::size_t npos = (std::numeric_limits<std::size_t>::max)();
+
+        // source_of[j] is the source index of target[j], or npos if it is new
+        std::vector<std::size_t> source_of(m, npos);
+        // target_of[i] is the target index of source[i], or npos if it is removed
+        std::vector<std::size_t> target_of(n, npos);
+        for (const auto& item : target_keys)
         {
-            Json val = jsonpointer::get(target,location,local_ec);
-            if (local_ec)
+            auto it = source_keys.find(item.first);
+            if (it != source_keys.end())
             {
-                ec = jsonpatch_errc::remove_failed;
-                unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                return;
+                source_of[item.second] = it->second;
+                target_of[it->second] = item.second;
             }
-            jsonpointer::remove(target,location,local_ec);
-            if (local_ec)
+        }
+
+        // Remove from the back so that indexes stay valid
+        for (std::size_t i = n; i-- > 0;)
+        {
+            if (target_of[i] == npos)
             {
-                ec = jsonpatch_errc::remove_failed;
-                unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                return;
+                remove_operation(path, i, result);
             }
-            unwinder.stack.emplace_back(detail::op_type::add, location, val);
         }
-        else if (op ==jsoncons::jsonpatch::detail::jsonpatch_names<char_type>::replace_name())
+
+        // The current array, elements are identified by their target index
+        std::vector<std::size_t> current;
+        current.reserve(m);
+        for (std::size_t i = 0; i < n; ++i)
         {
-            Json val = jsonpointer::get(target,location,local_ec);
-            if (local_ec)
+            if (target_of[i] != npos)
             {
-                ec = jsonpatch_errc::replace_failed;
-                unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                return;
+                current.push_back(target_of[i]);
             }
-            auto it_value = operation.find(detail::jsonpatch_names<char_type>::value_name());
-            if (it_value == operation.object_range().end())
+        }
+
+        // The elements in a longest increasing subsequence of target indexes
+        // keep their place, the others are moved
+        std::vector<bool> stable(m, false);
+        {
+            std::vector<std::size_t> tails; // positions in current
+            std::vector<std::size_t> predecessor(current.size(), npos);
+            for (std::size_t p = 0; p < current.size(); ++p)
             {
-                ec = jsonpatch_errc::invalid_patch;
-                unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                return;
+                auto it = std::lower_bound(tails.begin(), tails.end(), current[p],
+                                           [&current](std::size_t q, std::size_t val) {return current[q] < val;});
+                if (it != tails.begin())
+                {
+                    predecessor[p] = *(it - 1);
+                }
+                if (it == tails.end())
+                {
+                    tails.push_back(p);
+                }
+                else
+                {
+                    *it = p;
+                }
             }
-            jsonpointer::replace(target, location, it_value->value(), local_ec);
-            if (local_ec)
+            for (std::size_t p = tails.empty() ? npos : tails.back(); p != npos; p = predecessor[p])
             {
-                ec = jsonpatch_errc::replace_failed;
-                unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                return;
+                stable[current[p]] = true;
             }
-            unwinder.stack.emplace_back(detail::op_type::replace,location,val);
         }
-        else if (op ==jsoncons::jsonpatch::detail::jsonpatch_names<char_type>::move_name())
+
+        // Each element occupies a slot, and the slots are laid out in the order of
+        // the working array at every step. Elements that are new or moved end up
+        // in a run immediately before the next stable element in target order, or
+        // at the end, so their slots are laid out there. The other slots are for
+        // the elements in their places in current.
+        std::vector<std::size_t> slot(m, npos);
+        std::vector<std::size_t> placed_slot(m, npos);
+        std::size_t slot_count = 0;
         {
-            auto it_from = operation.find(detail::jsonpatch_names<char_type>::from_name());
-            if (it_from == operation.object_range().end())
+            std::size_t next = 0;
+            for (std::size_t p = 0; p < current.size(); ++p)
             {
-                ec = jsonpatch_errc::invalid_patch;
-                unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                return;
+                if (stable[current[p]])
+                {
+                    for (; next < current[p]; ++next)
+                    {
+                        placed_slot[next] = slot_count++;
+                    }
+                    next = current[p] + 1;
+                }
+                slot[current[p]] = slot_count++;
             }
-            string_type from = it_from->value().as_string();
-            auto from_pointer = json_pointer_type::parse(from, local_ec);
-            if (local_ec)
+            for (; next < m; ++next)
             {
-                ec = jsonpatch_errc::move_failed;
-                unwinder.state = jsoncons::jsonpatch::detail::state_type::abort;
-                return;
+                placed_slot[next] = slot_count++;
             }
+        }
+        slot_counter positions(slot_count);
+        for (std::size_t p = 0; p < current.size(); ++p)
+        {
+            positions.insert(slot[current[p]]);
+        }
 
-            Json val = jsonpointer::get(target, from_pointer, local_ec);
-            if (local_ec)
+        // Working back from the end of target, place each element that is new or 
+        // moved immediately before its successor
+        for (std::size_t j = m; j-- > 0;)
+        {
+            if (stable[j])
             {
-                ec = jsonpatch_errc::move_failed;
-                unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                return;
+                continue;
             }
-            jsonpointer::remove(target, from_pointer, local_ec);
-            if (local_ec)
+            std::size_t anchor = j + 1 < m ? positions.position(slot[j + 1]) : positions.size();
+            if (source_of[j] == npos)
             {
-                ec = jsonpatch_errc::move_failed;
-                unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                return;
+                add_operation(path, anchor, target[j], result);
             }
-            unwinder.stack.emplace_back(detail::op_type::add, from_pointer, val);
-            // add
-            std::error_code insert_ec;
-            auto npath = jsonpatch::detail::definite_path(target,location);
-            jsonpointer::add_if_absent(target,npath,val,insert_ec); // try insert without replace
-            if (insert_ec) // try a replace
+            else
             {
-                std::error_code select_ec;
-                Json orig_val = jsonpointer::get(target,npath,select_ec);
-                if (select_ec) // shouldn't happen
+                std::size_t from = positions.position(slot[j]);
+                std::size_t to = from < anchor ? anchor - 1 : anchor;
+                if (from != to)
                 {
-                    ec = jsonpatch_errc::copy_failed;
-                    unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                    return;
+                    move_operation(path, from, to, result);
                 }
-                std::error_code replace_ec;
-                jsonpointer::replace(target, npath, val, replace_ec);
-                if (replace_ec)
-                {
-                    ec = jsonpatch_errc::copy_failed;
-                    unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                    return;
-                }
-                unwinder.stack.emplace_back(jsoncons::jsonpatch::detail::op_type::replace,npath,orig_val);
+                positions.erase(slot[j]);
             }
-            else
+            slot[j] = placed_slot[j];
+            positions.insert(slot[j]);
+        }
+
+        for (std::size_t j = 0; j < m; ++j)
+        {
+            if (source_of[j] != npos)
             {
-                unwinder.stack.emplace_back(detail::op_type::remove,npath,Json::null());
+                auto ss = element_path<Json>(path, j);
+                from_diff(source[source_of[j]], target[j], ss, options, result);
             }
         }
-        else if (op ==jsoncons::jsonpatch::detail::jsonpatch_names<char_type>::copy_name())
+        return true;
+    }
+
+    template <class Json>
+    void from_diff(const Json& source, const Json& target, const typename Json::string_view_type& path,
+                   const basic_diff_options<typename Json::char_type>& options, Json& result)
+    {
+        using char_type = typename Json::char_type;
+
+        if (source == target)
+        {
+            return;
+        }
+
+        if (source.is_array() && target.is_array())
         {
-            auto it_from = operation.find(detail::jsonpatch_names<char_type>::from_name());
-            if (it_from == operation.object_range().end())
+            if (!options.identity_key().empty() && diff_arrays_by_key(source, target, path, options, result))
             {
-                ec = jsonpatch_errc::invalid_patch;
-                unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
                 return;
             }
-            string_type from = it_from->value().as_string();
-            Json val = jsonpointer::get(target,from,local_ec);
-            if (local_ec)
+            if (options.array_diff() == array_diff_kind::lcs)
             {
-                ec = jsonpatch_errc::copy_failed;
-                unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                return;
+                diff_arrays_by_lcs(source, target, path, options, result);
+            }
+            else
+            {
+                diff_arrays_by_position(source, target, 0, source.size(), target.size(), path, options, result);
             }
-            // add
-            auto npath = jsonpatch::detail::definite_path(target,location);
-            std::error_code insert_ec;
-            jsonpointer::add_if_absent(target,npath,val,insert_ec); // try insert without replace
-            if (insert_ec) // Failed, try a replace
+        }
+        else if (source.is_object() && target.is_object())
+        {
+            for (const auto& a : source.object_range())
             {
-                std::error_code select_ec;
-                Json orig_val = jsonpointer::get(target,npath, select_ec);
-                if (select_ec) // shouldn't happen
+                std::basic_string<char_type> ss(path);
+                ss.push_back('/'); 
+                jsonpointer::escape(a.key(),ss);
+                auto it = target.find(a.key());
+                if (it != target.object_range().end())
                 {
-                    ec = jsonpatch_errc::copy_failed;
-                    unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                    return;
+                    from_diff(a.value(),it->value(),ss,options,result);
                 }
-                std::error_code replace_ec;
-                jsonpointer::replace(target, npath, val,replace_ec);
-                if (replace_ec)
+                else
                 {
-                    ec = jsonpatch_errc::copy_failed;
-                    unwinder.state =jsoncons::jsonpatch::detail::state_type::abort;
-                    return;
+                    Json val(json_object_arg);
+                    val.insert_or_assign(jsonpatch_names<char_type>::op_name(), jsonpatch_names<char_type>::remove_name());
+                    val.insert_or_assign(jsonpatch_names<char_type>::path_name(), ss);
+                    result.push_back(std::move(val));
                 }
-                unwinder.stack.emplace_back(jsoncons::jsonpatch::detail::op_type::replace,npath,orig_val);
             }
-            else
+            for (const auto& a : target.object_range())
             {
-                unwinder.stack.emplace_back(detail::op_type::remove,npath,Json::null());
+                auto it = source.find(a.key());
+                if (it == source.object_range().end())
+                {
+                    std::basic_string<char_type> ss(path); 
+                    ss.push_back('/');
+                    jsonpointer::escape(a.key(),ss);
+                    Json val(json_object_arg);
+                    val.insert_or_assign(jsonpatch_names<char_type>::op_name(), jsonpatch_names<char_type>::add_name());
+                    val.insert_or_assign(jsonpatch_names<char_type>::path_name(), ss);
+                    val.insert_or_assign(jsonpatch_names<char_type>::value_name(), a.value());
+                    result.push_back(std::move(val));
+                }
             }
         }
+        else
+        {
+            Json val(json_object_arg);
+            val.insert_or_assign(jsonpatch_names<char_type>::op_name(), jsonpatch_names<char_type>::replace_name());
+            val.insert_or_assign(jsonpatch_names<char_type>::path_name(), path);
+            val.insert_or_assign(jsonpatch_names<char_type>::value_name(), target);
+            result.push_back(std::move(val));
+        }
     }
-    if (unwinder.state ==jsoncons::jsonpatch::detail::state_type::begin)
+
+    template <class Json>
+    Json from_diff(const Json& source, const Json& target, const typename Json::string_view_type& path)
     {
-        unwinder.state =jsoncons::jsonpatch::detail::state_type::commit;
+        Json result(json_array_arg);
+        from_diff(source, target, path, basic_diff_options<typename Json::char_type>(), result);
+        return result;
     }
 }
 
+template <class Json>
+void apply_patch(Json& target, const Json& patch, std::error_code& ec)
+{
+    jsoncons::jsonpatch::detail::patch_applier<Json> applier(target);
+    applier.apply(patch, ec);
+}
+
 template <class Json>
 Json from_diff(const Json& source, const Json& target)
 {
@@ -563,6 +1171,15 @@ Json from_diff(const Json& source, const Json& target)
     return jsoncons::jsonpatch::detail::from_diff(source, target, path);
 }
 
+template <class Json>
+Json from_diff(const Json& source, const Json& target, const basic_diff_options<typename Json::char_type>& options)
+{
+    std::basic_string<typename Json::char_type> path;
+    Json result(json_array_arg);
+    jsoncons::jsonpatch::detail::from_diff(source, target, path, options, result);
+    return result;
+}
+
 template <class Json>
 void apply_patch(Json& target, const Json& patch)
 {
@@ -18,6 +18,7 @@
 #include <regex>
 #endif
 #include <jsoncons/json_type.hpp>
+#include <jsoncons/detail/object_pool.hpp>
 #include <jsoncons_ext/jsonpath/json_location.hpp>
 #include <jsoncons_ext/jsonpath/jsonpath_error.hpp>
 
@@ -2198,17 +2199,31 @@ namespace detail {
         using pointer = typename std::conditional<std::is_const<typename std::remove_reference<reference>::type>::value,typename Json::const_pointer,typename Json::pointer>::type;
         using json_location_node_type = json_location_node<typename Json::char_type>;
         using path_stem_value_pair_type = path_component_value_pair<Json,JsonReference>;
-        std::vector<std::unique_ptr<Json>> temp_json_values_;
-        std::vector<std::unique_ptr<json_location_node_type>> temp_path_node_values_;
-        std::unordered_map<std::size_t,pointer> cache_;
+        jsoncons::detail::object_pool<Json> temp_json_values_;
+        jsoncons::detail::object_pool<json_location_node_type> temp_path_node_values_;
+        // Indexed by root selector id
+        std::vector<pointer> cache_;
     public:
+        // Destroys the temporaries of the last evaluation, keeping their
+        // storage, so that the resources can be used for another evaluation
+        void reset() noexcept
+        {
+            temp_json_values_.clear();
+            temp_path_node_values_.clear();
+            cache_.clear();
+        }
+
         bool is_cached(std::size_t id) const
         {
-            return cache_.find(id) != cache_.end();
+            return id < cache_.size() && cache_[id] != nullptr;
         }
         void add_to_cache(std::size_t id, reference val) 
         {
-            cache_.emplace(id, std::addressof(val));
+            if (id >= cache_.size())
+            {
+                cache_.resize(id + 1, nullptr);
+            }
+            cache_[id] = std::addressof(val);
         }
         reference retrieve_from_cache(std::size_t id) 
         {
@@ -2224,10 +2239,7 @@ namespace detail {
         template <typename... Args>
         Json* create_json(Args&& ... args)
         {
-            auto temp = jsoncons::make_unique<Json>(std::forward<Args>(args)...);
-            Json* ptr = temp.get();
-            temp_json_values_.emplace_back(std::move(temp));
-            return ptr;
+            return temp_json_values_.create(std::forward<Args>(args)...);
         }
 
         const json_location_node_type& root_path_node() const
@@ -2245,10 +2257,7 @@ namespace detail {
         template <typename... Args>
         const json_location_node_type* create_path_node(Args&& ... args)
         {
-            auto temp = jsoncons::make_unique<json_location_node_type>(std::forward<Args>(args)...);
-            json_location_node_type* ptr = temp.get();
-            temp_path_node_values_.emplace_back(std::move(temp));
-            return ptr;
+            return temp_path_node_values_.create(std::forward<Args>(args)...);
         }
     };
 
@@ -2322,6 +2331,13 @@ namespace detail {
         {
         }
 
+        // True for identifier and index selectors, which can be fused with
+        // the identifier and index selectors that follow them
+        virtual bool is_lookup() const
+        {
+            return false;
+        }
+
         virtual std::string to_string(int = 0) const
         {
             return std::string();
@@ -50,7 +50,8 @@ namespace jsoncons { namespace jsonpath {
         expected_and,
         expected_comma_or_rparen,
         expected_comma_or_rbracket,
-        expected_relative_path
+        expected_relative_path,
+        selector_not_streamable
     };
 
     class jsonpath_error_category_impl
@@ -135,6 +136,8 @@ namespace jsoncons { namespace jsonpath {
                     return "Expected comma or right bracket";
                 case jsonpath_errc::expected_relative_path:
                     return "Expected unquoted string, or single or double quoted string, or index or '*'";
+                case jsonpath_errc::selector_not_streamable:
+                    return "Selector cannot be evaluated in a single forward pass";
                 default:
                     return "Unknown jsonpath parser error";
             }
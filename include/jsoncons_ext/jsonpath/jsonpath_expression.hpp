@@ -2481,6 +2481,32 @@ namespace detail {
 
     } // namespace detail
 
+    // Holds the temporary values and paths created while evaluating a jsonpath_expression.
+    // Passing the same context to repeated evaluations reuses its storage instead of
+    // allocating it anew each time. A context may be used by one evaluation at a time.
+
+    template <class Json,class JsonReference = const Json&>
+    class evaluation_context
+    {
+        template <class J,class JR>
+        friend class jsonpath_expression;
+
+        jsoncons::jsonpath::detail::dynamic_resources<Json,JsonReference> resources_;
+    public:
+        evaluation_context() = default;
+        evaluation_context(const evaluation_context&) = delete;
+        evaluation_context(evaluation_context&&) = default;
+
+        evaluation_context& operator=(const evaluation_context&) = delete;
+        evaluation_context& operator=(evaluation_context&&) = default;
+
+        // Destroys the temporaries of the last evaluation
+        void reset() noexcept
+        {
+            resources_.reset();
+        }
+    };
+
     template <class Json,class JsonReference = const Json&>
     class jsonpath_expression
     {
@@ -2547,6 +2573,39 @@ namespace detail {
             }
         }
 
+        template <class BinaryCallback>
+        typename std::enable_if<traits_extension::is_binary_function_object<BinaryCallback,const string_type&,reference>::value,void>::type
+        evaluate(evaluation_context<Json,JsonReference>& context, reference instance, BinaryCallback callback, result_options options = result_options()) const
+        {
+            auto& resources = context.resources_;
+            resources.reset();
+            auto f = [&callback](const json_location_type& path, reference val)
+            {
+                callback(path.to_string(), val);
+            };
+            expr_.evaluate(resources, instance, resources.root_path_node(), instance, f, options);
+        }
+
+        Json evaluate(evaluation_context<Json,JsonReference>& context, reference instance, result_options options = result_options()) const
+        {
+            auto& resources = context.resources_;
+            resources.reset();
+            if ((options & result_options::path) == result_options::path)
+            {
+                Json result(json_array_arg);
+                auto callback = [&result](const json_location_type& p, reference)
+                {
+                    result.emplace_back(p.to_string());
+                };
+                expr_.evaluate(resources, instance, resources.root_path_node(), instance, callback, options);
+                return result;
+            }
+            else
+            {
+                return expr_.evaluate(resources, instance, resources.current_path_node(), instance, options);
+            }
+        }
+
         static jsonpath_expression compile(const string_view_type& path)
         {
             jsoncons::jsonpath::detail::static_resources<value_type,reference> resources;
@@ -206,6 +206,11 @@ namespace detail {
             }
         }
 
+        bool has_tail() const
+        {
+            return tail_ != nullptr;
+        }
+
         void tail_select(dynamic_resources<Json,JsonReference>& resources,
                            reference root,
                            const json_location_node_type& last, 
@@ -256,8 +261,13 @@ namespace detail {
         }
     };
 
+    // A chain of identifier and index selectors, e.g. $.store.book[0].title. Each
+    // identifier or index selector starts as a chain of one step, and absorbs the
+    // identifier and index selectors appended directly after it, so that the chain
+    // is evaluated as a loop of direct lookups rather than a selector per step.
+
     template <class Json,class JsonReference>
-    class identifier_selector final : public base_selector<Json,JsonReference>
+    class lookup_selector : public base_selector<Json,JsonReference>
     {
         using supertype = base_selector<Json,JsonReference>;
         using path_generator_type = path_generator<Json,JsonReference>;
@@ -271,13 +281,60 @@ namespace detail {
         using string_type = std::basic_string<char_type>;
         using string_view_type = basic_string_view<char_type>;
         using node_receiver_type = typename supertype::node_receiver_type;
+        using selector_type = typename supertype::selector_type;
     private:
-        string_type identifier_;
+        struct lookup_step
+        {
+            bool is_index;
+            int64_t index;
+            string_type identifier;
+        };
+
+        std::vector<lookup_step> steps_;
+        bool shared_;
+    protected:
+        lookup_selector(const string_view_type& identifier)
+            : base_selector<Json,JsonReference>(), shared_(false)
+        {
+            steps_.push_back(lookup_step{false, 0, string_type(identifier)});
+        }
+
+        lookup_selector(int64_t index)
+            : base_selector<Json,JsonReference>(), shared_(false)
+        {
+            steps_.push_back(lookup_step{true, index, string_type()});
+        }
     public:
+        bool is_lookup() const override
+        {
+            return true;
+        }
 
-        identifier_selector(const string_view_type& identifier)
-            : base_selector<Json,JsonReference>(), identifier_(identifier)
+        std::size_t step_count() const
+        {
+            return steps_.size();
+        }
+
+        // Marks this selector as the tail of several selectors, e.g. the branches
+        // of a union. Its steps are then not copied into the selectors it is
+        // appended to, so that steps appended to it later are seen by all of them.
+        void set_shared()
         {
+            shared_ = true;
+        }
+
+        void append_selector(selector_type* expr) override
+        {
+            if (!this->has_tail() && expr->is_lookup())
+            {
+                auto other = static_cast<lookup_selector*>(expr);
+                if (!other->has_tail() && !other->shared_)
+                {
+                    steps_.insert(steps_.end(), other->steps_.begin(), other->steps_.end());
+                    return;
+                }
+            }
+            supertype::append_selector(expr);
         }
 
         void select(dynamic_resources<Json,JsonReference>& resources,
@@ -287,140 +344,173 @@ namespace detail {
                     node_receiver_type& receiver,
                     result_options options) const override
         {
-            //std::string buf;
-            //buf.append("identifier selector: ");
-            //unicode_traits::convert(identifier_.data(),identifier_.size(),buf);
-
-            static const char_type length_name[] = {'l', 'e', 'n', 'g', 't', 'h', 0};
+            const json_location_node_type* path = std::addressof(last);
+            pointer ptr = std::addressof(current);
+            for (const auto& step : steps_)
+            {
+                ptr = lookup(resources, step, *ptr, path, options);
+                if (ptr == nullptr)
+                {
+                    return;
+                }
+            }
+            this->tail_select(resources, root, *path, *ptr, receiver, options);
+        }
 
-            if (current.is_object())
+        reference evaluate(dynamic_resources<Json,JsonReference>& resources,
+                           reference root,
+                           const json_location_node_type& last, 
+                           reference current, 
+                           result_options options,
+                           std::error_code& ec) const override
+        {
+            const json_location_node_type* path = std::addressof(last);
+            pointer ptr = std::addressof(current);
+            for (const auto& step : steps_)
             {
-                auto it = current.find(identifier_);
-                if (it != current.object_range().end())
+                ptr = lookup(resources, step, *ptr, path, options);
+                if (ptr == nullptr)
                 {
-                    this->tail_select(resources, root, 
-                                        path_generator_type::generate(resources, last, identifier_, options),
-                                        it->value(), receiver, options);
+                    return resources.null_value();
                 }
             }
-            else if (current.is_array())
+            return this->evaluate_tail(resources, root, *path, *ptr, options, ec);
+        }
+
+        std::string to_string(int level = 0) const override
+        {
+            std::string s;
+            if (level > 0)
             {
-                int64_t n{0};
-                auto r = jsoncons::detail::to_integer_decimal(identifier_.data(), identifier_.size(), n);
-                if (r)
+                s.append("\n");
+                s.append(level*2, ' ');
+            }
+            s.append("lookup selector");
+            for (const auto& step : steps_)
+            {
+                if (step.is_index)
                 {
-                    std::size_t index = (n >= 0) ? static_cast<std::size_t>(n) : static_cast<std::size_t>(static_cast<int64_t>(current.size()) + n);
-                    if (index < current.size())
-                    {
-                        this->tail_select(resources, root, 
-                                            path_generator_type::generate(resources, last, index, options),
-                                            current[index], receiver, options);
-                    }
+                    s.append(" [");
+                    s.append(std::to_string(step.index));
+                    s.append("]");
                 }
-                else if (identifier_ == length_name && current.size() > 0)
+                else
                 {
-                    pointer ptr = resources.create_json(current.size());
-                    this->tail_select(resources, root, 
-                                        path_generator_type::generate(resources, last, identifier_, options), 
-                                        *ptr, 
-                                        receiver, options);
+                    s.append(" ");
+                    unicode_traits::convert(step.identifier.data(),step.identifier.size(),s);
                 }
             }
-            else if (current.is_string() && identifier_ == length_name)
+            s.append(base_selector<Json,JsonReference>::to_string(level+1));
+
+            return s;
+        }
+    private:
+        // Returns the selected value, or nullptr, and advances path
+        static pointer lookup(dynamic_resources<Json,JsonReference>& resources,
+                              const lookup_step& step,
+                              reference current,
+                              const json_location_node_type*& path,
+                              result_options options)
+        {
+            return step.is_index ? lookup_index(resources, step.index, current, path, options)
+                                 : lookup_identifier(resources, step.identifier, current, path, options);
+        }
+
+        static pointer lookup_index(dynamic_resources<Json,JsonReference>& resources,
+                                    int64_t index,
+                                    reference current,
+                                    const json_location_node_type*& path,
+                                    result_options options)
+        {
+            if (!current.is_array())
             {
-                string_view_type sv = current.as_string_view();
-                std::size_t count = unicode_traits::count_codepoints(sv.data(), sv.size());
-                pointer ptr = resources.create_json(count);
-                this->tail_select(resources, root, 
-                                    path_generator_type::generate(resources, last, identifier_, options), 
-                                    *ptr, receiver, options);
+                return nullptr;
+            }
+            int64_t slen = static_cast<int64_t>(current.size());
+            if (index < 0)
+            {
+                index += slen;
             }
-            //std::cout << "end identifier_selector\n";
+            if (index < 0 || index >= slen)
+            {
+                return nullptr;
+            }
+            std::size_t i = static_cast<std::size_t>(index);
+            path = std::addressof(path_generator_type::generate(resources, *path, i, options));
+            return std::addressof(current.at(i));
         }
 
-        reference evaluate(dynamic_resources<Json,JsonReference>& resources,
-                           reference root,
-                           const json_location_node_type& last, 
-                           reference current, 
-                           result_options options,
-                           std::error_code& ec) const override
+        static pointer lookup_identifier(dynamic_resources<Json,JsonReference>& resources,
+                                         const string_type& identifier,
+                                         reference current,
+                                         const json_location_node_type*& path,
+                                         result_options options)
         {
             static const char_type length_name[] = {'l', 'e', 'n', 'g', 't', 'h', 0};
 
             if (current.is_object())
             {
-                auto it = current.find(identifier_);
-                if (it != current.object_range().end())
-                {
-                    return this->evaluate_tail(resources, root, 
-                                               path_generator_type::generate(resources, last, identifier_, options),
-                                              it->value(), options, ec);
-                }
-                else
+                auto it = current.find(identifier);
+                if (it == current.object_range().end())
                 {
-                    return resources.null_value();
+                    return nullptr;
                 }
+                path = std::addressof(path_generator_type::generate(resources, *path, identifier, options));
+                return std::addressof(it->value());
             }
             else if (current.is_array())
             {
                 int64_t n{0};
-                auto r = jsoncons::detail::to_integer_decimal(identifier_.data(), identifier_.size(), n);
+                auto r = jsoncons::detail::to_integer_decimal(identifier.data(), identifier.size(), n);
                 if (r)
                 {
                     std::size_t index = (n >= 0) ? static_cast<std::size_t>(n) : static_cast<std::size_t>(static_cast<int64_t>(current.size()) + n);
-                    if (index < current.size())
+                    if (index >= current.size())
                     {
-                        return this->evaluate_tail(resources, root, 
-                                                   path_generator_type::generate(resources, last, index, options),
-                                                   current[index], options, ec);
-                    }
-                    else
-                    {
-                        return resources.null_value();
+                        return nullptr;
                     }
+                    path = std::addressof(path_generator_type::generate(resources, *path, index, options));
+                    return std::addressof(current[index]);
                 }
-                else if (identifier_ == length_name && current.size() > 0)
+                else if (identifier == length_name && current.size() > 0)
                 {
                     pointer ptr = resources.create_json(current.size());
-                    return this->evaluate_tail(resources, root, 
-                                               path_generator_type::generate(resources, last, identifier_, options), 
-                                               *ptr, 
-                                               options, ec);
-                }
-                else
-                {
-                    return resources.null_value();
+                    path = std::addressof(path_generator_type::generate(resources, *path, identifier, options));
+                    return ptr;
                 }
+                return nullptr;
             }
-            else if (current.is_string() && identifier_ == length_name)
+            else if (current.is_string() && identifier == length_name)
             {
                 string_view_type sv = current.as_string_view();
                 std::size_t count = unicode_traits::count_codepoints(sv.data(), sv.size());
                 pointer ptr = resources.create_json(count);
-                return this->evaluate_tail(resources, root, 
-                                           path_generator_type::generate(resources, last, identifier_, options), 
-                                           *ptr, options, ec);
-            }
-            else
-            {
-                return resources.null_value();
+                path = std::addressof(path_generator_type::generate(resources, *path, identifier, options));
+                return ptr;
             }
+            return nullptr;
         }
+    };
 
-        std::string to_string(int level = 0) const override
+    template <class Json,class JsonReference>
+    class identifier_selector final : public lookup_selector<Json,JsonReference>
+    {
+    public:
+        using string_view_type = basic_string_view<typename Json::char_type>;
+
+        identifier_selector(const string_view_type& identifier)
+            : lookup_selector<Json,JsonReference>(identifier)
         {
-            std::string s;
-            if (level > 0)
-            {
-                s.append("\n");
-                s.append(level*2, ' ');
-            }
-            s.append("identifier selector ");
-            unicode_traits::convert(identifier_.data(),identifier_.size(),s);
-            s.append(base_selector<Json,JsonReference>::to_string(level+1));
-            //s.append("\n");
+        }
+    };
 
-            return s;
+    template <class Json,class JsonReference>
+    class index_selector final : public lookup_selector<Json,JsonReference>
+    {
+    public:
+        index_selector(int64_t index)
+            : lookup_selector<Json,JsonReference>(index)
+        {
         }
     };
 
@@ -645,97 +735,6 @@ namespace detail {
         }
     };
 
-    template <class Json,class JsonReference>
-    class index_selector final : public base_selector<Json,JsonReference>
-    {
-        using supertype = base_selector<Json,JsonReference>;
-
-        int64_t index_;
-    public:
-        using value_type = typename supertype::value_type;
-        using reference = typename supertype::reference;
-        using pointer = typename supertype::pointer;
-        using path_value_pair_type = typename supertype::path_value_pair_type;
-        using json_location_node_type = typename supertype::json_location_node_type;
-        using path_generator_type = path_generator<Json,JsonReference>;
-        using node_receiver_type = typename supertype::node_receiver_type;
-
-        index_selector(int64_t index)
-            : base_selector<Json,JsonReference>(), index_(index)
-        {
-        }
-
-        void select(dynamic_resources<Json,JsonReference>& resources,
-                    reference root,
-                    const json_location_node_type& last, 
-                    reference current,
-                    node_receiver_type& receiver,
-                    result_options options) const override
-        {
-            if (current.is_array())
-            {
-                int64_t slen = static_cast<int64_t>(current.size());
-                if (index_ >= 0 && index_ < slen)
-                {
-                    std::size_t i = static_cast<std::size_t>(index_);
-                    this->tail_select(resources, root, 
-                                        path_generator_type::generate(resources, last, i, options), 
-                                        current.at(i), receiver, options);
-                }
-                else 
-                {
-                    int64_t index = slen + index_;
-                    if (index >= 0 && index < slen)
-                    {
-                        std::size_t i = static_cast<std::size_t>(index);
-                        this->tail_select(resources, root, 
-                                            path_generator_type::generate(resources, last, i, options), 
-                                            current.at(i), receiver, options);
-                    }
-                }
-            }
-        }
-
-        reference evaluate(dynamic_resources<Json,JsonReference>& resources,
-                           reference root,
-                           const json_location_node_type& last, 
-                           reference current, 
-                           result_options options,
-                           std::error_code& ec) const override
-        {
-            if (current.is_array())
-            {
-                int64_t slen = static_cast<int64_t>(current.size());
-                if (index_ >= 0 && index_ < slen)
-                {
-                    std::size_t i = static_cast<std::size_t>(index_);
-                    return this->evaluate_tail(resources, root, 
-                                        path_generator_type::generate(resources, last, i, options), 
-                                        current.at(i), options, ec);
-                }
-                else 
-                {
-                    int64_t index = slen + index_;
-                    if (index >= 0 && index < slen)
-                    {
-                        std::size_t i = static_cast<std::size_t>(index);
-                        return this->evaluate_tail(resources, root, 
-                                            path_generator_type::generate(resources, last, i, options), 
-                                            current.at(i), options, ec);
-                    }
-                    else
-                    {
-                        return resources.null_value();
-                    }
-                }
-            }
-            else
-            {
-                return resources.null_value();
-            }
-        }
-    };
-
     template <class Json,class JsonReference>
     class wildcard_selector final : public base_selector<Json,JsonReference>
     {
@@ -915,6 +914,10 @@ namespace detail {
             if (tail_ == nullptr)
             {
                 tail_ = tail;
+                if (tail->is_lookup())
+                {
+                    static_cast<lookup_selector<Json,JsonReference>*>(tail)->set_shared();
+                }
                 for (auto& selector : selectors_)
                 {
                     selector->append_selector(tail);
@@ -0,0 +1,1442 @@
+// Copyright 2022 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSONPATH_STREAM_QUERY_HPP
+#define JSONCONS_JSONPATH_STREAM_QUERY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits> // std::numeric_limits
+#include <memory> // std::addressof
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility> // std::move
+#include <vector>
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/staj_cursor.hpp>
+#include <jsoncons_ext/jsonpath/jsonpath_error.hpp>
+#include <jsoncons_ext/jsonpath/jsonpath_expression.hpp>
+
+namespace jsoncons {
+namespace jsonpath {
+
+namespace detail {
+
+    template <class CharT>
+    struct stream_path_element
+    {
+        std::basic_string<CharT> name;
+        std::size_t index;
+        bool is_index;
+    };
+
+    enum class stream_selector_kind : uint8_t {name, index, slice, wildcard, filter};
+
+    template <class CharT>
+    struct stream_selector
+    {
+        stream_selector_kind kind;
+        std::basic_string<CharT> name;
+        std::size_t start;  // index, or slice start
+        std::size_t stop;   // slice end, (max)() if open
+        std::size_t step;   // slice step
+        std::size_t filter; // root of the filter's nodes
+    };
+
+    template <class CharT>
+    struct stream_step
+    {
+        bool descendant;
+        std::vector<stream_selector<CharT>> selectors;
+
+        // Used to stop reading a container once the step can select no more of it
+        bool open_on_objects;
+        bool open_on_arrays;
+        std::size_t name_count;
+        std::size_t array_bound;
+    };
+
+    enum class stream_filter_op : uint8_t {exists, eq, ne, lt, le, gt, ge, not_op, and_op, or_op};
+
+    // For comparisons and exists, lhs and rhs are operands, otherwise filter nodes
+    struct stream_filter_node
+    {
+        stream_filter_op op;
+        std::size_t lhs;
+        std::size_t rhs;
+    };
+
+    template <class Json>
+    struct stream_operand
+    {
+        bool is_path;
+        std::vector<stream_path_element<typename Json::char_type>> path;
+        Json literal;
+    };
+
+    // A JSONPath expression restricted to selectors that can be decided in a
+    // single forward pass: names, non-negative indexes, wildcards, slices with
+    // non-negative bounds and step, recursive descent, and filters on the
+    // members of the current node compared with literals.
+
+    template <class Json>
+    struct stream_path
+    {
+        using char_type = typename Json::char_type;
+
+        std::vector<stream_step<char_type>> steps;
+        std::vector<stream_filter_node> filter_nodes;
+        std::vector<stream_operand<Json>> operands;
+
+        bool evaluate_filter(std::size_t node_index, const Json& current) const
+        {
+            const stream_filter_node& node = filter_nodes[node_index];
+            switch (node.op)
+            {
+                case stream_filter_op::not_op:
+                    return !evaluate_filter(node.lhs, current);
+                case stream_filter_op::and_op:
+                    return evaluate_filter(node.lhs, current) && evaluate_filter(node.rhs, current);
+                case stream_filter_op::or_op:
+                    return evaluate_filter(node.lhs, current) || evaluate_filter(node.rhs, current);
+                case stream_filter_op::exists:
+                {
+                    const Json* val = resolve(operands[node.lhs], current);
+                    return val != nullptr && !(val->is_null() || (val->is_bool() && !val->as_bool()) ||
+                                               ((val->is_string() || val->is_array() || val->is_object()) && val->empty()));
+                }
+                default:
+                {
+                    const Json* lhs = resolve(operands[node.lhs], current);
+                    const Json* rhs = resolve(operands[node.rhs], current);
+                    return lhs != nullptr && rhs != nullptr && compare(node.op, *lhs, *rhs);
+                }
+            }
+        }
+    private:
+        static const Json* resolve(const stream_operand<Json>& operand, const Json& current)
+        {
+            if (!operand.is_path)
+            {
+                return std::addressof(operand.literal);
+            }
+            const Json* val = std::addressof(current);
+            for (const auto& element : operand.path)
+            {
+                if (element.is_index)
+                {
+                    if (!val->is_array() || element.index >= val->size())
+                    {
+                        return nullptr;
+                    }
+                    val = std::addressof(val->at(element.index));
+                }
+                else
+                {
+                    if (!val->is_object())
+                    {
+                        return nullptr;
+                    }
+                    auto it = val->find(element.name);
+                    if (it == val->object_range().end())
+                    {
+                        return nullptr;
+                    }
+                    val = std::addressof(it->value());
+                }
+            }
+            return val;
+        }
+
+        static bool compare(stream_filter_op op, const Json& lhs, const Json& rhs)
+        {
+            if (op == stream_filter_op::eq)
+            {
+                return lhs == rhs;
+            }
+            if (op == stream_filter_op::ne)
+            {
+                return lhs != rhs;
+            }
+            if (!((lhs.is_number() && rhs.is_number()) || (lhs.is_string() && rhs.is_string())))
+            {
+                return false;
+            }
+            switch (op)
+            {
+                case stream_filter_op::lt:
+                    return lhs < rhs;
+                case stream_filter_op::le:
+                    return !(rhs < lhs);
+                case stream_filter_op::gt:
+                    return rhs < lhs;
+                case stream_filter_op::ge:
+                    return !(lhs < rhs);
+                default:
+                    return false;
+            }
+        }
+    };
+
+    // stream_path_parser maps a path that jsonpath_evaluator has already compiled
+    // to a stream_path, and fails with selector_not_streamable on the selectors
+    // that cannot be decided forward-only. It reads the path text rather than the
+    // compiled selectors because those are resolved against a whole document:
+    // lookup_selector takes an identifier on an array as an index and synthesizes
+    // length, negative indexes and slice bounds depend on the array size, and
+    // filters are compiled to a token stream of operators, functions and paths
+    // that exposes no structure to classify. Syntax errors are reported by
+    // jsonpath_evaluator, so the two parsers reject the same malformed paths,
+    // and a compiled path that this parser cannot map is not streamable.
+
+    template <class Json>
+    class stream_path_parser
+    {
+    public:
+        using char_type = typename Json::char_type;
+        using string_type = std::basic_string<char_type>;
+        using string_view_type = typename Json::string_view_type;
+    private:
+        using selector_type = stream_selector<char_type>;
+        using step_type = stream_step<char_type>;
+
+        static constexpr std::size_t npos = (std::numeric_limits<std::size_t>::max)();
+
+        const char_type* begin_;
+        const char_type* p_;
+        const char_type* end_;
+        stream_path<Json>& path_;
+    public:
+        stream_path_parser(const string_view_type& s, stream_path<Json>& path)
+            : begin_(s.data()), p_(s.data()), end_(s.data() + s.size()), path_(path)
+        {
+        }
+
+        std::size_t column() const
+        {
+            return static_cast<std::size_t>(p_ - begin_) + 1;
+        }
+
+        void parse(std::error_code& ec)
+        {
+            skip_whitespace();
+            if (p_ == end_ || *p_ != '$')
+            {
+                ec = jsonpath_errc::expected_root_or_function;
+                return;
+            }
+            ++p_;
+            while (p_ != end_ && !ec)
+            {
+                switch (*p_)
+                {
+                    case '.':
+                        ++p_;
+                        parse_dot_step(ec);
+                        break;
+                    case '[':
+                        parse_bracket_step(false, ec);
+                        break;
+                    case ' ':case '\t':case '\r':case '\n':
+                        skip_whitespace();
+                        if (p_ != end_)
+                        {
+                            ec = jsonpath_errc::expected_separator;
+                        }
+                        break;
+                    default:
+                        ec = jsonpath_errc::expected_separator;
+                        break;
+                }
+            }
+            if (!ec)
+            {
+                for (auto& step : path_.steps)
+                {
+                    compute_bounds(step);
+                }
+            }
+        }
+    private:
+        void parse_dot_step(std::error_code& ec)
+        {
+            bool descendant = false;
+            if (p_ != end_ && *p_ == '.')
+            {
+                descendant = true;
+                ++p_;
+            }
+            if (p_ == end_)
+            {
+                ec = jsonpath_errc::unexpected_eof;
+                return;
+            }
+            if (*p_ == '[' && descendant)
+            {
+                parse_bracket_step(true, ec);
+                return;
+            }
+            step_type step{descendant, {}, false, false, 0, 0};
+            if (*p_ == '*')
+            {
+                ++p_;
+                step.selectors.push_back(selector_type{stream_selector_kind::wildcard, string_type(), 0, 0, 0, 0});
+            }
+            else
+            {
+                string_type name;
+                parse_unquoted_string(name);
+                if (name.empty())
+                {
+                    ec = jsonpath_errc::expected_relative_path;
+                    return;
+                }
+                if (p_ != end_ && *p_ == '(')
+                {
+                    ec = jsonpath_errc::selector_not_streamable;
+                    return;
+                }
+                step.selectors.push_back(selector_type{stream_selector_kind::name, std::move(name), 0, 0, 0, 0});
+            }
+            path_.steps.push_back(std::move(step));
+        }
+
+        void parse_bracket_step(bool descendant, std::error_code& ec)
+        {
+            ++p_; // '['
+            step_type step{descendant, {}, false, false, 0, 0};
+            for (;;)
+            {
+                skip_whitespace();
+                if (p_ == end_)
+                {
+                    ec = jsonpath_errc::unexpected_eof;
+                    return;
+                }
+                parse_selector(step, ec);
+                if (ec)
+                {
+                    return;
+                }
+                skip_whitespace();
+                if (p_ == end_)
+                {
+                    ec = jsonpath_errc::unexpected_eof;
+                    return;
+                }
+                if (*p_ == ']')
+                {
+                    ++p_;
+                    break;
+                }
+                if (*p_ != ',')
+                {
+                    ec = jsonpath_errc::expected_comma_or_rbracket;
+                    return;
+                }
+                ++p_;
+            }
+            path_.steps.push_back(std::move(step));
+        }
+
+        void parse_selector(step_type& step, std::error_code& ec)
+        {
+            switch (*p_)
+            {
+                case '\'':case '\"':
+                {
+                    string_type name;
+                    parse_quoted_string(name, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    for (const auto& sel : step.selectors)
+                    {
+                        if (sel.kind == stream_selector_kind::name && sel.name == name)
+                        {
+                            return;
+                        }
+                    }
+                    step.selectors.push_back(selector_type{stream_selector_kind::name, std::move(name), 0, 0, 0, 0});
+                    break;
+                }
+                case '*':
+                    ++p_;
+                    step.selectors.push_back(selector_type{stream_selector_kind::wildcard, string_type(), 0, 0, 0, 0});
+                    break;
+                case '?':
+                {
+                    ++p_;
+                    std::size_t node = parse_or_expression(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    step.selectors.push_back(selector_type{stream_selector_kind::filter, string_type(), 0, 0, 0, node});
+                    break;
+                }
+                case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':case ':':
+                    parse_index_or_slice(step, ec);
+                    break;
+                case '-':case '$':case '@':case '(':
+                    // negative indexes need the array size, and computed
+                    // indexes may refer to values not yet read
+                    ec = jsonpath_errc::selector_not_streamable;
+                    break;
+                default:
+                    ec = jsonpath_errc::expected_bracket_specifier_or_union;
+                    break;
+            }
+        }
+
+        void parse_index_or_slice(step_type& step, std::error_code& ec)
+        {
+            std::size_t start = 0;
+            if (is_digit())
+            {
+                start = parse_size(ec);
+                if (ec)
+                {
+                    return;
+                }
+            }
+            skip_whitespace();
+            if (p_ == end_ || *p_ != ':')
+            {
+                step.selectors.push_back(selector_type{stream_selector_kind::index, string_type(), start, 0, 0, 0});
+                return;
+            }
+            ++p_;
+            skip_whitespace();
+            std::size_t stop = npos;
+            if (p_ != end_ && *p_ == '-')
+            {
+                ec = jsonpath_errc::selector_not_streamable;
+                return;
+            }
+            if (is_digit())
+            {
+                stop = parse_size(ec);
+                if (ec)
+                {
+                    return;
+                }
+            }
+            skip_whitespace();
+            std::size_t slice_step = 1;
+            if (p_ != end_ && *p_ == ':')
+            {
+                ++p_;
+                skip_whitespace();
+                if (p_ != end_ && *p_ == '-')
+                {
+                    ec = jsonpath_errc::selector_not_streamable;
+                    return;
+                }
+                if (is_digit())
+                {
+                    slice_step = parse_size(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    if (slice_step == 0)
+                    {
+                        ec = jsonpath_errc::step_cannot_be_zero;
+                        return;
+                    }
+                }
+            }
+            step.selectors.push_back(selector_type{stream_selector_kind::slice, string_type(), start, stop, slice_step, 0});
+        }
+
+        std::size_t parse_or_expression(std::error_code& ec)
+        {
+            std::size_t lhs = parse_and_expression(ec);
+            while (!ec)
+            {
+                skip_whitespace();
+                if (end_ - p_ < 2 || p_[0] != '|' || p_[1] != '|')
+                {
+                    break;
+                }
+                p_ += 2;
+                std::size_t rhs = parse_and_expression(ec);
+                lhs = add_node(stream_filter_op::or_op, lhs, rhs);
+            }
+            return lhs;
+        }
+
+        std::size_t parse_and_expression(std::error_code& ec)
+        {
+            std::size_t lhs = parse_unary_expression(ec);
+            while (!ec)
+            {
+                skip_whitespace();
+                if (end_ - p_ < 2 || p_[0] != '&' || p_[1] != '&')
+                {
+                    break;
+                }
+                p_ += 2;
+                std::size_t rhs = parse_unary_expression(ec);
+                lhs = add_node(stream_filter_op::and_op, lhs, rhs);
+            }
+            return lhs;
+        }
+
+        std::size_t parse_unary_expression(std::error_code& ec)
+        {
+            skip_whitespace();
+            if (p_ == end_)
+            {
+                ec = jsonpath_errc::unexpected_eof;
+                return 0;
+            }
+            if (*p_ == '!')
+            {
+                ++p_;
+                std::size_t operand = parse_unary_expression(ec);
+                return add_node(stream_filter_op::not_op, operand, 0);
+            }
+            if (*p_ == '(')
+            {
+                ++p_;
+                std::size_t node = parse_or_expression(ec);
+                if (ec)
+                {
+                    return 0;
+                }
+                skip_whitespace();
+                if (p_ == end_ || *p_ != ')')
+                {
+                    ec = jsonpath_errc::expected_rparen;
+                    return 0;
+                }
+                ++p_;
+                return node;
+            }
+            return parse_comparison(ec);
+        }
+
+        std::size_t parse_comparison(std::error_code& ec)
+        {
+            std::size_t lhs = parse_operand(ec);
+            if (ec)
+            {
+                return 0;
+            }
+            skip_whitespace();
+            stream_filter_op op = stream_filter_op::exists;
+            if (p_ != end_)
+            {
+                const bool followed_by_eq = end_ - p_ >= 2 && p_[1] == '=';
+                switch (*p_)
+                {
+                    case '=':
+                        if (!followed_by_eq)
+                        {
+                            ec = end_ - p_ >= 2 && p_[1] == '~' ? jsonpath_errc::selector_not_streamable : jsonpath_errc::expected_comparator;
+                            return 0;
+                        }
+                        op = stream_filter_op::eq;
+                        break;
+                    case '!':
+                        if (!followed_by_eq)
+                        {
+                            ec = jsonpath_errc::expected_comparator;
+                            return 0;
+                        }
+                        op = stream_filter_op::ne;
+                        break;
+                    case '<':
+                        op = followed_by_eq ? stream_filter_op::le : stream_filter_op::lt;
+                        break;
+                    case '>':
+                        op = followed_by_eq ? stream_filter_op::ge : stream_filter_op::gt;
+                        break;
+                    default:
+                        break;
+                }
+                if (op != stream_filter_op::exists)
+                {
+                    p_ += followed_by_eq ? 2 : 1;
+                }
+            }
+            if (op == stream_filter_op::exists)
+            {
+                return add_node(op, lhs, 0);
+            }
+            std::size_t rhs = parse_operand(ec);
+            return add_node(op, lhs, rhs);
+        }
+
+        std::size_t parse_operand(std::error_code& ec)
+        {
+            skip_whitespace();
+            if (p_ == end_)
+            {
+                ec = jsonpath_errc::unexpected_eof;
+                return 0;
+            }
+            stream_operand<Json> operand{false, {}, Json()};
+            switch (*p_)
+            {
+                case '@':
+                    ++p_;
+                    operand.is_path = true;
+                    parse_relative_path(operand.path, ec);
+                    break;
+                case '\'':case '\"':
+                {
+                    string_type s;
+                    parse_quoted_string(s, ec);
+                    operand.literal = Json(s);
+                    break;
+                }
+                case '-':case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
+                    operand.literal = parse_number(ec);
+                    break;
+                case '$':
+                    // absolute paths may refer to values not yet read
+                    ec = jsonpath_errc::selector_not_streamable;
+                    break;
+                default:
+                {
+                    string_type word;
+                    parse_unquoted_string(word);
+                    if (p_ != end_ && *p_ == '(')
+                    {
+                        ec = jsonpath_errc::selector_not_streamable;
+                    }
+                    else if (word == JSONCONS_STRING_CONSTANT(char_type, "true"))
+                    {
+                        operand.literal = Json(true);
+                    }
+                    else if (word == JSONCONS_STRING_CONSTANT(char_type, "false"))
+                    {
+                        operand.literal = Json(false);
+                    }
+                    else if (word == JSONCONS_STRING_CONSTANT(char_type, "null"))
+                    {
+                        operand.literal = Json::null();
+                    }
+                    else
+                    {
+                        ec = jsonpath_errc::syntax_error;
+                    }
+                    break;
+                }
+            }
+            if (ec)
+            {
+                return 0;
+            }
+            path_.operands.push_back(std::move(operand));
+            return path_.operands.size() - 1;
+        }
+
+        void parse_relative_path(std::vector<stream_path_element<char_type>>& path, std::error_code& ec)
+        {
+            while (p_ != end_)
+            {
+                if (*p_ == '.')
+                {
+                    ++p_;
+                    string_type name;
+                    parse_unquoted_string(name);
+                    if (name.empty())
+                    {
+                        ec = p_ != end_ && (*p_ == '.' || *p_ == '*') ? jsonpath_errc::selector_not_streamable : jsonpath_errc::expected_relative_path;
+                        return;
+                    }
+                    if (p_ != end_ && *p_ == '(')
+                    {
+                        ec = jsonpath_errc::selector_not_streamable;
+                        return;
+                    }
+                    path.push_back(stream_path_element<char_type>{std::move(name), 0, false});
+                }
+                else if (*p_ == '[')
+                {
+                    ++p_;
+                    skip_whitespace();
+                    if (p_ == end_)
+                    {
+                        ec = jsonpath_errc::unexpected_eof;
+                        return;
+                    }
+                    if (*p_ == '\'' || *p_ == '\"')
+                    {
+                        string_type name;
+                        parse_quoted_string(name, ec);
+                        if (ec)
+                        {
+                            return;
+                        }
+                        path.push_back(stream_path_element<char_type>{std::move(name), 0, false});
+                    }
+                    else if (is_digit())
+                    {
+                        std::size_t index = parse_size(ec);
+                        if (ec)
+                        {
+                            return;
+                        }
+                        path.push_back(stream_path_element<char_type>{string_type(), index, true});
+                    }
+                    else
+                    {
+                        ec = jsonpath_errc::selector_not_streamable;
+                        return;
+                    }
+                    skip_whitespace();
+                    if (p_ == end_ || *p_ != ']')
+                    {
+                        ec = jsonpath_errc::expected_rbracket;
+                        return;
+                    }
+                    ++p_;
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+
+        Json parse_number(std::error_code& ec)
+        {
+            const char_type* first = p_;
+            while (p_ != end_ && (is_digit() || *p_ == '-' || *p_ == '+' || *p_ == '.' || *p_ == 'e' || *p_ == 'E'))
+            {
+                ++p_;
+            }
+            json_decoder<Json> decoder;
+            basic_json_reader<char_type,string_source<char_type>> reader(string_view_type(first, static_cast<std::size_t>(p_ - first)), decoder);
+            std::error_code parse_ec;
+            reader.read(parse_ec);
+            if (parse_ec || !decoder.is_valid())
+            {
+                ec = jsonpath_errc::invalid_number;
+                return Json();
+            }
+            return decoder.get_result();
+        }
+
+        void parse_unquoted_string(string_type& s)
+        {
+            while (p_ != end_)
+            {
+                const char_type c = *p_;
+                if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' ||
+                    typename std::make_unsigned<char_type>::type(c) > 127)
+                {
+                    s.push_back(c);
+                    ++p_;
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+
+        void parse_quoted_string(string_type& s, std::error_code& ec)
+        {
+            const char_type quote = *p_++;
+            while (p_ != end_)
+            {
+                const char_type c = *p_++;
+                if (c == quote)
+                {
+                    return;
+                }
+                if (c != '\\')
+                {
+                    s.push_back(c);
+                    continue;
+                }
+                if (p_ == end_)
+                {
+                    break;
+                }
+                switch (*p_++)
+                {
+                    case '\\': s.push_back('\\'); break;
+                    case '/': s.push_back('/'); break;
+                    case '\'': s.push_back('\''); break;
+                    case '\"': s.push_back('\"'); break;
+                    case 'b': s.push_back('\b'); break;
+                    case 'f': s.push_back('\f'); break;
+                    case 'n': s.push_back('\n'); break;
+                    case 'r': s.push_back('\r'); break;
+                    case 't': s.push_back('\t'); break;
+                    case 'u':
+                    {
+                        uint32_t cp = parse_hex4(ec);
+                        if (ec)
+                        {
+                            return;
+                        }
+                        if (unicode_traits::is_high_surrogate(cp))
+                        {
+                            if (end_ - p_ < 2 || p_[0] != '\\' || p_[1] != 'u')
+                            {
+                                ec = jsonpath_errc::invalid_codepoint;
+                                return;
+                            }
+                            p_ += 2;
+                            uint32_t cp2 = parse_hex4(ec);
+                            if (ec)
+                            {
+                                return;
+                            }
+                            cp = 0x10000 + ((cp & 0x3FF) << 10) + (cp2 & 0x3FF);
+                        }
+                        unicode_traits::convert(&cp, 1, s);
+                        break;
+                    }
+                    default:
+                        ec = jsonpath_errc::illegal_escaped_character;
+                        return;
+                }
+            }
+            ec = jsonpath_errc::unexpected_eof;
+        }
+
+        uint32_t parse_hex4(std::error_code& ec)
+        {
+            uint32_t cp = 0;
+            for (int i = 0; i < 4; ++i)
+            {
+                if (p_ == end_)
+                {
+                    ec = jsonpath_errc::unexpected_eof;
+                    return 0;
+                }
+                const char_type c = *p_++;
+                cp <<= 4;
+                if (c >= '0' && c <= '9')
+                {
+                    cp += static_cast<uint32_t>(c - '0');
+                }
+                else if (c >= 'a' && c <= 'f')
+                {
+                    cp += static_cast<uint32_t>(c - 'a' + 10);
+                }
+                else if (c >= 'A' && c <= 'F')
+                {
+                    cp += static_cast<uint32_t>(c - 'A' + 10);
+                }
+                else
+                {
+                    ec = jsonpath_errc::invalid_codepoint;
+                    return 0;
+                }
+            }
+            return cp;
+        }
+
+        std::size_t parse_size(std::error_code& ec)
+        {
+            std::size_t n = 0;
+            while (is_digit())
+            {
+                const std::size_t digit = static_cast<std::size_t>(*p_ - '0');
+                if (n > (npos - digit) / 10)
+                {
+                    ec = jsonpath_errc::invalid_number;
+                    return 0;
+                }
+                n = n*10 + digit;
+                ++p_;
+            }
+            return n;
+        }
+
+        bool is_digit() const
+        {
+            return p_ != end_ && *p_ >= '0' && *p_ <= '9';
+        }
+
+        void skip_whitespace()
+        {
+            while (p_ != end_ && (*p_ == ' ' || *p_ == '\t' || *p_ == '\r' || *p_ == '\n'))
+            {
+                ++p_;
+            }
+        }
+
+        std::size_t add_node(stream_filter_op op, std::size_t lhs, std::size_t rhs)
+        {
+            path_.filter_nodes.push_back(stream_filter_node{op, lhs, rhs});
+            return path_.filter_nodes.size() - 1;
+        }
+
+        static void compute_bounds(step_type& step)
+        {
+            step.open_on_objects = step.descendant;
+            step.open_on_arrays = step.descendant;
+            step.name_count = 0;
+            step.array_bound = 0;
+            for (const auto& sel : step.selectors)
+            {
+                switch (sel.kind)
+                {
+                    case stream_selector_kind::name:
+                        ++step.name_count;
+                        break;
+                    case stream_selector_kind::index:
+                        step.array_bound = (std::max)(step.array_bound, sel.start + 1);
+                        break;
+                    case stream_selector_kind::slice:
+                        if (sel.stop == npos)
+                        {
+                            step.open_on_arrays = true;
+                        }
+                        else
+                        {
+                            step.array_bound = (std::max)(step.array_bound, sel.stop);
+                        }
+                        break;
+                    default:
+                        step.open_on_objects = true;
+                        step.open_on_arrays = true;
+                        break;
+                }
+            }
+        }
+    };
+
+    // Walks the events of a cursor, keeping for each open container the steps of
+    // the path reached there. Values that no step can reach are skipped without
+    // being decoded. Values that are selected, or that a filter must see, are
+    // decoded and the rest of the path is evaluated on them in memory.
+
+    template <class Json,class BinaryCallback>
+    class stream_evaluator
+    {
+    public:
+        using char_type = typename Json::char_type;
+        using string_type = std::basic_string<char_type>;
+        using string_view_type = typename Json::string_view_type;
+        using cursor_type = basic_staj_cursor<char_type>;
+    private:
+        using element_type = stream_path_element<char_type>;
+
+        const stream_path<Json>& path_;
+        BinaryCallback& callback_;
+
+        // Step positions reached at each level, a position equal to the number
+        // of steps means the value is selected
+        std::vector<std::size_t> positions_;
+        std::vector<element_type> location_;
+        std::size_t location_size_;
+        string_type buffer_;
+        json_decoder<Json> decoder_;
+
+        // Containers left unread when the walk stopped early
+        std::size_t pending_depth_;
+    public:
+        stream_evaluator(const stream_path<Json>& path, BinaryCallback& callback)
+            : path_(path), callback_(callback), location_size_(0), pending_depth_(0)
+        {
+        }
+
+        void evaluate(cursor_type& cursor, std::error_code& ec)
+        {
+            if (cursor.done())
+            {
+                return;
+            }
+            positions_.push_back(0);
+            visit(cursor, 0, 0, 0, 1, false, ec);
+        }
+    private:
+        // Visits the value at the cursor, which reaches the positions in [first,last)
+        // from the positions of its parent in [parent_first,parent_last)
+        void visit(cursor_type& cursor, std::size_t parent_first, std::size_t parent_last,
+                   std::size_t first, std::size_t last, bool needs_value, std::error_code& ec)
+        {
+            if (needs_value || contains_selected(first, last))
+            {
+                decoder_.reset();
+                cursor.read_to(decoder_, ec);
+                if (ec)
+                {
+                    return;
+                }
+                Json value = decoder_.get_result();
+                if (needs_value)
+                {
+                    positions_.resize(first);
+                    std::size_t hits = 0;
+                    select_child(parent_first, parent_last, &value, needs_value, hits);
+                    last = positions_.size();
+                }
+                select_value(value, first, last);
+            }
+            else if (first == last)
+            {
+                cursor.skip(ec);
+            }
+            else
+            {
+                switch (cursor.current().event_type())
+                {
+                    case staj_event_type::begin_object:
+                        walk(cursor, first, last, true, ec);
+                        break;
+                    case staj_event_type::begin_array:
+                        walk(cursor, first, last, false, ec);
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+
+        void walk(cursor_type& cursor, std::size_t first, std::size_t last, bool is_object, std::error_code& ec)
+        {
+            const staj_event_type end_event = is_object ? staj_event_type::end_object : staj_event_type::end_array;
+
+            // For objects, how many of the named members may still be selected,
+            // for arrays, the index past which no element may be
+            bool open = false;
+            std::size_t remaining = 0;
+            for (std::size_t i = first; i < last; ++i)
+            {
+                const auto& step = path_.steps[positions_[i]];
+                if (is_object)
+                {
+                    open = open || step.open_on_objects;
+                    remaining += step.name_count;
+                }
+                else
+                {
+                    open = open || step.open_on_arrays;
+                    remaining = (std::max)(remaining, step.array_bound);
+                }
+            }
+            if (!open && remaining == 0)
+            {
+                pending_depth_ = 1;
+                return;
+            }
+
+            cursor.next(ec);
+            std::size_t index = 0;
+            while (!ec && cursor.current().event_type() != end_event)
+            {
+                element_type& element = push_location();
+                if (is_object)
+                {
+                    auto key = cursor.current().template get<string_view_type>(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    element.name.assign(key.data(), key.size());
+                    element.is_index = false;
+                    cursor.next(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                }
+                else
+                {
+                    element.index = index;
+                    element.is_index = true;
+                }
+
+                const std::size_t child_first = positions_.size();
+                bool needs_value = false;
+                std::size_t hits = 0;
+                select_child(first, last, nullptr, needs_value, hits);
+                visit(cursor, first, last, child_first, positions_.size(), needs_value, ec);
+                positions_.resize(child_first);
+                --location_size_;
+                if (ec)
+                {
+                    return;
+                }
+
+                ++index;
+                bool exhausted = false;
+                if (!open)
+                {
+                    if (is_object)
+                    {
+                        remaining = hits < remaining ? remaining - hits : 0;
+                        exhausted = remaining == 0;
+                    }
+                    else
+                    {
+                        exhausted = index >= remaining;
+                    }
+                }
+                if (pending_depth_ > 0)
+                {
+                    if (exhausted)
+                    {
+                        ++pending_depth_;
+                        return;
+                    }
+                    skip_to_end(cursor, pending_depth_, ec);
+                    pending_depth_ = 0;
+                    if (ec)
+                    {
+                        return;
+                    }
+                }
+                else if (exhausted)
+                {
+                    pending_depth_ = 1;
+                    return;
+                }
+                cursor.next(ec);
+            }
+        }
+
+        void select_value(const Json& value, std::size_t first, std::size_t last)
+        {
+            if (contains_selected(first, last))
+            {
+                emit(value);
+                bool more = false;
+                for (std::size_t i = first; i < last && !more; ++i)
+                {
+                    more = positions_[i] != path_.steps.size();
+                }
+                if (!more)
+                {
+                    return;
+                }
+            }
+            bool needs_value = false;
+            std::size_t hits = 0;
+            if (value.is_object())
+            {
+                for (const auto& member : value.object_range())
+                {
+                    element_type& element = push_location();
+                    element.name.assign(member.key().data(), member.key().size());
+                    element.is_index = false;
+                    const std::size_t child_first = positions_.size();
+                    select_child(first, last, std::addressof(member.value()), needs_value, hits);
+                    if (positions_.size() > child_first)
+                    {
+                        select_value(member.value(), child_first, positions_.size());
+                    }
+                    positions_.resize(child_first);
+                    --location_size_;
+                }
+            }
+            else if (value.is_array())
+            {
+                std::size_t index = 0;
+                for (const auto& item : value.array_range())
+                {
+                    element_type& element = push_location();
+                    element.index = index++;
+                    element.is_index = true;
+                    const std::size_t child_first = positions_.size();
+                    select_child(first, last, std::addressof(item), needs_value, hits);
+                    if (positions_.size() > child_first)
+                    {
+                        select_value(item, child_first, positions_.size());
+                    }
+                    positions_.resize(child_first);
+                    --location_size_;
+                }
+            }
+        }
+
+        // Appends the positions that the member or element at the top of the
+        // location reaches from the positions in [first,last). If a filter needs
+        // the value and value is null, sets needs_value. Counts in hits the
+        // member names selected by steps that are not recursive descents.
+        void select_child(std::size_t first, std::size_t last, const Json* value,
+                          bool& needs_value, std::size_t& hits)
+        {
+            const element_type& element = location_[location_size_-1];
+            const std::size_t child_first = positions_.size();
+            for (std::size_t i = first; i < last; ++i)
+            {
+                const std::size_t pos = positions_[i];
+                if (pos == path_.steps.size())
+                {
+                    continue;
+                }
+                const auto& step = path_.steps[pos];
+                if (step.descendant)
+                {
+                    add_position(child_first, pos);
+                }
+                bool selected = false;
+                for (const auto& sel : step.selectors)
+                {
+                    switch (sel.kind)
+                    {
+                        case stream_selector_kind::name:
+                            selected = !element.is_index && element.name == sel.name;
+                            if (selected && !step.descendant)
+                            {
+                                ++hits;
+                            }
+                            break;
+                        case stream_selector_kind::index:
+                            selected = element.is_index && element.index == sel.start;
+                            break;
+                        case stream_selector_kind::slice:
+                            selected = element.is_index && element.index >= sel.start && element.index < sel.stop &&
+                                       (element.index - sel.start) % sel.step == 0;
+                            break;
+                        case stream_selector_kind::wildcard:
+                            selected = true;
+                            break;
+                        case stream_selector_kind::filter:
+                            if (value == nullptr)
+                            {
+                                needs_value = true;
+                            }
+                            else
+                            {
+                                selected = path_.evaluate_filter(sel.filter, *value);
+                            }
+                            break;
+                    }
+                    if (selected)
+                    {
+                        break;
+                    }
+                }
+                if (selected)
+                {
+                    add_position(child_first, pos + 1);
+                }
+            }
+        }
+
+        void add_position(std::size_t child_first, std::size_t pos)
+        {
+            for (std::size_t i = child_first; i < positions_.size(); ++i)
+            {
+                if (positions_[i] == pos)
+                {
+                    return;
+                }
+            }
+            positions_.push_back(pos);
+        }
+
+        bool contains_selected(std::size_t first, std::size_t last) const
+        {
+            for (std::size_t i = first; i < last; ++i)
+            {
+                if (positions_[i] == path_.steps.size())
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        element_type& push_location()
+        {
+            if (location_size_ == location_.size())
+            {
+                location_.push_back(element_type{string_type(), 0, false});
+            }
+            return location_[location_size_++];
+        }
+
+        void emit(const Json& value)
+        {
+            buffer_.clear();
+            buffer_.push_back('$');
+            for (std::size_t i = 0; i < location_size_; ++i)
+            {
+                const element_type& element = location_[i];
+                buffer_.push_back('[');
+                if (element.is_index)
+                {
+                    jsoncons::detail::from_integer(element.index, buffer_);
+                }
+                else
+                {
+                    buffer_.push_back('\'');
+                    for (auto c : element.name)
+                    {
+                        if (c == '\'')
+                        {
+                            buffer_.push_back('\\');
+                        }
+                        buffer_.push_back(c);
+                    }
+                    buffer_.push_back('\'');
+                }
+                buffer_.push_back(']');
+            }
+            callback_(buffer_, value);
+        }
+
+        // Advances to the end event of the depth'th enclosing container
+        static void skip_to_end(cursor_type& cursor, std::size_t depth, std::error_code& ec)
+        {
+            while (depth > 0)
+            {
+                cursor.next(ec);
+                if (ec || cursor.done())
+                {
+                    return;
+                }
+                switch (cursor.current().event_type())
+                {
+                    case staj_event_type::begin_object:
+                    case staj_event_type::begin_array:
+                        ++depth;
+                        break;
+                    case staj_event_type::end_object:
+                    case staj_event_type::end_array:
+                        --depth;
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+    };
+
+} // namespace detail
+
+    template <class Json>
+    class stream_expression
+    {
+    public:
+        using char_type = typename Json::char_type;
+        using string_type = std::basic_string<char_type>;
+        using string_view_type = typename Json::string_view_type;
+        using cursor_type = basic_staj_cursor<char_type>;
+    private:
+        detail::stream_path<Json> path_;
+    public:
+        stream_expression() = default;
+
+        stream_expression(const stream_expression&) = default;
+        stream_expression(stream_expression&&) = default;
+        stream_expression& operator=(const stream_expression&) = default;
+        stream_expression& operator=(stream_expression&&) = default;
+
+        template <class BinaryCallback>
+        typename std::enable_if<traits_extension::is_binary_function_object<BinaryCallback,const string_type&,const Json&>::value,void>::type
+        evaluate(cursor_type& cursor, BinaryCallback callback) const
+        {
+            std::error_code ec;
+            evaluate(cursor, callback, ec);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+            }
+        }
+
+        template <class BinaryCallback>
+        typename std::enable_if<traits_extension::is_binary_function_object<BinaryCallback,const string_type&,const Json&>::value,void>::type
+        evaluate(cursor_type& cursor, BinaryCallback callback, std::error_code& ec) const
+        {
+            detail::stream_evaluator<Json,BinaryCallback> evaluator(path_, callback);
+            evaluator.evaluate(cursor, ec);
+        }
+
+        Json evaluate(cursor_type& cursor) const
+        {
+            Json result(json_array_arg);
+            evaluate(cursor, [&result](const string_type&, const Json& val){result.push_back(val);});
+            return result;
+        }
+
+        Json evaluate(cursor_type& cursor, std::error_code& ec) const
+        {
+            Json result(json_array_arg);
+            evaluate(cursor, [&result](const string_type&, const Json& val){result.push_back(val);}, ec);
+            return result;
+        }
+
+        static stream_expression compile(const string_view_type& path)
+        {
+            jsoncons::jsonpath::detail::static_resources<Json,const Json&> resources;
+            jsoncons::jsonpath::detail::jsonpath_evaluator<Json,const Json&> e;
+            e.compile(resources, path);
+
+            std::error_code ec;
+            stream_expression expr;
+            detail::stream_path_parser<Json> parser(path, expr.path_);
+            parser.parse(ec);
+            if (ec)
+            {
+                JSONCONS_THROW(jsonpath_error(jsonpath_errc::selector_not_streamable, 1, parser.column()));
+            }
+            return expr;
+        }
+
+        static stream_expression compile(const string_view_type& path, std::error_code& ec)
+        {
+            jsoncons::jsonpath::detail::static_resources<Json,const Json&> resources;
+            jsoncons::jsonpath::detail::jsonpath_evaluator<Json,const Json&> e;
+            e.compile(resources, path, ec);
+            if (ec)
+            {
+                return stream_expression();
+            }
+
+            stream_expression expr;
+            detail::stream_path_parser<Json> parser(path, expr.path_);
+            parser.parse(ec);
+            if (ec)
+            {
+                ec = jsonpath_errc::selector_not_streamable;
+                return stream_expression();
+            }
+            return expr;
+        }
+    };
+
+    template <class Json>
+    stream_expression<Json> make_stream_expression(const typename Json::string_view_type& path)
+    {
+        return stream_expression<Json>::compile(path);
+    }
+
+    template <class Json>
+    stream_expression<Json> make_stream_expression(const typename Json::string_view_type& path, std::error_code& ec)
+    {
+        return stream_expression<Json>::compile(path, ec);
+    }
+
+    template <class Json>
+    Json stream_query(basic_staj_cursor<typename Json::char_type>& cursor,
+                      const typename Json::string_view_type& path)
+    {
+        return make_stream_expression<Json>(path).evaluate(cursor);
+    }
+
+    template <class Json,class BinaryCallback>
+    typename std::enable_if<traits_extension::is_binary_function_object<BinaryCallback,const std::basic_string<typename Json::char_type>&,const Json&>::value,void>::type
+    stream_query(basic_staj_cursor<typename Json::char_type>& cursor,
+                 const typename Json::string_view_type& path,
+                 BinaryCallback callback)
+    {
+        make_stream_expression<Json>(path).evaluate(cursor, callback);
+    }
+
+} // namespace jsonpath
+} // namespace jsoncons
+
+#endif
@@ -13,6 +13,7 @@
 #include <iostream>
 #include <iterator>
 #include <utility> // std::move
+#include <algorithm> // std::min
 #include <system_error> // system_error
 #include <type_traits> // std::enable_if, std::true_type
 #include <jsoncons/json.hpp>
@@ -441,6 +442,194 @@ namespace jsoncons { namespace jsonpointer {
     using json_pointer = basic_json_pointer<char>;
     using wjson_pointer = basic_json_pointer<wchar_t>;
 
+    // basic_compiled_json_pointer
+
+    // A JSON Pointer parsed for repeated evaluation. Tokens are classified once
+    // as array indexes or member names, array indexes are converted to integers,
+    // and the member names are held in a single buffer.
+
+    template <class CharT>
+    class basic_compiled_json_pointer
+    {
+    public:
+        using char_type = CharT;
+        using string_type = std::basic_string<char_type>;
+        using string_view_type = jsoncons::basic_string_view<char_type>;
+    private:
+        struct token_info
+        {
+            std::size_t offset;
+            std::size_t length;
+            std::size_t index;
+            bool is_index;
+        };
+
+        string_type buffer_;
+        std::vector<token_info> tokens_;
+    public:
+        basic_compiled_json_pointer() = default;
+
+        explicit basic_compiled_json_pointer(const basic_json_pointer<CharT>& location)
+        {
+            std::size_t length = 0;
+            std::size_t count = 0;
+            for (const auto& token : location)
+            {
+                length += token.size();
+                ++count;
+            }
+            buffer_.reserve(length);
+            tokens_.reserve(count);
+            for (const auto& token : location)
+            {
+                token_info info{buffer_.size(), token.size(), 0, false};
+                auto result = jsoncons::detail::to_integer_decimal(token.data(), token.size(), info.index);
+                info.is_index = result ? true : false;
+                buffer_.append(token);
+                tokens_.push_back(info);
+            }
+        }
+
+        explicit basic_compiled_json_pointer(const string_view_type& s)
+            : basic_compiled_json_pointer(basic_json_pointer<CharT>(s))
+        {
+        }
+
+        basic_compiled_json_pointer(const string_view_type& s, std::error_code& ec)
+        {
+            auto location = basic_json_pointer<CharT>::parse(s, ec);
+            if (!ec)
+            {
+                *this = basic_compiled_json_pointer(location);
+            }
+        }
+
+        basic_compiled_json_pointer(const basic_compiled_json_pointer&) = default;
+        basic_compiled_json_pointer(basic_compiled_json_pointer&&) = default;
+        basic_compiled_json_pointer& operator=(const basic_compiled_json_pointer&) = default;
+        basic_compiled_json_pointer& operator=(basic_compiled_json_pointer&&) = default;
+
+        bool empty() const noexcept
+        {
+            return tokens_.empty();
+        }
+
+        std::size_t size() const noexcept
+        {
+            return tokens_.size();
+        }
+
+        string_view_type token(std::size_t i) const
+        {
+            return string_view_type(buffer_.data() + tokens_[i].offset, tokens_[i].length);
+        }
+
+        bool is_index(std::size_t i) const
+        {
+            return tokens_[i].is_index;
+        }
+
+        std::size_t index(std::size_t i) const
+        {
+            return tokens_[i].index;
+        }
+
+        basic_json_pointer<CharT> to_json_pointer() const
+        {
+            std::vector<string_type> tokens;
+            tokens.reserve(tokens_.size());
+            for (std::size_t i = 0; i < tokens_.size(); ++i)
+            {
+                tokens.emplace_back(token(i));
+            }
+            return basic_json_pointer<CharT>(std::move(tokens));
+        }
+
+        string_type to_string() const
+        {
+            return to_json_pointer().to_string();
+        }
+
+        // The number of leading tokens that this pointer and other have in common
+        std::size_t common_prefix(const basic_compiled_json_pointer& other) const noexcept
+        {
+            std::size_t n = (std::min)(tokens_.size(), other.tokens_.size());
+            std::size_t i = 0;
+            while (i < n && token(i) == other.token(i))
+            {
+                ++i;
+            }
+            return i;
+        }
+
+        // Returns the member or element of current that token i refers to
+        template <class Json>
+        Json* resolve_token(Json* current, std::size_t i, std::error_code& ec) const
+        {
+            const token_info& info = tokens_[i];
+            if (current->is_array())
+            {
+                if (!info.is_index)
+                {
+                    ec = info.length == 1 && buffer_[info.offset] == '-' ? jsonpointer_errc::index_exceeds_array_size : jsonpointer_errc::invalid_index;
+                    return nullptr;
+                }
+                if (info.index >= current->size())
+                {
+                    ec = jsonpointer_errc::index_exceeds_array_size;
+                    return nullptr;
+                }
+                return std::addressof(current->at(info.index));
+            }
+            else if (current->is_object())
+            {
+                auto it = current->find(token(i));
+                if (it == current->object_range().end())
+                {
+                    ec = jsonpointer_errc::key_not_found;
+                    return nullptr;
+                }
+                return std::addressof(it->value());
+            }
+            else
+            {
+                ec = jsonpointer_errc::expected_object_or_array;
+                return nullptr;
+            }
+        }
+
+        friend bool operator==(const basic_compiled_json_pointer& lhs, const basic_compiled_json_pointer& rhs)
+        {
+            return lhs.size() == rhs.size() && lhs.common_prefix(rhs) == lhs.size();
+        }
+
+        friend bool operator!=(const basic_compiled_json_pointer& lhs, const basic_compiled_json_pointer& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        // Orders pointers token by token, so that pointers with common prefixes are adjacent
+        friend bool operator<(const basic_compiled_json_pointer& lhs, const basic_compiled_json_pointer& rhs)
+        {
+            std::size_t i = lhs.common_prefix(rhs);
+            if (i == lhs.size() || i == rhs.size())
+            {
+                return lhs.size() < rhs.size();
+            }
+            return lhs.token(i) < rhs.token(i);
+        }
+
+        friend std::basic_ostream<CharT>&
+        operator<<(std::basic_ostream<CharT>& os, const basic_compiled_json_pointer<CharT>& p)
+        {
+            os << p.to_string();
+            return os;
+        }
+    };
+
+    using compiled_json_pointer = basic_compiled_json_pointer<char>;
+    using wcompiled_json_pointer = basic_compiled_json_pointer<wchar_t>;
+
     #if !defined(JSONCONS_NO_DEPRECATED)
     template<class CharT>
     using basic_address = basic_json_pointer<CharT>;
@@ -716,6 +905,118 @@ namespace jsoncons { namespace jsonpointer {
         return !ec ? true : false;
     }
 
+    // get with a compiled pointer
+
+    template<class Json>
+    Json& get(Json& root, 
+              const basic_compiled_json_pointer<typename Json::char_type>& location, 
+              std::error_code& ec)
+    {
+        Json* current = std::addressof(root);
+        for (std::size_t i = 0; i < location.size(); ++i)
+        {
+            Json* next = location.resolve_token(current, i, ec);
+            if (ec)
+            {
+                return *current;
+            }
+            current = next;
+        }
+        return *current;
+    }
+
+    template<class Json>
+    const Json& get(const Json& root, 
+                    const basic_compiled_json_pointer<typename Json::char_type>& location, 
+                    std::error_code& ec)
+    {
+        const Json* current = std::addressof(root);
+        for (std::size_t i = 0; i < location.size(); ++i)
+        {
+            const Json* next = location.resolve_token(current, i, ec);
+            if (ec)
+            {
+                return *current;
+            }
+            current = next;
+        }
+        return *current;
+    }
+
+    template<class Json>
+    Json& get(Json& root, const basic_compiled_json_pointer<typename Json::char_type>& location)
+    {
+        std::error_code ec;
+        Json& j = get(root, location, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(jsonpointer_error(ec));
+        }
+        return j;
+    }
+
+    template<class Json>
+    const Json& get(const Json& root, const basic_compiled_json_pointer<typename Json::char_type>& location)
+    {
+        std::error_code ec;
+        const Json& j = get(root, location, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(jsonpointer_error(ec));
+        }
+        return j;
+    }
+
+    template<class Json>
+    bool contains(const Json& root, const basic_compiled_json_pointer<typename Json::char_type>& location)
+    {
+        std::error_code ec;
+        get(root, location, ec);
+        return !ec ? true : false;
+    }
+
+    // get_many
+
+    // Sets results[i] to the value that locations[i] refers to, or to null if there
+    // is none. The values along the previous location are kept, and each location
+    // resolves only the tokens after those it has in common with the previous one,
+    // so locations sorted with operator< walk the document once.
+    template<class Json>
+    void get_many(Json& root, 
+                  const std::vector<basic_compiled_json_pointer<typename std::remove_const<Json>::type::char_type>>& locations,
+                  std::vector<Json*>& results)
+    {
+        results.assign(locations.size(), nullptr);
+
+        // nodes[i] is the value at the first i tokens of the previous location
+        std::vector<Json*> nodes;
+        nodes.push_back(std::addressof(root));
+        const basic_compiled_json_pointer<typename std::remove_const<Json>::type::char_type>* previous = nullptr;
+
+        for (std::size_t k = 0; k < locations.size(); ++k)
+        {
+            const auto& location = locations[k];
+            std::size_t depth = previous == nullptr ? 0 : (std::min)(location.common_prefix(*previous), nodes.size() - 1);
+            nodes.resize(depth + 1);
+
+            std::error_code ec;
+            for (std::size_t i = depth; i < location.size(); ++i)
+            {
+                Json* next = location.resolve_token(nodes.back(), i, ec);
+                if (ec)
+                {
+                    break;
+                }
+                nodes.push_back(next);
+            }
+            if (!ec)
+            {
+                results[k] = nodes.back();
+            }
+            previous = std::addressof(location);
+        }
+    }
+
     template<class Json,class T>
     void add(Json& root, 
              const basic_json_pointer<typename Json::char_type>& location, 
@@ -1233,6 +1534,248 @@ namespace jsoncons { namespace jsonpointer {
         }
     }
 
+    // add, replace and remove with a compiled pointer
+
+    namespace detail {
+
+    // Returns the value that holds the last token of location
+    template <class Json>
+    Json* resolve_parent(Json& root,
+                         const basic_compiled_json_pointer<typename Json::char_type>& location,
+                         bool create_if_missing,
+                         std::error_code& ec)
+    {
+        Json* current = std::addressof(root);
+        for (std::size_t i = 0; i + 1 < location.size(); ++i)
+        {
+            current = create_if_missing ? resolve(current, location.token(i), true, ec) : location.resolve_token(current, i, ec);
+            if (ec)
+            {
+                return nullptr;
+            }
+        }
+        return current;
+    }
+
+    } // namespace detail
+
+    template<class Json,class T>
+    void add(Json& root,
+             const basic_compiled_json_pointer<typename Json::char_type>& location,
+             T&& value,
+             bool create_if_missing,
+             std::error_code& ec)
+    {
+        if (location.empty())
+        {
+            add(root, location.to_json_pointer(), std::forward<T>(value), create_if_missing, ec);
+            return;
+        }
+        Json* current = jsoncons::jsonpointer::detail::resolve_parent(root, location, create_if_missing, ec);
+        if (ec)
+        {
+            return;
+        }
+        const std::size_t last = location.size() - 1;
+        if (current->is_array())
+        {
+            if (!location.is_index(last))
+            {
+                auto token = location.token(last);
+                if (token.size() == 1 && token[0] == '-')
+                {
+                    current->emplace_back(std::forward<T>(value));
+                }
+                else
+                {
+                    ec = jsonpointer_errc::invalid_index;
+                }
+                return;
+            }
+            std::size_t index = location.index(last);
+            if (index > current->size())
+            {
+                ec = jsonpointer_errc::index_exceeds_array_size;
+                return;
+            }
+            if (index == current->size())
+            {
+                current->emplace_back(std::forward<T>(value));
+            }
+            else
+            {
+                current->insert(current->array_range().begin()+index,std::forward<T>(value));
+            }
+        }
+        else if (current->is_object())
+        {
+            current->insert_or_assign(location.token(last),std::forward<T>(value));
+        }
+        else
+        {
+            ec = jsonpointer_errc::expected_object_or_array;
+        }
+    }
+
+    template<class Json,class T>
+    void add(Json& root,
+             const basic_compiled_json_pointer<typename Json::char_type>& location,
+             T&& value,
+             std::error_code& ec)
+    {
+        add(root, location, std::forward<T>(value), false, ec);
+    }
+
+    template<class Json,class T>
+    void add(Json& root,
+             const basic_compiled_json_pointer<typename Json::char_type>& location,
+             T&& value,
+             bool create_if_missing = false)
+    {
+        std::error_code ec;
+        add(root, location, std::forward<T>(value), create_if_missing, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(jsonpointer_error(ec));
+        }
+    }
+
+    template<class Json, class T>
+    void replace(Json& root,
+                 const basic_compiled_json_pointer<typename Json::char_type>& location,
+                 T&& value,
+                 bool create_if_missing,
+                 std::error_code& ec)
+    {
+        if (location.empty())
+        {
+            replace(root, location.to_json_pointer(), std::forward<T>(value), create_if_missing, ec);
+            return;
+        }
+        Json* current = jsoncons::jsonpointer::detail::resolve_parent(root, location, create_if_missing, ec);
+        if (ec)
+        {
+            return;
+        }
+        const std::size_t last = location.size() - 1;
+        if (current->is_array())
+        {
+            if (!location.is_index(last))
+            {
+                auto token = location.token(last);
+                ec = token.size() == 1 && token[0] == '-' ? jsonpointer_errc::index_exceeds_array_size : jsonpointer_errc::invalid_index;
+                return;
+            }
+            std::size_t index = location.index(last);
+            if (index >= current->size())
+            {
+                ec = jsonpointer_errc::index_exceeds_array_size;
+                return;
+            }
+            current->at(index) = std::forward<T>(value);
+        }
+        else if (current->is_object())
+        {
+            auto it = current->find(location.token(last));
+            if (it != current->object_range().end())
+            {
+                it->value() = std::forward<T>(value);
+            }
+            else if (create_if_missing)
+            {
+                current->try_emplace(location.token(last),std::forward<T>(value));
+            }
+            else
+            {
+                ec = jsonpointer_errc::key_not_found;
+            }
+        }
+        else
+        {
+            ec = jsonpointer_errc::expected_object_or_array;
+        }
+    }
+
+    template<class Json, class T>
+    void replace(Json& root,
+                 const basic_compiled_json_pointer<typename Json::char_type>& location,
+                 T&& value,
+                 std::error_code& ec)
+    {
+        replace(root, location, std::forward<T>(value), false, ec);
+    }
+
+    template<class Json, class T>
+    void replace(Json& root,
+                 const basic_compiled_json_pointer<typename Json::char_type>& location,
+                 T&& value,
+                 bool create_if_missing = false)
+    {
+        std::error_code ec;
+        replace(root, location, std::forward<T>(value), create_if_missing, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(jsonpointer_error(ec));
+        }
+    }
+
+    template<class Json>
+    void remove(Json& root, const basic_compiled_json_pointer<typename Json::char_type>& location, std::error_code& ec)
+    {
+        if (location.empty())
+        {
+            remove(root, location.to_json_pointer(), ec);
+            return;
+        }
+        Json* current = jsoncons::jsonpointer::detail::resolve_parent(root, location, false, ec);
+        if (ec)
+        {
+            return;
+        }
+        const std::size_t last = location.size() - 1;
+        if (current->is_array())
+        {
+            if (!location.is_index(last))
+            {
+                auto token = location.token(last);
+                ec = token.size() == 1 && token[0] == '-' ? jsonpointer_errc::index_exceeds_array_size : jsonpointer_errc::invalid_index;
+                return;
+            }
+            std::size_t index = location.index(last);
+            if (index >= current->size())
+            {
+                ec = jsonpointer_errc::index_exceeds_array_size;
+                return;
+            }
+            current->erase(current->array_range().begin()+index);
+        }
+        else if (current->is_object())
+        {
+            auto it = current->find(location.token(last));
+            if (it == current->object_range().end())
+            {
+                ec = jsonpointer_errc::key_not_found;
+                return;
+            }
+            current->erase(it);
+        }
+        else
+        {
+            ec = jsonpointer_errc::expected_object_or_array;
+        }
+    }
+
+    template<class Json>
+    void remove(Json& root, const basic_compiled_json_pointer<typename Json::char_type>& location)
+    {
+        std::error_code ec;
+        remove(root, location, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(jsonpointer_error(ec));
+        }
+    }
+
     template <class String,class Result>
     typename std::enable_if<std::is_convertible<typename String::value_type,typename Result::value_type>::value>::type
     escape(const String& s, Result& result)
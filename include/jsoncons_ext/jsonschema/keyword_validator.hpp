@@ -234,7 +234,7 @@ namespace jsonschema {
                 if (*content_encoding_ == "base64")
                 {
                     auto s = instance.template as<jsoncons::string_view>();
-                    auto retval = jsoncons::decode_base64(s.begin(), s.end(), content);
+                    auto retval = jsoncons::decode_base64(s.data(), s.data() + s.size(), content);
                     if (retval.ec != jsoncons::conv_errc::success)
                     {
                         reporter.error(validation_output("contentEncoding", 
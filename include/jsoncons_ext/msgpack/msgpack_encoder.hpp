@@ -12,6 +12,8 @@
 #include <limits> // std::numeric_limits
 #include <memory>
 #include <utility> // std::move
+#include <cstring> // std::memcpy
+#include <iterator> // std::back_inserter
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_visitor.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
@@ -26,6 +28,13 @@ namespace msgpack {
 
     enum class msgpack_container_type {object, array};
 
+    // Maps and arrays begun without a length are buffered until they end, since
+    // a msgpack header holds the item count. With a seekable sink the buffer is
+    // bounded: once it is large, the open containers get map 32 or array 32
+    // headers, the buffer goes to the sink, and the counts are patched in place.
+    // binary_stream_sink is not seekable, so msgpack_stream_encoder holds a
+    // top-level container of unknown length in memory until it ends.
+
     template<class Sink=jsoncons::binary_stream_sink,class Allocator=std::allocator<char>>
     class basic_msgpack_encoder final : public basic_json_visitor<char>
     {
@@ -41,17 +50,30 @@ namespace msgpack {
         using sink_type = Sink;
 
     private:
+        static constexpr std::size_t unknown_length = (std::numeric_limits<std::size_t>::max)();
+        static constexpr std::size_t max_header_length = 5;
+        static constexpr std::size_t flush_threshold = 16384;
+
         struct stack_item
         {
             msgpack_container_type type_;
             std::size_t length_;
             std::size_t count_;
+            // For containers of unknown length, the offset of the reserved
+            // header in the buffer, or in the sink after the header is committed
+            std::size_t header_offset_;
+            bool committed_;
 
             stack_item(msgpack_container_type type, std::size_t length = 0) noexcept
-               : type_(type), length_(length), count_(0)
+               : type_(type), length_(length), count_(0), header_offset_(0), committed_(false)
             {
             }
 
+            bool is_indefinite_length() const
+            {
+                return length_ == unknown_length;
+            }
+
             std::size_t length() const
             {
                 return length_;
@@ -68,12 +90,54 @@ namespace msgpack {
             }
         };
 
+        // Receives the encoded bytes. While a container of unknown length is open, 
+        // its contents are held in buffer_ until the number of items is known.
+        class output
+        {
+            basic_msgpack_encoder* encoder_;
+        public:
+            using value_type = uint8_t;
+
+            output(basic_msgpack_encoder* encoder)
+                : encoder_(encoder)
+            {
+            }
+
+            void push_back(uint8_t b)
+            {
+                if (encoder_->buffered_count_ > 0)
+                {
+                    encoder_->buffer_.push_back(b);
+                }
+                else
+                {
+                    encoder_->sink_.push_back(b);
+                }
+            }
+
+            void append(const uint8_t* s, std::size_t length)
+            {
+                if (encoder_->buffered_count_ > 0)
+                {
+                    encoder_->buffer_.insert(encoder_->buffer_.end(), s, s+length);
+                }
+                else
+                {
+                    encoder_->append_to_sink(s, length);
+                }
+            }
+        };
+
         Sink sink_;
         const msgpack_encode_options options_;
         allocator_type alloc_;
 
         std::vector<stack_item> stack_;
         int nesting_depth_;
+        std::vector<uint8_t> buffer_;
+        // The number of open containers of unknown length with headers in buffer_
+        std::size_t buffered_count_;
+        output out_;
 
         // Noncopyable and nonmoveable
         basic_msgpack_encoder(const basic_msgpack_encoder&) = delete;
@@ -91,7 +155,9 @@ namespace msgpack {
            : sink_(std::forward<Sink>(sink)),
              options_(options),
              alloc_(alloc),
-             nesting_depth_(0)
+             nesting_depth_(0),
+             buffered_count_(0),
+             out_(this)
         {
         }
 
@@ -104,6 +170,8 @@ namespace msgpack {
         {
             stack_.clear();
             nesting_depth_ = 0;
+            buffer_.clear();
+            buffered_count_ = 0;
         }
 
         void reset(Sink&& sink)
@@ -122,8 +190,13 @@ namespace msgpack {
 
         bool visit_begin_object(semantic_tag, const ser_context&, std::error_code& ec) override
         {
-            ec = msgpack_errc::object_length_required;
-            return false;
+            if (JSONCONS_UNLIKELY(++nesting_depth_ > options_.max_nesting_depth()))
+            {
+                ec = msgpack_errc::max_nesting_depth_exceeded;
+                return false;
+            } 
+            begin_indefinite_length(msgpack_container_type::object);
+            return true;
         }
 
         bool visit_begin_object(std::size_t length, semantic_tag, const ser_context&, std::error_code& ec) override
@@ -138,21 +211,21 @@ namespace msgpack {
             if (length <= 15)
             {
                 // fixmap
-                sink_.push_back(jsoncons::msgpack::msgpack_type::fixmap_base_type | (length & 0xf));
+                out_.push_back(jsoncons::msgpack::msgpack_type::fixmap_base_type | (length & 0xf));
             }
             else if (length <= 65535)
             {
                 // map 16
-                sink_.push_back(jsoncons::msgpack::msgpack_type::map16_type);
+                out_.push_back(jsoncons::msgpack::msgpack_type::map16_type);
                 binary::native_to_big(static_cast<uint16_t>(length), 
-                                      std::back_inserter(sink_));
+                                      std::back_inserter(out_));
             }
             else if (length <= 4294967295)
             {
                 // map 32
-                sink_.push_back(jsoncons::msgpack::msgpack_type::map32_type);
+                out_.push_back(jsoncons::msgpack::msgpack_type::map32_type);
                 binary::native_to_big(static_cast<uint32_t>(length),
-                                      std::back_inserter(sink_));
+                                      std::back_inserter(out_));
             }
 
             return true;
@@ -163,7 +236,14 @@ namespace msgpack {
             JSONCONS_ASSERT(!stack_.empty());
             --nesting_depth_;
 
-            if (stack_.back().count() < stack_.back().length())
+            if (stack_.back().is_indefinite_length())
+            {
+                if (!end_indefinite_length(ec))
+                {
+                    return false;
+                }
+            }
+            else if (stack_.back().count() < stack_.back().length())
             {
                 ec = msgpack_errc::too_few_items;
                 return false;
@@ -181,8 +261,13 @@ namespace msgpack {
 
         bool visit_begin_array(semantic_tag, const ser_context&, std::error_code& ec) override
         {
-            ec = msgpack_errc::array_length_required;
-            return false;
+            if (JSONCONS_UNLIKELY(++nesting_depth_ > options_.max_nesting_depth()))
+            {
+                ec = msgpack_errc::max_nesting_depth_exceeded;
+                return false;
+            } 
+            begin_indefinite_length(msgpack_container_type::array);
+            return true;
         }
 
         bool visit_begin_array(std::size_t length, semantic_tag, const ser_context&, std::error_code& ec) override
@@ -196,19 +281,19 @@ namespace msgpack {
             if (length <= 15)
             {
                 // fixarray
-                sink_.push_back(jsoncons::msgpack::msgpack_type::fixarray_base_type | (length & 0xf));
+                out_.push_back(jsoncons::msgpack::msgpack_type::fixarray_base_type | (length & 0xf));
             }
             else if (length <= (std::numeric_limits<uint16_t>::max)())
             {
                 // array 16
-                sink_.push_back(jsoncons::msgpack::msgpack_type::array16_type);
-                binary::native_to_big(static_cast<uint16_t>(length),std::back_inserter(sink_));
+                out_.push_back(jsoncons::msgpack::msgpack_type::array16_type);
+                binary::native_to_big(static_cast<uint16_t>(length),std::back_inserter(out_));
             }
             else if (length <= (std::numeric_limits<uint32_t>::max)())
             {
                 // array 32
-                sink_.push_back(jsoncons::msgpack::msgpack_type::array32_type);
-                binary::native_to_big(static_cast<uint32_t>(length),std::back_inserter(sink_));
+                out_.push_back(jsoncons::msgpack::msgpack_type::array32_type);
+                binary::native_to_big(static_cast<uint32_t>(length),std::back_inserter(out_));
             }
             return true;
         }
@@ -219,7 +304,14 @@ namespace msgpack {
 
             --nesting_depth_;
 
-            if (stack_.back().count() < stack_.back().length())
+            if (stack_.back().is_indefinite_length())
+            {
+                if (!end_indefinite_length(ec))
+                {
+                    return false;
+                }
+            }
+            else if (stack_.back().count() < stack_.back().length())
             {
                 ec = msgpack_errc::too_few_items;
                 return false;
@@ -244,7 +336,7 @@ namespace msgpack {
         bool visit_null(semantic_tag, const ser_context&, std::error_code&) override
         {
             // nil
-            sink_.push_back(jsoncons::msgpack::msgpack_type::nil_type);
+            out_.push_back(jsoncons::msgpack::msgpack_type::nil_type);
             end_value();
             return true;
         }
@@ -257,26 +349,26 @@ namespace msgpack {
                 if ((data64 & 0xffffffff00000000L) == 0) 
                 {
                     // timestamp 32
-                    sink_.push_back(jsoncons::msgpack::msgpack_type::fixext4_type);
-                    sink_.push_back(0xff);
-                    binary::native_to_big(static_cast<uint32_t>(data64), std::back_inserter(sink_));
+                    out_.push_back(jsoncons::msgpack::msgpack_type::fixext4_type);
+                    out_.push_back(0xff);
+                    binary::native_to_big(static_cast<uint32_t>(data64), std::back_inserter(out_));
                 }
                 else 
                 {
                     // timestamp 64
-                    sink_.push_back(jsoncons::msgpack::msgpack_type::fixext8_type);
-                    sink_.push_back(0xff);
-                    binary::native_to_big(static_cast<uint64_t>(data64), std::back_inserter(sink_));
+                    out_.push_back(jsoncons::msgpack::msgpack_type::fixext8_type);
+                    out_.push_back(0xff);
+                    binary::native_to_big(static_cast<uint64_t>(data64), std::back_inserter(out_));
                 }
             }
             else 
             {
                 // timestamp 96
-                sink_.push_back(jsoncons::msgpack::msgpack_type::ext8_type);
-                sink_.push_back(0x0c); // 12
-                sink_.push_back(0xff);
-                binary::native_to_big(static_cast<uint32_t>(nanoseconds), std::back_inserter(sink_));
-                binary::native_to_big(static_cast<uint64_t>(seconds), std::back_inserter(sink_));
+                out_.push_back(jsoncons::msgpack::msgpack_type::ext8_type);
+                out_.push_back(0x0c); // 12
+                out_.push_back(0xff);
+                binary::native_to_big(static_cast<uint32_t>(nanoseconds), std::back_inserter(out_));
+                binary::native_to_big(static_cast<uint64_t>(seconds), std::back_inserter(out_));
             }
         }
 
@@ -362,31 +454,28 @@ namespace msgpack {
             if (length <= 31)
             {
                 // fixstr stores a byte array whose length is upto 31 bytes
-                sink_.push_back(jsoncons::msgpack::msgpack_type::fixstr_base_type | static_cast<uint8_t>(length));
+                out_.push_back(jsoncons::msgpack::msgpack_type::fixstr_base_type | static_cast<uint8_t>(length));
             }
             else if (length <= (std::numeric_limits<uint8_t>::max)())
             {
                 // str 8 stores a byte array whose length is upto (2^8)-1 bytes
-                sink_.push_back(jsoncons::msgpack::msgpack_type::str8_type);
-                sink_.push_back(static_cast<uint8_t>(length));
+                out_.push_back(jsoncons::msgpack::msgpack_type::str8_type);
+                out_.push_back(static_cast<uint8_t>(length));
             }
             else if (length <= (std::numeric_limits<uint16_t>::max)())
             {
                 // str 16 stores a byte array whose length is upto (2^16)-1 bytes
-                sink_.push_back(jsoncons::msgpack::msgpack_type::str16_type);
-                binary::native_to_big(static_cast<uint16_t>(length), std::back_inserter(sink_));
+                out_.push_back(jsoncons::msgpack::msgpack_type::str16_type);
+                binary::native_to_big(static_cast<uint16_t>(length), std::back_inserter(out_));
             }
             else if (length <= (std::numeric_limits<uint32_t>::max)())
             {
                 // str 32 stores a byte array whose length is upto (2^32)-1 bytes
-                sink_.push_back(jsoncons::msgpack::msgpack_type::str32_type);
-                binary::native_to_big(static_cast<uint32_t>(length),std::back_inserter(sink_));
+                out_.push_back(jsoncons::msgpack::msgpack_type::str32_type);
+                binary::native_to_big(static_cast<uint32_t>(length),std::back_inserter(out_));
             }
 
-            for (auto c : sv)
-            {
-                sink_.push_back(c);
-            }
+            out_.append(reinterpret_cast<const uint8_t*>(sv.data()), sv.size());
         }
 
         bool visit_byte_string(const byte_string_view& b, 
@@ -399,26 +488,23 @@ namespace msgpack {
             if (length <= (std::numeric_limits<uint8_t>::max)())
             {
                 // bin 8 stores a byte array whose length is upto (2^8)-1 bytes
-                sink_.push_back(jsoncons::msgpack::msgpack_type::bin8_type);
-                sink_.push_back(static_cast<uint8_t>(length));
+                out_.push_back(jsoncons::msgpack::msgpack_type::bin8_type);
+                out_.push_back(static_cast<uint8_t>(length));
             }
             else if (length <= (std::numeric_limits<uint16_t>::max)())
             {
                 // bin 16 stores a byte array whose length is upto (2^16)-1 bytes
-                sink_.push_back(jsoncons::msgpack::msgpack_type::bin16_type);
-                binary::native_to_big(static_cast<uint16_t>(length), std::back_inserter(sink_));
+                out_.push_back(jsoncons::msgpack::msgpack_type::bin16_type);
+                binary::native_to_big(static_cast<uint16_t>(length), std::back_inserter(out_));
             }
             else if (length <= (std::numeric_limits<uint32_t>::max)())
             {
                 // bin 32 stores a byte array whose length is upto (2^32)-1 bytes
-                sink_.push_back(jsoncons::msgpack::msgpack_type::bin32_type);
-                binary::native_to_big(static_cast<uint32_t>(length),std::back_inserter(sink_));
+                out_.push_back(jsoncons::msgpack::msgpack_type::bin32_type);
+                binary::native_to_big(static_cast<uint32_t>(length),std::back_inserter(out_));
             }
 
-            for (auto c : b)
-            {
-                sink_.push_back(c);
-            }
+            out_.append(b.data(), b.size());
 
             end_value();
             return true;
@@ -433,51 +519,48 @@ namespace msgpack {
             switch (length)
             {
                 case 1:
-                    sink_.push_back(jsoncons::msgpack::msgpack_type::fixext1_type);
-                    sink_.push_back(static_cast<uint8_t>(ext_tag));
+                    out_.push_back(jsoncons::msgpack::msgpack_type::fixext1_type);
+                    out_.push_back(static_cast<uint8_t>(ext_tag));
                     break;
                 case 2:
-                    sink_.push_back(jsoncons::msgpack::msgpack_type::fixext2_type);
-                    sink_.push_back(static_cast<uint8_t>(ext_tag));
+                    out_.push_back(jsoncons::msgpack::msgpack_type::fixext2_type);
+                    out_.push_back(static_cast<uint8_t>(ext_tag));
                     break;
                 case 4:
-                    sink_.push_back(jsoncons::msgpack::msgpack_type::fixext4_type);
-                    sink_.push_back(static_cast<uint8_t>(ext_tag));
+                    out_.push_back(jsoncons::msgpack::msgpack_type::fixext4_type);
+                    out_.push_back(static_cast<uint8_t>(ext_tag));
                     break;
                 case 8:
-                    sink_.push_back(jsoncons::msgpack::msgpack_type::fixext8_type);
-                    sink_.push_back(static_cast<uint8_t>(ext_tag));
+                    out_.push_back(jsoncons::msgpack::msgpack_type::fixext8_type);
+                    out_.push_back(static_cast<uint8_t>(ext_tag));
                     break;
                 case 16:
-                    sink_.push_back(jsoncons::msgpack::msgpack_type::fixext16_type);
-                    sink_.push_back(static_cast<uint8_t>(ext_tag));
+                    out_.push_back(jsoncons::msgpack::msgpack_type::fixext16_type);
+                    out_.push_back(static_cast<uint8_t>(ext_tag));
                     break;
                 default:
                     if (length <= (std::numeric_limits<uint8_t>::max)())
                     {
-                        sink_.push_back(jsoncons::msgpack::msgpack_type::ext8_type);
-                        sink_.push_back(static_cast<uint8_t>(length));
-                        sink_.push_back(static_cast<uint8_t>(ext_tag));
+                        out_.push_back(jsoncons::msgpack::msgpack_type::ext8_type);
+                        out_.push_back(static_cast<uint8_t>(length));
+                        out_.push_back(static_cast<uint8_t>(ext_tag));
                     }
                     else if (length <= (std::numeric_limits<uint16_t>::max)())
                     {
-                        sink_.push_back(jsoncons::msgpack::msgpack_type::ext16_type);
-                        binary::native_to_big(static_cast<uint16_t>(length), std::back_inserter(sink_));
-                        sink_.push_back(static_cast<uint8_t>(ext_tag));
+                        out_.push_back(jsoncons::msgpack::msgpack_type::ext16_type);
+                        binary::native_to_big(static_cast<uint16_t>(length), std::back_inserter(out_));
+                        out_.push_back(static_cast<uint8_t>(ext_tag));
                     }
                     else if (length <= (std::numeric_limits<uint32_t>::max)())
                     {
-                        sink_.push_back(jsoncons::msgpack::msgpack_type::ext32_type);
-                        binary::native_to_big(static_cast<uint32_t>(length),std::back_inserter(sink_));
-                        sink_.push_back(static_cast<uint8_t>(ext_tag));
+                        out_.push_back(jsoncons::msgpack::msgpack_type::ext32_type);
+                        binary::native_to_big(static_cast<uint32_t>(length),std::back_inserter(out_));
+                        out_.push_back(static_cast<uint8_t>(ext_tag));
                     }
                     break;
             }
 
-            for (auto c : b)
-            {
-                sink_.push_back(c);
-            }
+            out_.append(b.data(), b.size());
 
             end_value();
             return true;
@@ -492,14 +575,14 @@ namespace msgpack {
             if ((double)valf == val)
             {
                 // float 32
-                sink_.push_back(jsoncons::msgpack::msgpack_type::float32_type);
-                binary::native_to_big(valf,std::back_inserter(sink_));
+                out_.push_back(jsoncons::msgpack::msgpack_type::float32_type);
+                binary::native_to_big(valf,std::back_inserter(out_));
             }
             else
             {
                 // float 64
-                sink_.push_back(jsoncons::msgpack::msgpack_type::float64_type);
-                binary::native_to_big(val,std::back_inserter(sink_));
+                out_.push_back(jsoncons::msgpack::msgpack_type::float64_type);
+                binary::native_to_big(val,std::back_inserter(out_));
             }
 
             // write double
@@ -563,31 +646,31 @@ namespace msgpack {
                         if (val <= 0x7f)
                         {
                             // positive fixnum stores 7-bit positive integer
-                            sink_.push_back(static_cast<uint8_t>(val));
+                            out_.push_back(static_cast<uint8_t>(val));
                         }
                         else if (val <= (std::numeric_limits<uint8_t>::max)())
                         {
                             // uint 8 stores a 8-bit unsigned integer
-                            sink_.push_back(jsoncons::msgpack::msgpack_type::uint8_type);
-                            sink_.push_back(static_cast<uint8_t>(val));
+                            out_.push_back(jsoncons::msgpack::msgpack_type::uint8_type);
+                            out_.push_back(static_cast<uint8_t>(val));
                         }
                         else if (val <= (std::numeric_limits<uint16_t>::max)())
                         {
                             // uint 16 stores a 16-bit big-endian unsigned integer
-                            sink_.push_back(jsoncons::msgpack::msgpack_type::uint16_type);
-                            binary::native_to_big(static_cast<uint16_t>(val),std::back_inserter(sink_));
+                            out_.push_back(jsoncons::msgpack::msgpack_type::uint16_type);
+                            binary::native_to_big(static_cast<uint16_t>(val),std::back_inserter(out_));
                         }
                         else if (val <= (std::numeric_limits<uint32_t>::max)())
                         {
                             // uint 32 stores a 32-bit big-endian unsigned integer
-                            sink_.push_back(jsoncons::msgpack::msgpack_type::uint32_type);
-                            binary::native_to_big(static_cast<uint32_t>(val),std::back_inserter(sink_));
+                            out_.push_back(jsoncons::msgpack::msgpack_type::uint32_type);
+                            binary::native_to_big(static_cast<uint32_t>(val),std::back_inserter(out_));
                         }
                         else if (val <= (std::numeric_limits<int64_t>::max)())
                         {
                             // int 64 stores a 64-bit big-endian signed integer
-                            sink_.push_back(jsoncons::msgpack::msgpack_type::uint64_type);
-                            binary::native_to_big(static_cast<uint64_t>(val),std::back_inserter(sink_));
+                            out_.push_back(jsoncons::msgpack::msgpack_type::uint64_type);
+                            binary::native_to_big(static_cast<uint64_t>(val),std::back_inserter(out_));
                         }
                     }
                     else
@@ -595,31 +678,31 @@ namespace msgpack {
                         if (val >= -32)
                         {
                             // negative fixnum stores 5-bit negative integer
-                            binary::native_to_big(static_cast<int8_t>(val), std::back_inserter(sink_));
+                            binary::native_to_big(static_cast<int8_t>(val), std::back_inserter(out_));
                         }
                         else if (val >= (std::numeric_limits<int8_t>::lowest)())
                         {
                             // int 8 stores a 8-bit signed integer
-                            sink_.push_back(jsoncons::msgpack::msgpack_type::int8_type);
-                            binary::native_to_big(static_cast<int8_t>(val),std::back_inserter(sink_));
+                            out_.push_back(jsoncons::msgpack::msgpack_type::int8_type);
+                            binary::native_to_big(static_cast<int8_t>(val),std::back_inserter(out_));
                         }
                         else if (val >= (std::numeric_limits<int16_t>::lowest)())
                         {
                             // int 16 stores a 16-bit big-endian signed integer
-                            sink_.push_back(jsoncons::msgpack::msgpack_type::int16_type);
-                            binary::native_to_big(static_cast<int16_t>(val),std::back_inserter(sink_));
+                            out_.push_back(jsoncons::msgpack::msgpack_type::int16_type);
+                            binary::native_to_big(static_cast<int16_t>(val),std::back_inserter(out_));
                         }
                         else if (val >= (std::numeric_limits<int32_t>::lowest)())
                         {
                             // int 32 stores a 32-bit big-endian signed integer
-                            sink_.push_back(jsoncons::msgpack::msgpack_type::int32_type);
-                            binary::native_to_big(static_cast<int32_t>(val),std::back_inserter(sink_));
+                            out_.push_back(jsoncons::msgpack::msgpack_type::int32_type);
+                            binary::native_to_big(static_cast<int32_t>(val),std::back_inserter(out_));
                         }
                         else if (val >= (std::numeric_limits<int64_t>::lowest)())
                         {
                             // int 64 stores a 64-bit big-endian signed integer
-                            sink_.push_back(jsoncons::msgpack::msgpack_type::int64_type);
-                            binary::native_to_big(static_cast<int64_t>(val),std::back_inserter(sink_));
+                            out_.push_back(jsoncons::msgpack::msgpack_type::int64_type);
+                            binary::native_to_big(static_cast<int64_t>(val),std::back_inserter(out_));
                         }
                     }
                 }
@@ -682,31 +765,31 @@ namespace msgpack {
                     if (val <= static_cast<uint64_t>((std::numeric_limits<int8_t>::max)()))
                     {
                         // positive fixnum stores 7-bit positive integer
-                        sink_.push_back(static_cast<uint8_t>(val));
+                        out_.push_back(static_cast<uint8_t>(val));
                     }
                     else if (val <= (std::numeric_limits<uint8_t>::max)())
                     {
                         // uint 8 stores a 8-bit unsigned integer
-                        sink_.push_back(jsoncons::msgpack::msgpack_type::uint8_type);
-                        sink_.push_back(static_cast<uint8_t>(val));
+                        out_.push_back(jsoncons::msgpack::msgpack_type::uint8_type);
+                        out_.push_back(static_cast<uint8_t>(val));
                     }
                     else if (val <= (std::numeric_limits<uint16_t>::max)())
                     {
                         // uint 16 stores a 16-bit big-endian unsigned integer
-                        sink_.push_back(jsoncons::msgpack::msgpack_type::uint16_type);
-                        binary::native_to_big(static_cast<uint16_t>(val),std::back_inserter(sink_));
+                        out_.push_back(jsoncons::msgpack::msgpack_type::uint16_type);
+                        binary::native_to_big(static_cast<uint16_t>(val),std::back_inserter(out_));
                     }
                     else if (val <= (std::numeric_limits<uint32_t>::max)())
                     {
                         // uint 32 stores a 32-bit big-endian unsigned integer
-                        sink_.push_back(jsoncons::msgpack::msgpack_type::uint32_type);
-                        binary::native_to_big(static_cast<uint32_t>(val),std::back_inserter(sink_));
+                        out_.push_back(jsoncons::msgpack::msgpack_type::uint32_type);
+                        binary::native_to_big(static_cast<uint32_t>(val),std::back_inserter(out_));
                     }
                     else if (val <= (std::numeric_limits<uint64_t>::max)())
                     {
                         // uint 64 stores a 64-bit big-endian unsigned integer
-                        sink_.push_back(jsoncons::msgpack::msgpack_type::uint64_type);
-                        binary::native_to_big(static_cast<uint64_t>(val),std::back_inserter(sink_));
+                        out_.push_back(jsoncons::msgpack::msgpack_type::uint64_type);
+                        binary::native_to_big(static_cast<uint64_t>(val),std::back_inserter(out_));
                     }
                     break;
                 }
@@ -718,7 +801,7 @@ namespace msgpack {
         bool visit_bool(bool val, semantic_tag, const ser_context&, std::error_code&) override
         {
             // true and false
-            sink_.push_back(static_cast<uint8_t>(val ? jsoncons::msgpack::msgpack_type::true_type : jsoncons::msgpack::msgpack_type::false_type));
+            out_.push_back(static_cast<uint8_t>(val ? jsoncons::msgpack::msgpack_type::true_type : jsoncons::msgpack::msgpack_type::false_type));
 
             end_value();
             return true;
@@ -730,9 +813,138 @@ namespace msgpack {
             {
                 ++stack_.back().count_;
             }
+            if (buffered_count_ > 0 && buffer_.size() >= flush_threshold)
+            {
+                commit(std::integral_constant<bool,is_seekable_sink<Sink>::value>());
+            }
+        }
+
+        // Reserves space for the largest header, map 32 or array 32
+        void begin_indefinite_length(msgpack_container_type type)
+        {
+            stack_.emplace_back(type, unknown_length);
+            ++buffered_count_;
+            stack_.back().header_offset_ = buffer_.size();
+            buffer_.insert(buffer_.end(), max_header_length, 0);
+        }
+
+        bool end_indefinite_length(std::error_code& ec)
+        {
+            stack_item& item = stack_.back();
+            const bool is_object = item.is_object();
+            const std::size_t count = item.count();
+            // map 32 and array 32 hold at most (2^32)-1 items
+            if (count > (std::numeric_limits<uint32_t>::max)())
+            {
+                ec = msgpack_errc::too_many_items;
+                return false;
+            }
+            if (item.committed_)
+            {
+                uint8_t buf[max_header_length-1];
+                binary::native_to_big(static_cast<uint32_t>(count), buf);
+                patch_sink(item.header_offset_ + 1, buf, sizeof(buf), 
+                           std::integral_constant<bool,is_seekable_sink<Sink>::value>());
+                return true;
+            }
+
+            // Write the smallest header that fits the count at the end of the
+            // reserved space, and remove the unused bytes before it
+            uint8_t header[max_header_length];
+            std::size_t header_length;
+            if (count <= 15)
+            {
+                header[0] = static_cast<uint8_t>((is_object ? jsoncons::msgpack::msgpack_type::fixmap_base_type : jsoncons::msgpack::msgpack_type::fixarray_base_type) | (count & 0xf));
+                header_length = 1;
+            }
+            else if (count <= (std::numeric_limits<uint16_t>::max)())
+            {
+                header[0] = is_object ? jsoncons::msgpack::msgpack_type::map16_type : jsoncons::msgpack::msgpack_type::array16_type;
+                binary::native_to_big(static_cast<uint16_t>(count), header+1);
+                header_length = 3;
+            }
+            else
+            {
+                header[0] = is_object ? jsoncons::msgpack::msgpack_type::map32_type : jsoncons::msgpack::msgpack_type::array32_type;
+                binary::native_to_big(static_cast<uint32_t>(count), header+1);
+                header_length = 5;
+            }
+            const std::size_t unused = max_header_length - header_length;
+            std::memcpy(buffer_.data() + item.header_offset_ + unused, header, header_length);
+            if (unused > 0)
+            {
+                buffer_.erase(buffer_.begin() + item.header_offset_, buffer_.begin() + item.header_offset_ + unused);
+            }
+
+            --buffered_count_;
+            if (buffered_count_ == 0)
+            {
+                append_to_sink(buffer_.data(), buffer_.size());
+                buffer_.clear();
+            }
+            return true;
+        }
+
+        // For seekable sinks, bounds the buffer by writing the largest headers
+        // for the open containers of unknown length, passing the buffer to the
+        // sink, and patching the counts when the containers end
+        void commit(std::true_type)
+        {
+            const std::size_t sink_offset = sink_.position();
+            for (auto& item : stack_)
+            {
+                if (item.is_indefinite_length() && !item.committed_)
+                {
+                    buffer_[item.header_offset_] = item.is_object() ? jsoncons::msgpack::msgpack_type::map32_type : jsoncons::msgpack::msgpack_type::array32_type;
+                    item.header_offset_ += sink_offset;
+                    item.committed_ = true;
+                }
+            }
+            append_to_sink(buffer_.data(), buffer_.size());
+            buffer_.clear();
+            buffered_count_ = 0;
+        }
+
+        void commit(std::false_type)
+        {
+        }
+
+        void patch_sink(std::size_t offset, const uint8_t* s, std::size_t length, std::true_type)
+        {
+            sink_.patch(offset, s, length);
+        }
+
+        void patch_sink(std::size_t, const uint8_t*, std::size_t, std::false_type)
+        {
+            JSONCONS_UNREACHABLE();
+        }
+
+        void append_to_sink(const uint8_t* s, std::size_t length)
+        {
+            append_to_sink(s, length, std::integral_constant<bool,is_appendable_sink<Sink>::value>());
+        }
+
+        void append_to_sink(const uint8_t* s, std::size_t length, std::true_type)
+        {
+            sink_.append(s, length);
+        }
+
+        void append_to_sink(const uint8_t* s, std::size_t length, std::false_type)
+        {
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                sink_.push_back(s[i]);
+            }
         }
     };
 
+    template<class Sink,class Allocator>
+    constexpr std::size_t basic_msgpack_encoder<Sink,Allocator>::unknown_length;
+    template<class Sink,class Allocator>
+    constexpr std::size_t basic_msgpack_encoder<Sink,Allocator>::max_header_length;
+    template<class Sink,class Allocator>
+    constexpr std::size_t basic_msgpack_encoder<Sink,Allocator>::flush_threshold;
+
     using msgpack_stream_encoder = basic_msgpack_encoder<jsoncons::binary_stream_sink>;
     using msgpack_bytes_encoder = basic_msgpack_encoder<jsoncons::bytes_sink<std::vector<uint8_t>>>;
 
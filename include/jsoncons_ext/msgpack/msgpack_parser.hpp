@@ -195,8 +195,147 @@ public:
             }
         }
     }
+
+    // Whether the items of the array or map just begun can be skipped with skip_container
+    bool can_skip_container() const
+    {
+        return state_stack_.back().mode == parse_mode::array || state_stack_.back().mode == parse_mode::map_key;
+    }
+
+    // Skips the items of the array or map just begun, reading only the types
+    // and lengths of the nested items, and leaves the end of the container to parse
+    void skip_container(std::error_code& ec)
+    {
+        more_ = true;
+        parse_state& state = state_stack_.back();
+        // The number of items left, including the items of nested containers
+        std::size_t count = state.mode == parse_mode::map_key ? 2*(state.length - state.index) : state.length - state.index;
+        state.index = state.length;
+
+        while (count > 0)
+        {
+            --count;
+            uint8_t type;
+            if (source_.read(&type, 1) == 0)
+            {
+                ec = msgpack_errc::unexpected_eof;
+                more_ = false;
+                return;
+            }
+            if (type <= 0xbf)
+            {
+                if (type <= 0x7f)
+                {
+                    // positive fixint
+                }
+                else if (type <= 0x8f)
+                {
+                    count += 2*(type & 0x0f); // fixmap
+                }
+                else if (type <= 0x9f)
+                {
+                    count += type & 0x0f; // fixarray
+                }
+                else
+                {
+                    skip_bytes(type & 0x1f, ec); // fixstr
+                }
+            }
+            else if (type >= 0xe0)
+            {
+                // negative fixint
+            }
+            else
+            {
+                switch (type)
+                {
+                    case jsoncons::msgpack::msgpack_type::nil_type:
+                    case jsoncons::msgpack::msgpack_type::true_type:
+                    case jsoncons::msgpack::msgpack_type::false_type:
+                        break;
+                    case jsoncons::msgpack::msgpack_type::uint8_type:
+                    case jsoncons::msgpack::msgpack_type::int8_type:
+                        skip_bytes(1, ec);
+                        break;
+                    case jsoncons::msgpack::msgpack_type::uint16_type:
+                    case jsoncons::msgpack::msgpack_type::int16_type:
+                        skip_bytes(2, ec);
+                        break;
+                    case jsoncons::msgpack::msgpack_type::uint32_type:
+                    case jsoncons::msgpack::msgpack_type::int32_type:
+                    case jsoncons::msgpack::msgpack_type::float32_type:
+                        skip_bytes(4, ec);
+                        break;
+                    case jsoncons::msgpack::msgpack_type::uint64_type:
+                    case jsoncons::msgpack::msgpack_type::int64_type:
+                    case jsoncons::msgpack::msgpack_type::float64_type:
+                        skip_bytes(8, ec);
+                        break;
+                    case jsoncons::msgpack::msgpack_type::str8_type:
+                    case jsoncons::msgpack::msgpack_type::str16_type:
+                    case jsoncons::msgpack::msgpack_type::str32_type:
+                    case jsoncons::msgpack::msgpack_type::bin8_type:
+                    case jsoncons::msgpack::msgpack_type::bin16_type:
+                    case jsoncons::msgpack::msgpack_type::bin32_type:
+                    {
+                        std::size_t len = get_size(type, ec);
+                        if (!more_)
+                        {
+                            return;
+                        }
+                        skip_bytes(len, ec);
+                        break;
+                    }
+                    case jsoncons::msgpack::msgpack_type::fixext1_type:
+                    case jsoncons::msgpack::msgpack_type::fixext2_type:
+                    case jsoncons::msgpack::msgpack_type::fixext4_type:
+                    case jsoncons::msgpack::msgpack_type::fixext8_type:
+                    case jsoncons::msgpack::msgpack_type::fixext16_type:
+                    case jsoncons::msgpack::msgpack_type::ext8_type:
+                    case jsoncons::msgpack::msgpack_type::ext16_type:
+                    case jsoncons::msgpack::msgpack_type::ext32_type:
+                    {
+                        std::size_t len = get_size(type, ec);
+                        if (!more_)
+                        {
+                            return;
+                        }
+                        skip_bytes(len + 1, ec); // the ext type and data
+                        break;
+                    }
+                    case jsoncons::msgpack::msgpack_type::array16_type:
+                    case jsoncons::msgpack::msgpack_type::array32_type:
+                        count += get_size(type, ec);
+                        break;
+                    case jsoncons::msgpack::msgpack_type::map16_type :
+                    case jsoncons::msgpack::msgpack_type::map32_type :
+                        count += 2*get_size(type, ec);
+                        break;
+                    default:
+                        ec = msgpack_errc::unknown_type;
+                        more_ = false;
+                        return;
+                }
+            }
+            if (!more_)
+            {
+                return;
+            }
+        }
+    }
 private:
 
+    void skip_bytes(std::size_t length, std::error_code& ec)
+    {
+        std::size_t position = source_.position();
+        source_.ignore(length);
+        if (source_.position() - position < length)
+        {
+            ec = msgpack_errc::unexpected_eof;
+            more_ = false;
+        }
+    }
+
     void read_item(json_visitor2& visitor, std::error_code& ec)
     {
         if (source_.is_error())
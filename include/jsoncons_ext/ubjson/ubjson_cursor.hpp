@@ -165,7 +165,7 @@ public:
     void read_to(basic_json_visitor<char_type>& visitor,
                 std::error_code& ec) override
     {
-        if (send_json_event(cursor_visitor_.event(), visitor, *this, ec))
+        if (cursor_visitor_.dump(visitor, *this, ec))
         {
             read_next(visitor, ec);
         }
@@ -278,11 +278,18 @@ private:
 
     void read_next(std::error_code& ec)
     {
-        parser_.restart();
-        while (!parser_.stopped())
+        if (cursor_visitor_.in_available())
         {
-            parser_.parse(cursor_visitor_, ec);
-            if (ec) return;
+            cursor_visitor_.send_available(ec);
+        }
+        else
+        {
+            parser_.restart();
+            while (!parser_.stopped())
+            {
+                parser_.parse(cursor_visitor_, ec);
+                if (ec) return;
+            }
         }
     }
 
@@ -53,6 +53,7 @@ class basic_ubjson_parser : public ser_context
     bool more_;
     bool done_;
     std::basic_string<char,std::char_traits<char>,char_allocator_type> text_buffer_;
+    std::vector<uint8_t,byte_allocator_type> typed_array_;
     std::vector<parse_state,parse_state_allocator_type> state_stack_;
     int nesting_depth_;
 public:
@@ -65,6 +66,7 @@ public:
          more_(true), 
          done_(false),
          text_buffer_(alloc),
+         typed_array_(alloc),
          state_stack_(alloc),
          nesting_depth_(0)
     {
@@ -579,6 +581,11 @@ private:
                     more_ = false;
                     return;
                 }
+                if (read_typed_array(visitor, b, length, ec))
+                {
+                    --nesting_depth_;
+                    return;
+                }
                 state_stack_.emplace_back(parse_mode::strongly_typed_array,length,b);
                 more_ = visitor.begin_array(length, semantic_tag::none, *this, ec);
             }
@@ -613,6 +620,60 @@ private:
         }
     }
 
+    // Reads a strongly typed array of numbers in one go and passes it on as
+    // a typed array, converted in place from big endian. Returns false for
+    // other element types, which are read one at a time.
+    bool read_typed_array(json_visitor& visitor, uint8_t type, std::size_t length, std::error_code& ec)
+    {
+        switch (type)
+        {
+            case jsoncons::ubjson::ubjson_type::uint8_type:
+                read_typed_array<uint8_t>(visitor, length, ec);
+                return true;
+            case jsoncons::ubjson::ubjson_type::int8_type:
+                read_typed_array<int8_t>(visitor, length, ec);
+                return true;
+            case jsoncons::ubjson::ubjson_type::int16_type:
+                read_typed_array<int16_t>(visitor, length, ec);
+                return true;
+            case jsoncons::ubjson::ubjson_type::int32_type:
+                read_typed_array<int32_t>(visitor, length, ec);
+                return true;
+            case jsoncons::ubjson::ubjson_type::int64_type:
+                read_typed_array<int64_t>(visitor, length, ec);
+                return true;
+            case jsoncons::ubjson::ubjson_type::float32_type:
+                read_typed_array<float>(visitor, length, ec);
+                return true;
+            case jsoncons::ubjson::ubjson_type::float64_type:
+                read_typed_array<double>(visitor, length, ec);
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    template <class T>
+    void read_typed_array(json_visitor& visitor, std::size_t length, std::error_code& ec)
+    {
+        typed_array_.clear();
+        if (source_reader<Source>::read(source_, typed_array_, length*sizeof(T)) != length*sizeof(T))
+        {
+            ec = ubjson_errc::unexpected_eof;
+            more_ = false;
+            return;
+        }
+        T* data = reinterpret_cast<T*>(typed_array_.data());
+        if (jsoncons::endian::native != jsoncons::endian::big)
+        {
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                data[i] = binary::byte_swap<T>(data[i]);
+            }
+        }
+        more_ = visitor.typed_array(jsoncons::span<const T>(data, length), semantic_tag::none, *this, ec);
+    }
+
     void end_array(json_visitor& visitor, std::error_code& ec)
     {
         --nesting_depth_;
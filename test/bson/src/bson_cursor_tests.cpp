@@ -304,3 +304,118 @@ TEMPLATE_TEST_CASE("bson_cursor reset test", "",
         check_bson_cursor_document("third document", cursor, "c", 3);
     }
 }
+
+namespace {
+
+    std::string event_name(const staj_event& event)
+    {
+        std::ostringstream os;
+        os << event.event_type();
+        if (event.event_type() == staj_event_type::key || event.event_type() == staj_event_type::string_value)
+        {
+            os << " " << event.get<std::string>();
+        }
+        return os.str();
+    }
+
+    // The events read from a cursor, skipping the values of members whose names begin with prefix
+    std::vector<std::string> read_skipping(staj_cursor& cursor, const std::string& prefix)
+    {
+        std::vector<std::string> events;
+        bool skip_next = false;
+        for (; !cursor.done(); cursor.next())
+        {
+            events.push_back(event_name(cursor.current()));
+            if (skip_next)
+            {
+                staj_event_type type = cursor.current().event_type();
+                cursor.skip();
+                if (type == staj_event_type::begin_object || type == staj_event_type::begin_array)
+                {
+                    events.push_back(event_name(cursor.current()));
+                }
+                skip_next = false;
+            }
+            else if (cursor.current().event_type() == staj_event_type::key)
+            {
+                skip_next = cursor.current().get<std::string>().compare(0, prefix.size(), prefix) == 0;
+            }
+        }
+        return events;
+    }
+
+} // namespace
+
+TEST_CASE("bson_cursor skip test")
+{
+    std::string text = R"(
+{
+    "a": {"b": [1, {"c": "}]"}], "d": "x"},
+    "skip1": [[1, 2, {"x": "yyyyyyyyyyyyyyyyyyyyyyyyyyyyyy"}], {}, [], "]]", -5, 1.5, true, null, 10000000000],
+    "e": "f",
+    "skip2": {"g": {"h": [true, null, 1.5]}},
+    "skip3": 10,
+    "i": []
+}
+    )";
+
+    std::vector<std::string> expected = {
+        "begin_object",
+        "key a", "begin_object", "key b", "begin_array", "int64_value", "begin_object", "key c", "string_value }]", "end_object", "end_array",
+        "key d", "string_value x", "end_object",
+        "key skip1", "begin_array", "end_array",
+        "key e", "string_value f",
+        "key skip2", "begin_object", "end_object",
+        "key skip3", "int64_value",
+        "key i", "begin_array", "end_array",
+        "end_object"
+    };
+
+    std::vector<uint8_t> data;
+    bson::encode_bson(ojson::parse(text), data);
+
+    SECTION("bytes source")
+    {
+        bson::bson_bytes_cursor cursor(data);
+        CHECK(read_skipping(cursor, "skip") == expected);
+
+        bson::bson_bytes_cursor cursor2(data);
+        cursor2.skip();
+        CHECK(cursor2.current().event_type() == staj_event_type::end_object);
+        cursor2.next();
+        CHECK(cursor2.done());
+    }
+
+    SECTION("stream source")
+    {
+        std::istringstream is(std::string(reinterpret_cast<const char*>(data.data()), data.size()));
+        bson::bson_stream_cursor cursor(is);
+        CHECK(read_skipping(cursor, "skip") == expected);
+    }
+
+    SECTION("errors")
+    {
+        std::vector<uint8_t> data2(data.begin(), data.end() - 2);
+        bson::bson_bytes_cursor cursor(data2);
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == bson::bson_errc::unexpected_eof);
+
+        bson::bson_bytes_cursor cursor2(data2);
+        CHECK_THROWS_AS(cursor2.skip(), ser_error);
+
+        // An embedded document with a length too small to hold its terminator
+        std::vector<uint8_t> data3 = {0x14,0x00,0x00,0x00, // document length 20
+                                      0x03,'a',0x00, // embedded document "a"
+                                      0x04,0x00,0x00,0x00, // length 4
+                                      0x10,'b',0x00,0x01,0x00,0x00,0x00, // int32 "b": 1
+                                      0x00,
+                                      0x00};
+        bson::bson_bytes_cursor cursor3(data3);
+        cursor3.next();
+        cursor3.next();
+        REQUIRE(cursor3.current().event_type() == staj_event_type::begin_object);
+        cursor3.skip(ec);
+        CHECK(ec == bson::bson_errc::size_mismatch);
+    }
+}
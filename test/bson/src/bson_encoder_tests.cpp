@@ -4,7 +4,11 @@
 #include <jsoncons/json.hpp>
 #include <jsoncons_ext/bson/bson.hpp>
 #include <sstream>
+#include <fstream>
+#include <iterator>
 #include <vector>
+#include <deque>
+#include <algorithm>
 #include <utility>
 #include <ctime>
 #include <limits>
@@ -321,3 +325,161 @@ TEMPLATE_TEST_CASE("test_bson_encoder_reset", "",
     f.encoder.flush();
     CHECK(f.bytes2() == expected_full);
 }
+
+namespace {
+
+    // A stream buffer that cannot seek, like a pipe
+    class unseekable_buf : public std::streambuf
+    {
+    public:
+        std::string data;
+    protected:
+        int_type overflow(int_type ch) override
+        {
+            if (ch != traits_type::eof())
+            {
+                data.push_back(static_cast<char>(ch));
+            }
+            return ch;
+        }
+        std::streamsize xsputn(const char* s, std::streamsize n) override
+        {
+            data.append(s, static_cast<std::size_t>(n));
+            return n;
+        }
+    };
+
+    // A sink with only push_back and flush
+    class push_back_sink
+    {
+        std::vector<uint8_t>* buf_ptr_;
+    public:
+        using value_type = uint8_t;
+
+        push_back_sink(std::vector<uint8_t>& buf)
+            : buf_ptr_(std::addressof(buf))
+        {
+        }
+
+        void push_back(uint8_t b)
+        {
+            buf_ptr_->push_back(b);
+        }
+
+        void flush()
+        {
+        }
+    };
+
+    json make_large_document()
+    {
+        json doc(json_object_arg);
+        json& items = doc["items"] = json(json_array_arg);
+        for (int i = 0; i < 2000; ++i)
+        {
+            json item(json_object_arg);
+            item["id"] = i;
+            item["name"] = "item " + std::to_string(i);
+            item["tags"] = json(json_array_arg, {json("a"), json("b")});
+            item["bytes"] = json(byte_string_arg, std::vector<uint8_t>{1,2,3});
+            items.push_back(std::move(item));
+        }
+        doc["nested"] = json::parse(R"({"a":{"b":{"c":[1,2,{"d":"e"}]}}})");
+        return doc;
+    }
+}
+
+TEST_CASE("bson encoder with seekable and unseekable sinks")
+{
+    json doc = make_large_document();
+
+    std::vector<uint8_t> expected;
+    bson::encode_bson(doc, expected);
+    REQUIRE(expected.size() > 32768);
+    CHECK(bson::decode_bson<json>(expected) == doc);
+
+    SECTION("byte container with existing content")
+    {
+        std::vector<uint8_t> v = {0xff, 0xfe};
+        {
+            bson::bson_bytes_encoder encoder(v);
+            doc.dump(encoder);
+        }
+        REQUIRE(v.size() == expected.size() + 2);
+        CHECK(std::equal(expected.begin(), expected.end(), v.begin() + 2));
+    }
+
+    SECTION("deque")
+    {
+        std::deque<uint8_t> d;
+        {
+            bson::basic_bson_encoder<bytes_sink<std::deque<uint8_t>>> encoder(d);
+            doc.dump(encoder);
+        }
+        CHECK(std::vector<uint8_t>(d.begin(), d.end()) == expected);
+    }
+
+    SECTION("stream with existing content")
+    {
+        std::ostringstream os;
+        os << "xyz";
+        {
+            bson::bson_stream_encoder encoder(os);
+            doc.dump(encoder);
+        }
+        std::string s = os.str();
+        REQUIRE(s.size() == expected.size() + 3);
+        CHECK(std::equal(expected.begin(), expected.end(), reinterpret_cast<const uint8_t*>(s.data()) + 3));
+    }
+
+    SECTION("file opened for appending")
+    {
+        std::string path = "./output/append.bson";
+        {
+            std::ofstream os(path, std::ios::binary | std::ios::trunc);
+            os << "xyz";
+        }
+        {
+            std::ofstream os(path, std::ios::binary | std::ios::app);
+            bson::bson_stream_encoder encoder(os);
+            doc.dump(encoder);
+        }
+        std::ifstream is(path, std::ios::binary);
+        std::string s((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+        REQUIRE(s.size() == expected.size() + 3);
+        CHECK(s.substr(0, 3) == "xyz");
+        CHECK(std::equal(expected.begin(), expected.end(), reinterpret_cast<const uint8_t*>(s.data()) + 3));
+    }
+
+    SECTION("sink without append")
+    {
+        std::vector<uint8_t> v;
+        {
+            bson::basic_bson_encoder<push_back_sink> encoder(v);
+            doc.dump(encoder);
+        }
+        CHECK(v == expected);
+    }
+
+    SECTION("unseekable stream")
+    {
+        unseekable_buf buf;
+        std::ostream os(&buf);
+        {
+            bson::bson_stream_encoder encoder(os);
+            doc.dump(encoder);
+        }
+        REQUIRE(buf.data.size() == expected.size());
+        CHECK(std::equal(expected.begin(), expected.end(), reinterpret_cast<const uint8_t*>(buf.data.data())));
+    }
+
+    SECTION("second document is an error")
+    {
+        std::vector<uint8_t> v;
+        bson::bson_bytes_encoder encoder(v);
+        doc.dump(encoder);
+        std::error_code ec;
+        doc.dump(encoder, ec);
+        CHECK(ec == bson::bson_errc::expected_bson_document);
+    }
+}
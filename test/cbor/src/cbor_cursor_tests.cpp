@@ -385,3 +385,158 @@ TEMPLATE_TEST_CASE("cbor_cursor reset test", "",
         CHECK(cursor.done());
     }
 }
+
+namespace {
+
+    std::string event_name(const staj_event& event)
+    {
+        std::ostringstream os;
+        os << event.event_type();
+        if (event.event_type() == staj_event_type::key || event.event_type() == staj_event_type::string_value)
+        {
+            os << " " << event.get<std::string>();
+        }
+        return os.str();
+    }
+
+    // The events read from a cursor, skipping the values of members whose names begin with prefix
+    std::vector<std::string> read_skipping(staj_cursor& cursor, const std::string& prefix)
+    {
+        std::vector<std::string> events;
+        bool skip_next = false;
+        for (; !cursor.done(); cursor.next())
+        {
+            events.push_back(event_name(cursor.current()));
+            if (skip_next)
+            {
+                staj_event_type type = cursor.current().event_type();
+                cursor.skip();
+                if (type == staj_event_type::begin_object || type == staj_event_type::begin_array)
+                {
+                    events.push_back(event_name(cursor.current()));
+                }
+                skip_next = false;
+            }
+            else if (cursor.current().event_type() == staj_event_type::key)
+            {
+                skip_next = cursor.current().get<std::string>().compare(0, prefix.size(), prefix) == 0;
+            }
+        }
+        return events;
+    }
+
+} // namespace
+
+TEST_CASE("cbor_cursor skip test")
+{
+    std::string text = R"(
+{
+    "a": {"b": [1, {"c": "}]"}], "d": "x"},
+    "skip1": [[1, 2, {"x": "yyyyyyyyyyyyyyyyyyyyyyyyyyyyyy"}], {}, [], "]]", -5, 1.5, true, null, 100000],
+    "e": "yyyyyyyyyyyyyyyyyyyyyyyyyyyyyy",
+    "skip2": {"g": {"h": [true, null, 1.5, 1.0e300]}},
+    "skip3": 10,
+    "i": [],
+    "skip4": "yyyyyyyyyyyyyyyyyyyyyyyyyyyyyy"
+}
+    )";
+
+    json_string_cursor json_cursor(text);
+    std::vector<std::string> expected = read_skipping(json_cursor, "skip");
+
+    SECTION("definite length")
+    {
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(ojson::parse(text), data);
+
+        cbor::cbor_bytes_cursor cursor(data);
+        CHECK(read_skipping(cursor, "skip") == expected);
+
+        cbor::cbor_bytes_cursor cursor2(data);
+        cursor2.skip();
+        CHECK(cursor2.current().event_type() == staj_event_type::end_object);
+        cursor2.next();
+        CHECK(cursor2.done());
+    }
+
+    SECTION("indefinite length")
+    {
+        std::vector<uint8_t> data;
+        cbor::cbor_bytes_encoder encoder(data);
+        json_string_reader reader(text, encoder);
+        reader.read();
+        REQUIRE(data[0] == 0xbf);
+
+        cbor::cbor_bytes_cursor cursor(data);
+        CHECK(read_skipping(cursor, "skip") == expected);
+
+        std::istringstream is(std::string(reinterpret_cast<const char*>(data.data()), data.size()));
+        cbor::cbor_stream_cursor cursor2(is);
+        CHECK(read_skipping(cursor2, "skip") == expected);
+    }
+
+    SECTION("stringref namespace")
+    {
+        std::vector<uint8_t> data;
+        auto options = cbor::cbor_options{}.pack_strings(true);
+        cbor::encode_cbor(ojson::parse(text), data, options);
+
+        cbor::cbor_bytes_cursor cursor(data);
+        CHECK(read_skipping(cursor, "skip") == expected);
+    }
+
+    SECTION("tags")
+    {
+        std::vector<uint8_t> data = {0x82,0x83,0x63,0x66,0x6f,0x6f,0x44,0x50,0x75,0x73,0x73,0xc3,0x49,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x63,0x62,0x61,0x72,0xd6,0x44,0x50,0x75,0x73,0x73,0xc4,0x82,0x21,0x19,0x6a,0xb3};
+
+        cbor::cbor_bytes_cursor cursor(data);
+        cursor.next();
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_array);
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_array);
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::end_array);
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("typed array")
+    {
+        std::vector<uint16_t> a = {1,2};
+        std::vector<uint16_t> b = {3,4,5};
+        std::vector<uint8_t> data;
+        auto options = cbor::cbor_options{}.use_typed_arrays(true);
+        cbor::cbor_bytes_encoder encoder(data, options);
+        encoder.begin_object();
+        encoder.key("a");
+        encoder.typed_array(jsoncons::span<const uint16_t>(a));
+        encoder.key("skip");
+        encoder.typed_array(jsoncons::span<const uint16_t>(b));
+        encoder.end_object();
+        encoder.flush();
+
+        cbor::cbor_bytes_cursor cursor(data);
+        std::vector<std::string> events = {"begin_object", "key a", "begin_array", "uint64_value", "uint64_value", "end_array",
+                                           "key skip", "begin_array", "end_array", "end_object"};
+        CHECK(read_skipping(cursor, "skip") == events);
+    }
+
+    SECTION("unexpected eof")
+    {
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(json::parse(R"([[1,"abcdef"]])"), data);
+        data.pop_back();
+
+        cbor::cbor_bytes_cursor cursor(data);
+        cursor.next();
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == cbor::cbor_errc::unexpected_eof);
+
+        cbor::cbor_bytes_cursor cursor2(data);
+        CHECK_THROWS_AS(cursor2.skip(), ser_error);
+    }
+}
@@ -415,6 +415,63 @@ TEST_CASE("encode stringref")
     CHECK(j2 == j);
 }
 
+TEST_CASE("encode stringref with many distinct strings")
+{
+    ojson j(json_array_arg);
+    for (int i = 0; i < 3000; ++i)
+    {
+        ojson record(json_object_arg);
+        record.insert_or_assign("key" + std::to_string(i % 1000), "value " + std::to_string(i % 700));
+        record.insert_or_assign("bytes", ojson(byte_string_arg, std::vector<uint8_t>{'k','e','y','0'}));
+        record.insert_or_assign("text", "key0");
+        j.push_back(std::move(record));
+    }
+
+    std::vector<uint8_t> plain;
+    cbor::encode_cbor(j, plain);
+
+    SECTION("unbounded")
+    {
+        cbor::cbor_options options;
+        options.pack_strings(true);
+        std::vector<uint8_t> buf;
+        cbor::encode_cbor(j, buf, options);
+        CHECK(buf.size() < plain.size());
+        CHECK(cbor::decode_cbor<ojson>(buf) == j);
+    }
+
+    SECTION("max_stringrefs")
+    {
+        cbor::cbor_options options;
+        options.pack_strings(true)
+               .max_stringrefs(100);
+        std::vector<uint8_t> buf;
+        cbor::encode_cbor(j, buf, options);
+        CHECK(buf.size() < plain.size());
+        CHECK(cbor::decode_cbor<ojson>(buf) == j);
+
+        cbor::cbor_options options2;
+        options2.pack_strings(true)
+                .max_stringrefs(0);
+        std::vector<uint8_t> buf2;
+        cbor::encode_cbor(j, buf2, options2);
+        CHECK(buf2.size() == plain.size() + 3); // tag 256
+        CHECK(cbor::decode_cbor<ojson>(buf2) == j);
+    }
+
+    SECTION("text and byte strings with the same bytes are distinct")
+    {
+        cbor::cbor_options options;
+        options.pack_strings(true);
+        std::vector<uint8_t> buf;
+        cbor::encode_cbor(j[0], buf, options);
+        ojson j2 = cbor::decode_cbor<ojson>(buf);
+        CHECK(j2["text"].is_string());
+        CHECK(j2["bytes"].is_byte_string());
+        CHECK(j2 == j[0]);
+    }
+}
+
 TEST_CASE("cbor encode with semantic_tags")
 {
     SECTION("string")
@@ -154,9 +154,17 @@ namespace { namespace ns {
         std::string name;
     };
 
+    struct Record
+    {
+        std::vector<uint8_t> data;
+        std::vector<Person> people;
+        double score;
+    };
+
 }}
 
 JSONCONS_ALL_MEMBER_TRAITS(ns::Person, name)
+JSONCONS_ALL_MEMBER_TRAITS(ns::Record, score, people, data)
 
 TEST_CASE("encode_cbor overloads")
 {
@@ -183,3 +191,36 @@ TEST_CASE("encode_cbor overloads")
     }
 }
 
+
+TEST_CASE("encode_cbor member traits")
+{
+    ns::Record record{{1,2,3}, {{"John Smith"},{"Jane Doe"}}, 1.5};
+
+    SECTION("same bytes as encoding to_json")
+    {
+        std::vector<uint8_t> expected;
+        cbor::encode_cbor(json(record), expected);
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(record, data);
+        CHECK(data == expected);
+
+        ns::Record other = cbor::decode_cbor<ns::Record>(data);
+        CHECK(other.data == record.data);
+        REQUIRE(other.people.size() == 2);
+        CHECK(other.people[1].name == "Jane Doe");
+        CHECK(other.score == 1.5);
+    }
+    SECTION("byte string member")
+    {
+        ojson j(json_object_arg);
+        j.try_emplace("data", byte_string_arg, record.data);
+        j.try_emplace("people", json_array_arg);
+        j.try_emplace("score", 2.0);
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(j, data);
+
+        ns::Record other = cbor::decode_cbor<ns::Record>(data);
+        CHECK(other.data == record.data);
+        CHECK(other.score == 2.0);
+    }
+}
@@ -0,0 +1,199 @@
+// Copyright 2022 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/arena_json.hpp>
+#include <catch/catch.hpp>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("arena tests")
+{
+    SECTION("alignment and chunk growth")
+    {
+        arena a(256);
+        CHECK(a.chunk_count() == 0);
+
+        void* p1 = a.allocate(1, 1);
+        void* p2 = a.allocate(sizeof(double), alignof(double));
+        CHECK(reinterpret_cast<uintptr_t>(p1) % alignof(std::max_align_t) == 0);
+        CHECK(reinterpret_cast<uintptr_t>(p2) % alignof(std::max_align_t) == 0);
+        CHECK(p1 != p2);
+        CHECK(a.chunk_count() == 1);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            a.allocate(100, 8);
+        }
+        CHECK(a.chunk_count() > 1);
+        CHECK(a.chunk_count() < 10);
+        CHECK(a.bytes_allocated() == 1 + sizeof(double) + 100*100);
+
+        a.release();
+        CHECK(a.chunk_count() == 0);
+        CHECK(a.bytes_allocated() == 0);
+    }
+
+    SECTION("allocation larger than a chunk")
+    {
+        arena a(64);
+        void* p = a.allocate(10000, 8);
+        CHECK(p != nullptr);
+        CHECK(a.chunk_count() == 1);
+    }
+}
+
+TEST_CASE("arena_allocator tests")
+{
+    SECTION("std::vector")
+    {
+        arena a;
+        std::vector<int,arena_allocator<int>> v{arena_allocator<int>(a)};
+        for (int i = 0; i < 1000; ++i)
+        {
+            v.push_back(i);
+        }
+        CHECK(v.size() == 1000);
+        CHECK(v[999] == 999);
+        CHECK(a.bytes_allocated() >= 1000*sizeof(int));
+    }
+
+    SECTION("equality")
+    {
+        arena a1;
+        arena a2;
+        CHECK(arena_allocator<char>(a1) == arena_allocator<int>(a1));
+        CHECK(arena_allocator<char>(a1) != arena_allocator<char>(a2));
+        CHECK(arena_allocator<char>() != arena_allocator<char>(a1));
+        CHECK(arena_allocator<char>() == arena_allocator<char>());
+    }
+
+    SECTION("default constructed allocator cannot allocate")
+    {
+        arena_allocator<char> alloc;
+        CHECK_THROWS_AS(alloc.allocate(1), assertion_error);
+        CHECK_THROWS_AS(arena_json("String too long for short string storage"), assertion_error);
+
+        arena_json j("short");
+        CHECK(j.get_allocator().get_arena() == nullptr);
+    }
+}
+
+TEST_CASE("arena_document tests")
+{
+    std::string input = R"(
+{
+    "books" : [
+        {"title" : "Kafka on the Shore", "author" : "Haruki Murakami", "price" : 25.17, "tags" : ["fiction", "magical realism"]},
+        {"title" : "Pulp", "author" : "Charles Bukowski", "price" : 22.48, "tags" : []},
+        {"title" : "Cutter's Way", "author" : "Newton Thornburg", "price" : 23.50, "tags" : ["noir"]}
+    ],
+    "escaped \"name\"" : "A string long enough to need heap storage\n"
+}
+    )";
+
+    SECTION("parse string")
+    {
+        auto doc = arena_document<arena_json>::parse(input);
+        const arena_json& root = doc.root();
+
+        REQUIRE(root.is_object());
+        CHECK(root["books"].size() == 3);
+        CHECK(root["books"][0]["author"].as<std::string>() == "Haruki Murakami");
+        CHECK(root["books"][2]["tags"][0].as<std::string>() == "noir");
+        CHECK(root["escaped \"name\""].as<std::string>() == "A string long enough to need heap storage\n");
+        CHECK(root.get_allocator().get_arena() == &doc.get_arena());
+        CHECK(root["books"].get_allocator().get_arena() == &doc.get_arena());
+        CHECK(doc.get_arena().chunk_count() <= 2);
+
+        json expected = json::parse(input);
+        std::string s1;
+        root.dump(s1);
+        std::string s2;
+        expected.dump(s2);
+        CHECK(s1 == s2);
+    }
+
+    SECTION("parse with borrowed strings")
+    {
+        auto doc = arena_document<arena_json>::parse(borrowed_string_arg, input);
+        const arena_json& root = doc.root();
+
+        const arena_json& title = root["books"][0]["title"];
+        REQUIRE(title.storage_kind() == json_storage_kind::borrowed_string_value);
+        CHECK(title.as_string_view().data() > input.data());
+        CHECK(title.as_string_view().data() < input.data() + input.size());
+
+        const arena_json& escaped = root["escaped \"name\""];
+        REQUIRE(escaped.storage_kind() == json_storage_kind::long_string_value);
+        CHECK(escaped.as<std::string>() == "A string long enough to need heap storage\n");
+        CHECK(escaped.get_allocator().get_arena() == &doc.get_arena());
+
+        json expected = json::parse(input);
+        std::string s1;
+        root.dump(s1);
+        std::string s2;
+        expected.dump(s2);
+        CHECK(s1 == s2);
+    }
+
+    SECTION("parse stream")
+    {
+        std::istringstream is(input);
+        auto doc = arena_document<arena_ojson>::parse(is);
+        CHECK(doc.root()["books"][1]["title"].as<std::string>() == "Pulp");
+        CHECK(doc.root().object_range().begin()->key() == "books");
+    }
+
+    SECTION("parse error")
+    {
+        CHECK_THROWS_AS(arena_document<arena_json>::parse(std::string("[1,2")), ser_error);
+    }
+
+    SECTION("modify with the document's allocator")
+    {
+        auto doc = arena_document<arena_json>::parse(input);
+        std::size_t before = doc.get_arena().bytes_allocated();
+        doc.root().try_emplace("comment", "A string long enough to need heap storage", semantic_tag::none, doc.get_allocator());
+        CHECK(doc.get_arena().bytes_allocated() > before);
+        CHECK(doc.root()["comment"].as<std::string>() == "A string long enough to need heap storage");
+    }
+
+    SECTION("empty document")
+    {
+        arena_document<arena_json> doc;
+        CHECK(doc.root().is_object());
+        CHECK(doc.root().empty());
+        CHECK(doc.root().get_allocator().get_arena() == &doc.get_arena());
+
+        doc.root()["k"] = arena_json("A string long enough to need heap storage", semantic_tag::none, doc.get_allocator());
+        CHECK(doc.root()["k"].as<std::string>() == "A string long enough to need heap storage");
+        CHECK_THROWS_AS(doc.root()["k2"] = arena_json("Another string long enough to need heap storage"), assertion_error);
+    }
+
+    SECTION("move")
+    {
+        auto doc = arena_document<arena_json>::parse(input);
+        arena_document<arena_json> doc2(std::move(doc));
+        CHECK(doc2.root()["books"].size() == 3);
+        CHECK_THROWS_AS(doc.root(), assertion_error);
+
+        doc2 = arena_document<arena_json>::parse(std::string("[1,2,3]"));
+        CHECK(doc2.root().size() == 3);
+    }
+
+    SECTION("json_decoder with an arena allocator")
+    {
+        arena a;
+        json_decoder<arena_json> decoder(result_allocator_arg, arena_allocator<char>(a));
+        json_string_reader reader(input, decoder);
+        reader.read();
+        REQUIRE(decoder.is_valid());
+        arena_json j = decoder.get_result();
+        CHECK(j["books"][1]["author"].as<std::string>() == "Charles Bukowski");
+        CHECK(a.bytes_allocated() > 0);
+    }
+}
@@ -9,6 +9,45 @@
 
 using namespace jsoncons;
 
+namespace decode_traits_tests {
+
+    struct point
+    {
+        int x;
+        int y;
+    };
+
+    struct shape
+    {
+        std::string name;
+        std::vector<point> points;
+        jsoncons::optional<std::string> color;
+        std::shared_ptr<double> area;
+    };
+
+    // abcd and aBcd hash alike, they differ only away from the first, middle and last characters
+    struct similar
+    {
+        int abcd;
+        int aBcd;
+        int abxd;
+        int a;
+    };
+
+    template <class T>
+    struct labeled
+    {
+        std::string label;
+        T value;
+    };
+
+} // namespace decode_traits_tests
+
+JSONCONS_ALL_MEMBER_TRAITS(decode_traits_tests::point, x, y)
+JSONCONS_N_MEMBER_TRAITS(decode_traits_tests::shape, 2, name, points, color, area)
+JSONCONS_ALL_MEMBER_TRAITS(decode_traits_tests::similar, abcd, aBcd, abxd, a)
+JSONCONS_TPL_ALL_MEMBER_TRAITS(1, decode_traits_tests::labeled, label, value)
+
 TEST_CASE("decode_traits primitive")
 {
     SECTION("is_primitive")
@@ -149,3 +188,117 @@ TEST_CASE("decode_traits deserialization errors")
         CHECK(ec == json_errc::expected_comma_or_rbrace);
     }
 }
+
+TEST_CASE("decode_traits member traits")
+{
+    using decode_traits_tests::point;
+    using decode_traits_tests::shape;
+
+    SECTION("members in any order, unknown members skipped")
+    {
+        std::string input = R"({"points":[{"y":2,"x":1,"z":[3,{"w":4}]},{"x":5,"y":6}],"extra":{"a":[1,2]},"name":"line"})";
+
+        json_decoder<json> decoder;
+        std::error_code ec;
+        json_string_cursor cursor(input);
+        auto val = decode_traits<shape,char>::decode(cursor,decoder,ec);
+
+        REQUIRE_FALSE(ec);
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        CHECK(val.name == "line");
+        REQUIRE(val.points.size() == 2);
+        CHECK(val.points[0].x == 1);
+        CHECK(val.points[0].y == 2);
+        CHECK(val.points[1].x == 5);
+        CHECK_FALSE(val.color);
+        CHECK_FALSE(val.area);
+    }
+    SECTION("optional members")
+    {
+        std::string input = R"({"name":"dot","points":[],"color":"red","area":0.5})";
+
+        auto val = decode_json<shape>(input);
+        CHECK(val.color.value() == "red");
+        REQUIRE(val.area);
+        CHECK(*val.area == 0.5);
+    }
+    SECTION("class template")
+    {
+        std::string input = R"({"value":{"x":1,"y":2},"label":"origin"})";
+
+        auto val = decode_json<decode_traits_tests::labeled<point>>(input);
+        CHECK(val.label == "origin");
+        CHECK(val.value.y == 2);
+    }
+    SECTION("member names that hash alike")
+    {
+        std::string input = R"({"aBcd":2,"abzd":0,"abcd":1,"a":4,"aBzd":0,"":0,"abxd":3})";
+
+        auto val = decode_json<decode_traits_tests::similar>(input);
+        CHECK(val.abcd == 1);
+        CHECK(val.aBcd == 2);
+        CHECK(val.abxd == 3);
+        CHECK(val.a == 4);
+
+        ojson j = ojson::parse(input);
+        REQUIRE(j.is<decode_traits_tests::similar>());
+        auto val2 = j.as<decode_traits_tests::similar>();
+        CHECK(val2.abcd == 1);
+        CHECK(val2.aBcd == 2);
+        CHECK(val2.abxd == 3);
+        CHECK(val2.a == 4);
+
+        j.erase("aBcd");
+        CHECK_FALSE(j.is<decode_traits_tests::similar>());
+        CHECK_THROWS_AS(j.as<decode_traits_tests::similar>(), conv_error);
+        CHECK_THROWS_AS(decode_json<decode_traits_tests::similar>(j.to_string()), ser_error);
+    }
+    SECTION("errors")
+    {
+        std::vector<std::string> inputs = {R"({"x":1})", R"({"name":"line"})", R"([1,2])", R"({"x":1,"y":"two"})"};
+        std::vector<std::error_code> expected = {conv_errc::conversion_failed, conv_errc::conversion_failed,
+                                                 conv_errc::conversion_failed, conv_errc::not_integer};
+
+        for (std::size_t i = 0; i < inputs.size(); ++i)
+        {
+            json_decoder<json> decoder;
+            std::error_code ec;
+            json_string_cursor cursor(inputs[i]);
+            if (i == 1)
+            {
+                decode_traits<shape,char>::decode(cursor,decoder,ec);
+            }
+            else
+            {
+                decode_traits<point,char>::decode(cursor,decoder,ec);
+            }
+            INFO(inputs[i]);
+            CHECK(ec == expected[i]);
+        }
+        CHECK_THROWS_AS(decode_json<point>(std::string(R"({"y":1})")), ser_error);
+    }
+    SECTION("encode writes the same events as to_json")
+    {
+        shape val;
+        val.name = "triangle";
+        val.points = {{0,0},{1,0},{0,1}};
+        val.area = std::make_shared<double>(0.5);
+
+        std::string s1;
+        encode_json(val, s1);
+        CHECK(s1 == json(val).to_string());
+
+        std::string s2;
+        compact_json_string_encoder encoder(s2);
+        std::error_code ec;
+        encode_traits<shape,char>::encode(val, encoder, ojson(), ec);
+        encoder.flush();
+        REQUIRE_FALSE(ec);
+        CHECK(s2 == ojson(val).to_string());
+        CHECK(s2 == R"({"name":"triangle","points":[{"x":0,"y":0},{"x":1,"y":0},{"x":0,"y":1}],"area":0.5})");
+
+        std::wstring s3;
+        encode_json(decode_traits_tests::labeled<point>{"p",{1,2}}, s3);
+        CHECK(s3 == LR"({"label":"p","value":{"x":1,"y":2}})");
+    }
+}
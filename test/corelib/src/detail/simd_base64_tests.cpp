@@ -0,0 +1,208 @@
+// Copyright 2022 Daniel Parker
+// Distributed under Boost license
+
+#include <catch/catch.hpp>
+#include <jsoncons/detail/simd_base64.hpp>
+#include <jsoncons/json.hpp>
+#include <deque>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::vector<uint8_t> make_bytes(std::size_t length)
+    {
+        std::vector<uint8_t> bytes;
+        uint32_t x = 2463534242u;
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+            bytes.push_back(static_cast<uint8_t>(x));
+        }
+        return bytes;
+    }
+
+    // Decodes through the pointer path and through the iterator path, which does not use blocks
+    template <class Decode>
+    void check_decode_same(const std::string& s, Decode decode)
+    {
+        std::deque<char> d(s.begin(), s.end());
+        std::vector<uint8_t> expected;
+        auto expected_result = decode(d.begin(), d.end(), expected);
+
+        std::vector<uint8_t> bytes;
+        auto result = decode(s.data(), s.data() + s.size(), bytes);
+
+        CHECK(result.ec == expected_result.ec);
+        CHECK((result.it - s.data()) == (expected_result.it - d.begin()));
+        CHECK(bytes == expected);
+    }
+
+    struct base64_decoder
+    {
+        template <class InputIt>
+        decode_result<InputIt> operator()(InputIt first, InputIt last, std::vector<uint8_t>& result) const
+        {
+            return decode_base64(first, last, result);
+        }
+    };
+
+    struct base64url_decoder
+    {
+        template <class InputIt>
+        decode_result<InputIt> operator()(InputIt first, InputIt last, std::vector<uint8_t>& result) const
+        {
+            return decode_base64url(first, last, result);
+        }
+    };
+
+    struct base16_decoder
+    {
+        template <class InputIt>
+        decode_result<InputIt> operator()(InputIt first, InputIt last, std::vector<uint8_t>& result) const
+        {
+            return decode_base16(first, last, result);
+        }
+    };
+
+} // namespace
+
+TEST_CASE("base64 block encode tests")
+{
+    for (std::size_t len = 0; len <= 200; ++len)
+    {
+        auto bytes = make_bytes(len);
+        std::deque<uint8_t> d(bytes.begin(), bytes.end());
+
+        std::string expected;
+        std::size_t expected_n = encode_base64(d.begin(), d.end(), expected);
+        std::string s;
+        std::size_t n = encode_base64(bytes.data(), bytes.data() + bytes.size(), s);
+        CHECK(n == expected_n);
+        CHECK(s == expected);
+
+        expected.clear();
+        expected_n = encode_base64url(d.begin(), d.end(), expected);
+        s.clear();
+        n = encode_base64url(bytes.data(), bytes.data() + bytes.size(), s);
+        CHECK(n == expected_n);
+        CHECK(s == expected);
+
+        expected.clear();
+        expected_n = encode_base16(d.begin(), d.end(), expected);
+        s.clear();
+        n = encode_base16(bytes.data(), bytes.data() + bytes.size(), s);
+        CHECK(n == expected_n);
+        CHECK(s == expected);
+    }
+}
+
+TEST_CASE("base64 block encode to sink tests")
+{
+    auto bytes = make_bytes(3000);
+
+    std::string expected;
+    encode_base64(bytes.begin(), bytes.end(), expected);
+
+    std::string s;
+    jsoncons::string_sink<std::string> sink(s);
+    encode_base64(bytes.data(), bytes.data() + bytes.size(), sink);
+    sink.flush();
+    CHECK(s == expected);
+
+    std::wstring ws;
+    encode_base64(bytes.data(), bytes.data() + bytes.size(), ws);
+    CHECK(ws == std::wstring(expected.begin(), expected.end()));
+}
+
+TEST_CASE("base64 block decode tests")
+{
+    SECTION("round trip")
+    {
+        for (std::size_t len = 0; len <= 200; ++len)
+        {
+            auto bytes = make_bytes(len);
+            std::string s;
+            encode_base64(bytes.data(), bytes.data() + bytes.size(), s);
+            check_decode_same(s, base64_decoder());
+            std::vector<uint8_t> decoded;
+            auto result = decode_base64(s.data(), s.data() + s.size(), decoded);
+            CHECK(result.ec == conv_errc::success);
+            CHECK(decoded == bytes);
+
+            s.clear();
+            encode_base64url(bytes.data(), bytes.data() + bytes.size(), s);
+            check_decode_same(s, base64url_decoder());
+            decoded.clear();
+            result = decode_base64url(s.data(), s.data() + s.size(), decoded);
+            CHECK(result.ec == conv_errc::success);
+            CHECK(decoded == bytes);
+        }
+    }
+    SECTION("invalid character at every offset")
+    {
+        const std::string bad = "!*.\x80\xff-_+/=";
+        auto bytes = make_bytes(120);
+        std::string s;
+        encode_base64(bytes.data(), bytes.data() + bytes.size(), s);
+        std::string u;
+        encode_base64url(bytes.data(), bytes.data() + bytes.size(), u);
+        for (std::size_t pos = 0; pos < s.size(); ++pos)
+        {
+            for (char c : bad)
+            {
+                std::string t(s);
+                t[pos] = c;
+                check_decode_same(t, base64_decoder());
+                std::string v(u);
+                v[pos] = c;
+                check_decode_same(v, base64url_decoder());
+            }
+        }
+    }
+}
+
+TEST_CASE("base16 block decode tests")
+{
+    SECTION("round trip")
+    {
+        for (std::size_t len = 0; len <= 100; ++len)
+        {
+            auto bytes = make_bytes(len);
+            std::string s;
+            encode_base16(bytes.data(), bytes.data() + bytes.size(), s);
+            check_decode_same(s, base16_decoder());
+            for (auto& c : s)
+            {
+                c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            }
+            std::vector<uint8_t> decoded;
+            auto result = decode_base16(s.data(), s.data() + s.size(), decoded);
+            CHECK(result.ec == conv_errc::success);
+            CHECK(decoded == bytes);
+        }
+    }
+    SECTION("invalid character at every offset")
+    {
+        const std::string bad = "gG/:@`\x80 ";
+        auto bytes = make_bytes(60);
+        std::string s;
+        encode_base16(bytes.data(), bytes.data() + bytes.size(), s);
+        for (std::size_t pos = 0; pos < s.size(); ++pos)
+        {
+            for (char c : bad)
+            {
+                std::string t(s);
+                t[pos] = c;
+                check_decode_same(t, base16_decoder());
+                std::vector<uint8_t> decoded;
+                auto result = decode_base16(t.data(), t.data() + t.size(), decoded);
+                CHECK(result.ec == conv_errc::not_base16);
+                CHECK(result.it == t.data());
+            }
+        }
+        check_decode_same(s.substr(1), base16_decoder());
+    }
+}
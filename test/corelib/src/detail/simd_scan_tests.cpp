@@ -0,0 +1,182 @@
+// Copyright 2022 Daniel Parker
+// Distributed under Boost license
+
+#include <catch/catch.hpp>
+#include <jsoncons/detail/simd_scan.hpp>
+#include <jsoncons/json.hpp>
+#include <string>
+
+namespace {
+
+    const char* scalar_find_string_special(const char* first, const char* last)
+    {
+        while (first != last && !jsoncons::detail::is_string_special(*first))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    const char* scalar_find_bracket_special(const char* first, const char* last)
+    {
+        while (first != last && !jsoncons::detail::is_bracket_special(*first))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    const char* scalar_skip_blanks(const char* first, const char* last)
+    {
+        while (first != last && (*first == ' ' || *first == '\t'))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+} // namespace
+
+TEST_CASE("jsoncons::detail::find_string_special tests")
+{
+    const std::string specials = std::string("\"\\\x01\x1f\t\n\r") + '\0';
+
+    SECTION("no special characters")
+    {
+        for (std::size_t len = 0; len <= 100; ++len)
+        {
+            std::string s(len, 'a');
+            CHECK(jsoncons::detail::find_string_special(s.data(), s.data() + s.size()) == s.data() + s.size());
+        }
+    }
+    SECTION("special character at every offset")
+    {
+        for (std::size_t len = 1; len <= 100; ++len)
+        {
+            for (std::size_t pos = 0; pos < len; ++pos)
+            {
+                for (char c : specials)
+                {
+                    std::string s(len, 'x');
+                    s[pos] = c;
+                    const char* first = s.data();
+                    const char* last = s.data() + s.size();
+                    CHECK(jsoncons::detail::find_string_special(first, last) == scalar_find_string_special(first, last));
+                }
+            }
+        }
+    }
+    SECTION("non-ASCII bytes are not special")
+    {
+        std::string s(64, '\xe9');
+        s.push_back('\"');
+        CHECK(jsoncons::detail::find_string_special(s.data(), s.data() + s.size()) == s.data() + 64);
+        s = std::string(64, '\x7f');
+        CHECK(jsoncons::detail::find_string_special(s.data(), s.data() + s.size()) == s.data() + s.size());
+    }
+    SECTION("wchar_t")
+    {
+        std::wstring s = L"abcédef\"";
+        CHECK(jsoncons::detail::find_string_special(s.data(), s.data() + s.size()) == s.data() + 7);
+    }
+}
+
+TEST_CASE("jsoncons::detail::find_bracket_special tests")
+{
+    const std::string specials = "{}[]\"/\n\r";
+
+    SECTION("special character at every offset")
+    {
+        for (std::size_t len = 0; len <= 100; ++len)
+        {
+            for (std::size_t pos = 0; pos <= len; ++pos)
+            {
+                for (char c : specials)
+                {
+                    std::string s(len, '0');
+                    if (pos < len)
+                    {
+                        s[pos] = c;
+                    }
+                    const char* first = s.data();
+                    const char* last = s.data() + s.size();
+                    CHECK(jsoncons::detail::find_bracket_special(first, last) == scalar_find_bracket_special(first, last));
+                }
+            }
+        }
+    }
+    SECTION("may stop early but never passes a special character")
+    {
+        std::string s = "truefalse null 12.5e-3,: YyZ_\x7f\xdb\xfd\t ";
+        s += s;
+        s += s;
+        s.push_back(']');
+        const char* first = s.data();
+        const char* last = s.data() + s.size();
+        const char* p = jsoncons::detail::find_bracket_special(first, last);
+        while (p != last && !jsoncons::detail::is_bracket_special(*p))
+        {
+            p = jsoncons::detail::find_bracket_special(p + 1, last);
+        }
+        CHECK(p == s.data() + s.size() - 1);
+    }
+}
+
+TEST_CASE("jsoncons::detail::skip_blanks tests")
+{
+    for (std::size_t len = 0; len <= 100; ++len)
+    {
+        for (std::size_t pos = 0; pos <= len; ++pos)
+        {
+            std::string s;
+            for (std::size_t i = 0; i < len; ++i)
+            {
+                s.push_back(i % 3 == 0 ? '\t' : ' ');
+            }
+            if (pos < len)
+            {
+                s[pos] = pos % 2 == 0 ? '\n' : '{';
+            }
+            const char* first = s.data();
+            const char* last = s.data() + s.size();
+            CHECK(jsoncons::detail::skip_blanks(first, last) == scalar_skip_blanks(first, last));
+        }
+    }
+}
+
+TEST_CASE("json parser with long strings and whitespace runs")
+{
+    SECTION("escapes and indentation")
+    {
+        std::string content(100, 'a');
+        content += "\\\"";
+        content += std::string(37, 'b');
+        content += "\\u00e9";
+        content += std::string(17, 'c');
+
+        std::string input = "{" + std::string(40, ' ') + "\"" + std::string(50, 'k') + "\"" + std::string(33, '\t') +
+                            ":" + std::string(20, ' ') + "\"" + content + "\"" + std::string(64, ' ') + "}";
+
+        jsoncons::json j = jsoncons::json::parse(input);
+        std::string expected = std::string(100, 'a') + "\"" + std::string(37, 'b') + "\xc3\xa9" + std::string(17, 'c');
+        REQUIRE(j.is_object());
+        CHECK(j[std::string(50, 'k')].as<std::string>() == expected);
+    }
+
+    SECTION("error position of control character")
+    {
+        for (std::size_t pos = 0; pos < 70; ++pos)
+        {
+            std::string input = "[\"" + std::string(70, 'x') + "\"]";
+            input[2 + pos] = '\x01';
+
+            std::error_code ec;
+            jsoncons::json_decoder<jsoncons::json> decoder;
+            jsoncons::json_string_reader reader(input, decoder);
+            reader.read(ec);
+            CHECK(ec == jsoncons::json_errc::illegal_control_character);
+            CHECK(reader.line() == 1);
+            CHECK(reader.column() == pos + 4);
+        }
+    }
+}
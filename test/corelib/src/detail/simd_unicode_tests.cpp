@@ -0,0 +1,188 @@
+// Copyright 2022 Daniel Parker
+// Distributed under Boost license
+
+#include <catch/catch.hpp>
+#include <jsoncons/detail/simd_unicode.hpp>
+#include <jsoncons/json.hpp>
+#include <deque>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    // Validates one sequence at a time, as unicode_traits::validate did before block validation
+    unicode_traits::convert_result<char> scalar_validate(const char* data, std::size_t length)
+    {
+        unicode_traits::conv_errc result = unicode_traits::conv_errc();
+        const char* last = data + length;
+        while (data != last)
+        {
+            std::size_t len = static_cast<std::size_t>(unicode_traits::trailing_bytes_for_utf8[static_cast<uint8_t>(*data)]) + 1;
+            if (len > (std::size_t)(last - data))
+            {
+                return unicode_traits::convert_result<char>{data, unicode_traits::conv_errc::source_exhausted};
+            }
+            if ((result=unicode_traits::is_legal_utf8(data, len)) != unicode_traits::conv_errc())
+            {
+                return unicode_traits::convert_result<char>{data,result};
+            }
+            data += len;
+        }
+        return unicode_traits::convert_result<char>{data,result};
+    }
+
+    const std::vector<std::string> well_formed = {"\xc2\x80", "\xdf\xbf", "\xc3\xa9", "\xe0\xa0\x80", "\xe2\x82\xac",
+        "\xed\x9f\xbf", "\xee\x80\x80", "\xef\xbf\xbf", "\xf0\x90\x80\x80", "\xf0\x9f\x98\x80", "\xf4\x8f\xbf\xbf"};
+
+    const std::vector<std::string> ill_formed = {"\x80", "\xbf", "\xc0\xaf", "\xc1\xbf", "\xe0\x80\xaf", "\xe0\x9f\xbf",
+        "\xed\xa0\x80", "\xed\xbf\xbf", "\xf0\x80\x80\x80", "\xf0\x8f\xbf\xbf", "\xf4\x90\x80\x80", "\xf5\x80\x80\x80",
+        "\xff", "\xfe", "\xc3", "\xe2\x82", "\xf0\x9f\x98", "\xc3\x41", "\xe2\x41\xac", "\xf0\x9f\x41\x80"};
+
+} // namespace
+
+TEST_CASE("jsoncons::detail::skip_ascii tests")
+{
+    SECTION("char")
+    {
+        for (std::size_t len = 0; len <= 100; ++len)
+        {
+            std::string s(len, 'a');
+            CHECK(jsoncons::detail::skip_ascii(s.data(), s.data() + s.size()) == s.data() + s.size());
+            for (std::size_t pos = 0; pos < len; ++pos)
+            {
+                std::string t(s);
+                t[pos] = static_cast<char>(0x80);
+                CHECK(jsoncons::detail::skip_ascii(t.data(), t.data() + t.size()) == t.data() + pos);
+            }
+        }
+    }
+    SECTION("char16_t and char32_t")
+    {
+        for (std::size_t len = 0; len <= 40; ++len)
+        {
+            for (std::size_t pos = 0; pos < len; ++pos)
+            {
+                std::u16string s(len, u'a');
+                s[pos] = 0x100;
+                CHECK(jsoncons::detail::skip_ascii(s.data(), s.data() + s.size()) == s.data() + pos);
+                std::u32string t(len, U'a');
+                t[pos] = 0x10000;
+                CHECK(jsoncons::detail::skip_ascii(t.data(), t.data() + t.size()) == t.data() + pos);
+            }
+        }
+    }
+}
+
+TEST_CASE("jsoncons::detail::skip_non_surrogates tests")
+{
+    for (std::size_t len = 0; len <= 40; ++len)
+    {
+        for (std::size_t pos = 0; pos < len; ++pos)
+        {
+            std::u16string s(len, u'\xe000');
+            s[pos] = 0xdc00;
+            CHECK(jsoncons::detail::skip_non_surrogates(s.data(), s.data() + s.size()) == s.data() + pos);
+            std::u32string t(len, U'\x10ffff');
+            t[pos] = 0x110000;
+            CHECK(jsoncons::detail::skip_non_surrogates(t.data(), t.data() + t.size()) == t.data() + pos);
+            t[pos] = 0xd800;
+            CHECK(jsoncons::detail::skip_non_surrogates(t.data(), t.data() + t.size()) == t.data() + pos);
+        }
+    }
+}
+
+TEST_CASE("unicode_traits::validate utf8 tests")
+{
+    SECTION("well formed sequences at every offset")
+    {
+        for (const auto& seq : well_formed)
+        {
+            for (std::size_t len = 0; len <= 70; ++len)
+            {
+                std::string s(len, 'a');
+                s.insert(len/2, seq);
+                s.insert(0, seq);
+                s += seq;
+                auto result = unicode_traits::validate(s.data(), s.size());
+                CHECK(result.ec == unicode_traits::conv_errc());
+                CHECK(result.ptr == s.data() + s.size());
+            }
+        }
+    }
+    SECTION("ill formed sequences at every offset")
+    {
+        for (const auto& seq : ill_formed)
+        {
+            for (std::size_t len = 0; len <= 70; ++len)
+            {
+                for (std::size_t pos = 0; pos <= len; ++pos)
+                {
+                    std::string s;
+                    for (std::size_t i = 0; i < len; ++i)
+                    {
+                        s.append(i % 7 == 3 ? well_formed[i % well_formed.size()] : std::string(1, 'a'));
+                    }
+                    s.insert(pos, seq);
+                    auto expected = scalar_validate(s.data(), s.size());
+                    auto result = unicode_traits::validate(s.data(), s.size());
+                    CHECK(result.ec != unicode_traits::conv_errc());
+                    CHECK(result.ec == expected.ec);
+                    CHECK(result.ptr == expected.ptr);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("unicode_traits::convert tests")
+{
+    std::string s;
+    for (std::size_t i = 0; i < 200; ++i)
+    {
+        s.append(i % 11 == 5 ? well_formed[i % well_formed.size()] : std::string(1, static_cast<char>('a' + i % 26)));
+    }
+
+    SECTION("utf8 to utf16 and back")
+    {
+        std::u16string u;
+        auto result = unicode_traits::convert(s.data(), s.size(), u);
+        CHECK(result.ec == unicode_traits::conv_errc());
+        std::string t;
+        auto result2 = unicode_traits::convert(u.data(), u.size(), t);
+        CHECK(result2.ec == unicode_traits::conv_errc());
+        CHECK(t == s);
+    }
+    SECTION("utf8 to utf32 and back")
+    {
+        std::u32string u;
+        auto result = unicode_traits::convert(s.data(), s.size(), u);
+        CHECK(result.ec == unicode_traits::conv_errc());
+        std::deque<char32_t> d;
+        unicode_traits::convert(s.data(), s.size(), d);
+        CHECK(std::u32string(d.begin(), d.end()) == u);
+        std::vector<uint8_t> t;
+        auto result2 = unicode_traits::convert(u.data(), u.size(), t);
+        CHECK(result2.ec == unicode_traits::conv_errc());
+        CHECK(std::string(t.begin(), t.end()) == s);
+    }
+    SECTION("utf8 to utf8")
+    {
+        std::string t = "prefix";
+        auto result = unicode_traits::convert(s.data(), s.size(), t);
+        CHECK(result.ec == unicode_traits::conv_errc());
+        CHECK(t == "prefix" + s);
+    }
+    SECTION("stops at an ill formed sequence")
+    {
+        std::string bad = s.substr(0, 100) + "\xed\xa0\x80" + s.substr(100);
+        std::u16string u;
+        auto result = unicode_traits::convert(bad.data(), bad.size(), u);
+        CHECK(result.ec == unicode_traits::conv_errc::source_illegal);
+        CHECK(result.ptr == bad.data() + 100);
+        std::u16string expected;
+        unicode_traits::convert(s.data(), 100, expected);
+        CHECK(u == expected);
+    }
+}
@@ -6,6 +6,19 @@
 #include <catch/catch.hpp>
 #include <iostream>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <cfloat>
+#include <limits>
+#if defined(__has_include) && __cplusplus >= 201703L
+#if __has_include(<charconv>)
+#include <charconv>
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define JSONCONS_TEST_HAS_TO_CHARS
+#endif
+#endif
+#endif
 
 using namespace jsoncons;
 
@@ -56,7 +69,7 @@ static void check_dtoa(double x, const std::vector<std::string>& expected)
     check_safe_dtoa(x,expected);
 }
 
-TEST_CASE("test grisu3")
+TEST_CASE("test dtoa_general")
 {
     check_dtoa(1.0e100, {"1e+100"});
     check_dtoa(1.0e-100, {"1e-100"});
@@ -98,3 +111,135 @@ TEST_CASE("test grisu3")
     check_dtoa(0.000071, {"7.1e-05"}); 
 }
 
+static std::string shortest_general(double x)
+{
+    std::string s;
+    REQUIRE(jsoncons::detail::dtoa_general(x, '.', s));
+    return s;
+}
+
+static std::string shortest_scientific(double x)
+{
+    std::string s;
+    REQUIRE(jsoncons::detail::dtoa_scientific(x, '.', s));
+    return s;
+}
+
+// Checks that the scientific digits have no more significant digits than std::to_chars,
+// which produces the shortest representation that round trips
+static void check_shortest(double x)
+{
+#if defined(JSONCONS_TEST_HAS_TO_CHARS)
+    if (x == 0)
+    {
+        return;
+    }
+    char buffer[64];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), x, std::chars_format::scientific);
+    std::string expected(buffer, result.ptr);
+    std::string s = shortest_scientific(x);
+    auto digits = [](const std::string& t) -> std::size_t
+    {
+        std::size_t n = 0;
+        for (std::size_t i = 0; i < t.size() && t[i] != 'e'; ++i)
+        {
+            n += (t[i] >= '0' && t[i] <= '9') ? 1 : 0;
+        }
+        return n;
+    };
+    INFO(expected);
+    INFO(s);
+    CHECK(digits(s) == digits(expected));
+#else
+    (void)x;
+#endif
+}
+
+TEST_CASE("test ryu")
+{
+    SECTION("extremes")
+    {
+        CHECK(shortest_general(5e-324) == "5e-324");
+        CHECK(shortest_general(2.2250738585072014e-308) == "2.2250738585072014e-308");
+        CHECK(shortest_general(1.7976931348623157e308) == "1.7976931348623157e+308");
+        CHECK(shortest_general(-1.7976931348623157e308) == "-1.7976931348623157e+308");
+        CHECK(shortest_general(9007199254740992.0) == "9007199254740992.0");
+        CHECK(shortest_general(1e23) == "1e+23");
+        CHECK(shortest_general(5e-7) == "5e-07");
+    }
+
+    SECTION("shortest digits")
+    {
+        // values where the closest 17 digit representation is not the shortest
+        CHECK(shortest_general(0.3) == "0.3");
+        CHECK(shortest_general(2.0e-3) == "0.002");
+        CHECK(shortest_general(1.2345678901234568e-300) == "1.2345678901234568e-300");
+        CHECK(shortest_general(123456789012345680.0) == "1.2345678901234568e+17");
+    }
+
+    SECTION("scientific")
+    {
+        CHECK(shortest_scientific(0) == "0.0");
+        CHECK(shortest_scientific(1) == "1e+00");
+        CHECK(shortest_scientific(1.5) == "1.5e+00");
+        CHECK(shortest_scientific(-123.456) == "-1.23456e+02");
+        CHECK(shortest_scientific(5e-324) == "5e-324");
+    }
+
+    SECTION("round trip")
+    {
+        std::mt19937_64 gen(1);
+        std::uniform_int_distribution<uint64_t> exponent(0, 0x7fe); // every finite exponent
+        for (int i = 0; i < 100000; ++i)
+        {
+            uint64_t bits = (gen() & 0x800fffffffffffffULL) | (exponent(gen) << 52);
+            double x;
+            std::memcpy(&x, &bits, sizeof(double));
+
+            std::string s = shortest_general(x);
+            INFO(s);
+            CHECK(std::strtod(s.c_str(), nullptr) == x);
+            check_shortest(x);
+        }
+    }
+
+    SECTION("edge cases")
+    {
+        std::vector<double> values = {std::numeric_limits<double>::denorm_min(), 2*std::numeric_limits<double>::denorm_min(),
+            2.2250738585072009e-308, // largest subnormal
+            DBL_MIN, DBL_MAX, -DBL_MAX, DBL_EPSILON, 1 + DBL_EPSILON, 9007199254740993.0};
+        for (int e = -307; e <= 308; ++e)
+        {
+            values.push_back(std::strtod(("1e" + std::to_string(e)).c_str(), nullptr));
+        }
+        for (double x : values)
+        {
+            std::string s = shortest_general(x);
+            INFO(s);
+            CHECK(std::strtod(s.c_str(), nullptr) == x);
+            std::string t = shortest_scientific(x);
+            INFO(t);
+            CHECK(std::strtod(t.c_str(), nullptr) == x);
+            check_shortest(x);
+        }
+        CHECK(shortest_general(1e22) == "1e+22");
+        CHECK(shortest_general(1e-5) == "1e-05");
+        CHECK(shortest_general(DBL_MIN) == "2.2250738585072014e-308");
+        CHECK(shortest_general(2.2250738585072009e-308) == "2.225073858507201e-308");
+        CHECK(shortest_scientific(DBL_MAX) == "1.7976931348623157e+308");
+    }
+
+    SECTION("write_double scientific with default precision")
+    {
+        // Default precision writes the shortest digits, not a fixed number of them
+        std::string s;
+        jsoncons::detail::write_double(float_chars_format::scientific, 0)(1.5, s);
+        CHECK(s == "1.5e+00");
+        s.clear();
+        jsoncons::detail::write_double(float_chars_format::scientific, 0)(0.1, s);
+        CHECK(s == "1e-01");
+        s.clear();
+        jsoncons::detail::write_double(float_chars_format::scientific, 3)(1.5, s);
+        CHECK(s == "1.500e+00");
+    }
+}
@@ -0,0 +1,130 @@
+// Copyright 2022 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <utility>
+
+using namespace jsoncons;
+
+TEST_CASE("borrowed string tests")
+{
+    std::string s = "A string long enough not to fit in short string storage";
+
+    SECTION("construct")
+    {
+        json j(borrowed_string_arg, s);
+        CHECK(j.storage_kind() == json_storage_kind::borrowed_string_value);
+        CHECK(j.is_string());
+        CHECK(j.type() == json_type::string_value);
+        CHECK(j.as_string_view().data() == s.data());
+        CHECK(j.as_string_view().size() == s.size());
+        CHECK(j.as<std::string>() == s);
+        CHECK_FALSE(j.empty());
+        CHECK_THROWS(j.as_cstring());
+        CHECK_THROWS(j.as<const char*>());
+    }
+    SECTION("short strings are copied")
+    {
+        std::string t = "short";
+        json j(borrowed_string_arg, t);
+        CHECK(j.storage_kind() == json_storage_kind::short_string_value);
+        CHECK(j.as<std::string>() == t);
+    }
+    SECTION("copy and move")
+    {
+        json j(borrowed_string_arg, s);
+
+        json j2(j);
+        CHECK(j2.storage_kind() == json_storage_kind::borrowed_string_value);
+        CHECK(j2.as_string_view().data() == s.data());
+
+        json j3(std::move(j2));
+        CHECK(j3.storage_kind() == json_storage_kind::borrowed_string_value);
+
+        json j4;
+        j4 = j3;
+        CHECK(j4.storage_kind() == json_storage_kind::borrowed_string_value);
+        CHECK(j4 == j);
+    }
+    SECTION("swap")
+    {
+        json j1(borrowed_string_arg, s);
+        json j2(json_array_arg, {1,2});
+        j1.swap(j2);
+        CHECK(j1.is_array());
+        CHECK(j2.storage_kind() == json_storage_kind::borrowed_string_value);
+        CHECK(j2.as_string_view() == s);
+    }
+    SECTION("compare with owned strings")
+    {
+        json j1(borrowed_string_arg, s);
+        json j2(s);
+        CHECK(j2.storage_kind() == json_storage_kind::long_string_value);
+        CHECK(j1 == j2);
+        CHECK(j2 == j1);
+        CHECK(j1 < json(s + "!"));
+        CHECK(json(s + "!") > j1);
+        CHECK(j1 != json("short"));
+    }
+    SECTION("numbers")
+    {
+        std::string n = "123456789012345678.5000000000";
+        json j(borrowed_string_arg, jsoncons::string_view(n.data(), 18), semantic_tag::bigint);
+        CHECK(j.is_number());
+        CHECK(j.as<double>() == 123456789012345678.0);
+        CHECK(j.as<int64_t>() == 123456789012345678);
+
+        // More than 19 significant digits, followed by digits that are not part of the value
+        std::string m = "1234567890123456789012e-2" "345";
+        json j2(borrowed_string_arg, jsoncons::string_view(m.data(), m.size() - 3));
+        CHECK(j2.as<double>() == 12345678901234567890.12);
+    }
+}
+
+TEST_CASE("json::parse with borrowed_string_arg")
+{
+    std::string input = R"(
+{
+    "short" : "abc",
+    "long" : "A string long enough not to fit in short string storage",
+    "escaped" : "A string long enough to be borrowed, but with an \"escape\"",
+    "array" : ["Another string long enough not to fit in short string storage", 10]
+}
+    )";
+
+    json j = json::parse(borrowed_string_arg, input);
+
+    auto in_input = [&](const json& val) -> bool
+    {
+        auto sv = val.as_string_view();
+        return sv.data() >= input.data() && sv.data() + sv.size() <= input.data() + input.size();
+    };
+
+    CHECK(j.at("short").storage_kind() == json_storage_kind::short_string_value);
+    CHECK(j.at("long").storage_kind() == json_storage_kind::borrowed_string_value);
+    CHECK(in_input(j.at("long")));
+    CHECK(j.at("escaped").storage_kind() == json_storage_kind::long_string_value);
+    CHECK(j.at("escaped").as<std::string>() == "A string long enough to be borrowed, but with an \"escape\"");
+    CHECK(j.at("array")[0].storage_kind() == json_storage_kind::borrowed_string_value);
+    CHECK(in_input(j.at("array")[0]));
+
+    json expected = json::parse(input);
+    CHECK(j == expected);
+
+    std::string s1;
+    j.dump(s1);
+    std::string s2;
+    expected.dump(s2);
+    CHECK(s1 == s2);
+
+    SECTION("root string")
+    {
+        std::string root = "\"A string long enough not to fit in short string storage\"";
+        json r = json::parse(borrowed_string_arg, root);
+        CHECK(r.storage_kind() == json_storage_kind::borrowed_string_value);
+        CHECK(r.as_string_view().data() == root.data() + 1);
+        CHECK_THROWS(r.as<const char*>());
+    }
+}
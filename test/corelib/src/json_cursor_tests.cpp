@@ -674,3 +674,197 @@ TEMPLATE_TEST_CASE("json_cursor reset test", "",
         CHECK(cursor.done());
     }
 }
+
+namespace {
+
+    std::string event_name(const staj_event& event)
+    {
+        std::ostringstream os;
+        os << event.event_type();
+        if (event.event_type() == staj_event_type::key || event.event_type() == staj_event_type::string_value)
+        {
+            os << " " << event.get<std::string>();
+        }
+        return os.str();
+    }
+
+    // The events read from a cursor, skipping the values of members with the given name
+    std::vector<std::string> read_skipping(staj_cursor& cursor, const std::string& name)
+    {
+        std::vector<std::string> events;
+        bool skip_next = false;
+        for (; !cursor.done(); cursor.next())
+        {
+            events.push_back(event_name(cursor.current()));
+            if (skip_next)
+            {
+                staj_event_type type = cursor.current().event_type();
+                cursor.skip();
+                if (type == staj_event_type::begin_object || type == staj_event_type::begin_array)
+                {
+                    events.push_back(event_name(cursor.current()));
+                }
+                skip_next = false;
+            }
+            else if (cursor.current().event_type() == staj_event_type::key)
+            {
+                skip_next = cursor.current().get<std::string>() == name;
+            }
+        }
+        return events;
+    }
+
+} // namespace
+
+TEST_CASE("json_cursor skip test")
+{
+    std::string data = R"(
+{
+    "a": {"b": [1, {"c": "}]"}], "d": "\"{["},
+    "skip": [[1, 2, {"x": "\\"}], {}, [], "]]", /* ]} */ "\\\""],
+    "e": "f", // }
+    "skip": {"g": {"h": [true, null, 1.5]}},
+    "skip": 10,
+    "i": []
+}
+    )";
+
+    std::vector<std::string> expected = {
+        "begin_object",
+        "key a", "begin_object", "key b", "begin_array", "uint64_value", "begin_object", "key c", "string_value }]", "end_object", "end_array",
+        "key d", "string_value \"{[", "end_object",
+        "key skip", "begin_array", "end_array",
+        "key e", "string_value f",
+        "key skip", "begin_object", "end_object",
+        "key skip", "uint64_value",
+        "key i", "begin_array", "end_array",
+        "end_object"
+    };
+
+    SECTION("string source")
+    {
+        json_string_cursor cursor(data);
+        CHECK(read_skipping(cursor, "skip") == expected);
+
+        json_string_cursor cursor2(data);
+        std::size_t count = 0;
+        for (; !cursor2.done(); cursor2.next())
+        {
+            if (cursor2.current().event_type() == staj_event_type::key && cursor2.current().get<std::string>() == "skip")
+            {
+                cursor2.next();
+                cursor2.skip();
+                ++count;
+                if (count == 2)
+                {
+                    CHECK(cursor2.context().line() == 6);
+                }
+            }
+        }
+        CHECK(count == 3);
+    }
+
+    SECTION("matches event after skipping")
+    {
+        std::string text = R"({"a":[1,[2,3]],"b":{"c":{}},"d":"x"})";
+        json_string_cursor cursor(text);
+        cursor.next(); // key a
+        cursor.next(); // begin_array
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_array);
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::key);
+        CHECK(cursor.current().get<std::string>() == "b");
+        cursor.next();
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.next();
+        CHECK(cursor.current().get<std::string>() == "d");
+        cursor.next();
+        cursor.skip(); // not a container
+        CHECK(cursor.current().event_type() == staj_event_type::string_value);
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("filter view")
+    {
+        std::string text = R"({"a":[1,[2,3]],"b":{"c":{}},"d":"x"})";
+        auto no_end_events = [](const staj_event& event, const ser_context&) -> bool
+        {
+            return event.event_type() != staj_event_type::end_array && event.event_type() != staj_event_type::end_object;
+        };
+
+        json_string_cursor cursor(text);
+        auto view = cursor | no_end_events;
+        view.next(); // key a
+        view.next(); // begin_array
+        REQUIRE(view.current().event_type() == staj_event_type::begin_array);
+        view.skip();
+        REQUIRE(view.current().event_type() == staj_event_type::key);
+        CHECK(view.current().get<std::string>() == "b");
+        view.next();
+        REQUIRE(view.current().event_type() == staj_event_type::begin_object);
+        std::error_code ec;
+        view.skip(ec);
+        CHECK_FALSE(ec);
+        REQUIRE(view.current().event_type() == staj_event_type::key);
+        CHECK(view.current().get<std::string>() == "d");
+        view.next();
+        view.next();
+        CHECK(view.done());
+    }
+
+    SECTION("whole document")
+    {
+        json_string_cursor cursor(data);
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("stream source with small buffer")
+    {
+        for (std::size_t buf_size = 1; buf_size <= 16; ++buf_size)
+        {
+            std::istringstream is(data);
+            json_stream_cursor cursor(stream_source<char>(is, buf_size));
+            INFO(buf_size);
+            CHECK(read_skipping(cursor, "skip") == expected);
+
+            std::istringstream is3(data);
+            json_stream_cursor cursor3(stream_source<char>(is3, buf_size));
+            for (; !cursor3.done(); cursor3.next())
+            {
+                if (cursor3.current().event_type() == staj_event_type::key && cursor3.current().get<std::string>() == "e")
+                {
+                    break;
+                }
+            }
+            CHECK(cursor3.context().line() == 5);
+        }
+    }
+
+    SECTION("errors")
+    {
+        std::string text = R"({"a":[1,{"b":"]"})";
+        json_string_cursor cursor(text);
+        cursor.next();
+        cursor.next();
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == json_errc::unexpected_eof);
+
+        std::string text2 = R"({"a":[1,{"b":[2]}},"c":1})";
+        json_string_cursor cursor2(text2);
+        cursor2.next();
+        cursor2.next();
+        CHECK_THROWS_AS(cursor2.skip(), ser_error);
+    }
+}
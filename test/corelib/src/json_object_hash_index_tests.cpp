@@ -0,0 +1,311 @@
+// Copyright 2022 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::string make_key(std::size_t i)
+    {
+        return "key" + std::to_string(i);
+    }
+
+    // Checks that every member is found at its own position and that
+    // names not in the object are not found
+    template <class Json>
+    void check_lookup(const Json& j)
+    {
+        std::size_t n = 0;
+        for (const auto& member : j.object_range())
+        {
+            auto it = j.find(member.key());
+            REQUIRE(bool(it != j.object_range().end()));
+            CHECK(it->key() == member.key());
+            CHECK(it->value() == member.value());
+            ++n;
+        }
+        CHECK(n == j.size());
+        CHECK_FALSE(j.contains("not a key"));
+    }
+
+} // namespace
+
+TEST_CASE("object_hash_index tests")
+{
+    using index_type = detail::object_hash_index<std::allocator<char>>;
+    using member_type = key_value<std::string,json>;
+
+    std::vector<member_type> members;
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        members.emplace_back(make_key(i), json(i));
+    }
+
+    index_type index;
+    CHECK_FALSE(index.active());
+    index.build(members);
+    CHECK(index.active());
+    CHECK(index.size() == 100);
+
+    for (std::size_t i = 0; i < members.size(); ++i)
+    {
+        CHECK(index.find(members, string_view(members[i].key())) == i);
+    }
+    CHECK(index.find(members, string_view("key100")) == index_type::npos);
+
+    SECTION("insert in the middle")
+    {
+        members.emplace(members.begin() + 10, "inserted", json(-1));
+        index.shift(10, 1);
+        index.insert(index_type::hash(string_view("inserted")), 10);
+        for (std::size_t i = 0; i < members.size(); ++i)
+        {
+            CHECK(index.find(members, string_view(members[i].key())) == i);
+        }
+    }
+
+    SECTION("erase")
+    {
+        for (std::size_t i = 20; i < 30; ++i)
+        {
+            index.erase(index_type::hash(string_view(members[i].key())), i);
+        }
+        index.shift(30, -10);
+        members.erase(members.begin() + 20, members.begin() + 30);
+        CHECK(index.size() == 90);
+        for (std::size_t i = 0; i < members.size(); ++i)
+        {
+            CHECK(index.find(members, string_view(members[i].key())) == i);
+        }
+        CHECK(index.find(members, string_view("key25")) == index_type::npos);
+    }
+
+    SECTION("grow")
+    {
+        for (std::size_t i = 100; i < 1000; ++i)
+        {
+            members.emplace_back(make_key(i), json(i));
+            index.insert(index_type::hash(string_view(members.back().key())), i);
+        }
+        for (std::size_t i = 0; i < members.size(); ++i)
+        {
+            CHECK(index.find(members, string_view(members[i].key())) == i);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("large object tests", "", json, ojson)
+{
+    using Json = TestType;
+    const std::size_t n = 1000;
+
+    SECTION("insert_or_assign, find and erase")
+    {
+        Json j;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            j.insert_or_assign(make_key(i), i);
+        }
+        REQUIRE(j.size() == n);
+        check_lookup(j);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            CHECK(j.at(make_key(i)).template as<std::size_t>() == i);
+        }
+
+        // assign existing members
+        for (std::size_t i = 0; i < n; i += 2)
+        {
+            j.insert_or_assign(make_key(i), "even");
+        }
+        CHECK(j.size() == n);
+        CHECK(j.at(make_key(500)).as_string() == "even");
+        CHECK(j.at(make_key(501)).template as<std::size_t>() == 501);
+
+        for (std::size_t i = 0; i < n; i += 3)
+        {
+            j.erase(make_key(i));
+        }
+        CHECK(j.size() == n - (n + 2)/3);
+        CHECK_FALSE(j.contains(make_key(300)));
+        CHECK(j.contains(make_key(301)));
+        check_lookup(j);
+
+        j.erase(j.object_range().begin(), j.object_range().begin() + 100);
+        CHECK(j.size() == n - (n + 2)/3 - 100);
+        check_lookup(j);
+
+        j.clear();
+        CHECK(j.empty());
+        CHECK_FALSE(j.contains(make_key(1)));
+    }
+
+    SECTION("try_emplace")
+    {
+        Json j;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            j.try_emplace(make_key(i), i);
+        }
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            j.try_emplace(make_key(i), "ignored");
+        }
+        CHECK(j.size() == n);
+        CHECK(j.at(make_key(999)).template as<std::size_t>() == 999);
+        check_lookup(j);
+    }
+
+    SECTION("parse, copy, move and swap")
+    {
+        std::string input = "{";
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (i > 0)
+            {
+                input.push_back(',');
+            }
+            input += "\"" + make_key(n - i) + "\":" + std::to_string(i);
+        }
+        input += ",\"" + make_key(n) + "\":-1}";
+
+        Json j = Json::parse(input);
+        CHECK(j.size() == n);
+        check_lookup(j);
+
+        Json copy(j);
+        check_lookup(copy);
+        CHECK(copy == j);
+
+        Json moved(std::move(copy));
+        check_lookup(moved);
+
+        Json other = Json::parse(R"({"a":1})");
+        other.swap(moved);
+        CHECK(other.size() == n);
+        CHECK(moved.size() == 1);
+        check_lookup(other);
+        check_lookup(moved);
+
+        Json assigned;
+        assigned = other;
+        check_lookup(assigned);
+    }
+
+    SECTION("merge and merge_or_update")
+    {
+        Json j1;
+        Json j2;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (i % 2 == 0)
+            {
+                j1.insert_or_assign(make_key(i), i);
+            }
+            else
+            {
+                j2.insert_or_assign(make_key(i), i);
+            }
+        }
+        j2.insert_or_assign(make_key(0), "updated");
+
+        Json merged(j1);
+        merged.merge(j2);
+        CHECK(merged.size() == n);
+        CHECK(merged.at(make_key(0)).template as<std::size_t>() == 0);
+        check_lookup(merged);
+
+        Json updated(j1);
+        updated.merge_or_update(j2);
+        CHECK(updated.size() == n);
+        CHECK(updated.at(make_key(0)).as_string() == "updated");
+        check_lookup(updated);
+
+        Json moved(j1);
+        moved.merge(Json(j2));
+        CHECK(moved.size() == n);
+        check_lookup(moved);
+    }
+}
+
+TEST_CASE("large ojson preserves order")
+{
+    const std::size_t n = 500;
+    std::vector<std::string> keys;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        keys.push_back(make_key((i*7919) % n));
+    }
+
+    ojson j;
+    for (const auto& key : keys)
+    {
+        j.insert_or_assign(key, key);
+    }
+
+    // insert in the middle with a hint
+    auto it = j.insert_or_assign(j.object_range().begin() + 10, "middle", 1);
+    keys.insert(keys.begin() + 10, "middle");
+    CHECK(it->key() == "middle");
+
+    j.erase(keys[20]);
+    keys.erase(keys.begin() + 20);
+
+    REQUIRE(j.size() == keys.size());
+    std::size_t i = 0;
+    for (const auto& member : j.object_range())
+    {
+        CHECK(member.key() == keys[i]);
+        ++i;
+    }
+    check_lookup(j);
+}
+
+TEMPLATE_TEST_CASE("random operations agree with std::map", "", json, ojson)
+{
+    using Json = TestType;
+
+    std::mt19937 gen(12345);
+    std::uniform_int_distribution<int> key_dist(0, 299);
+    std::uniform_int_distribution<int> op_dist(0, 3);
+
+    Json j;
+    std::map<std::string,int> expected;
+    for (int step = 0; step < 5000; ++step)
+    {
+        std::string key = make_key(static_cast<std::size_t>(key_dist(gen)));
+        switch (op_dist(gen))
+        {
+            case 0:
+            case 1:
+                j.insert_or_assign(key, step);
+                expected[key] = step;
+                break;
+            case 2:
+                j.try_emplace(key, step);
+                expected.emplace(key, step);
+                break;
+            default:
+                j.erase(key);
+                expected.erase(key);
+                break;
+        }
+    }
+    REQUIRE(j.size() == expected.size());
+    for (const auto& item : expected)
+    {
+        auto it = j.find(item.first);
+        REQUIRE(bool(it != j.object_range().end()));
+        CHECK(it->value().template as<int>() == item.second);
+    }
+    check_lookup(j);
+}
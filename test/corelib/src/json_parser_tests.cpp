@@ -11,6 +11,8 @@
 #include <utility>
 #include <ctime>
 #include <fstream>
+#include <algorithm>
+#include <limits>
 
 using namespace jsoncons;
 
@@ -338,3 +340,58 @@ TEST_CASE("test_diagnostics_visitor", "")
         CHECK(os.str() == expected.str());
     }
 }
+
+namespace {
+
+    json parse_in_chunks(const std::string& text, std::size_t chunk_size)
+    {
+        json_decoder<json> decoder;
+        json_parser parser;
+
+        std::size_t offset = 0;
+        while (!parser.stopped())
+        {
+            if (parser.source_exhausted() && offset < text.size())
+            {
+                std::size_t n = (std::min)(chunk_size, text.size() - offset);
+                parser.update(text.data() + offset, n);
+                offset += n;
+            }
+            bool eof = parser.source_exhausted();
+            parser.parse_some(decoder);
+            if (eof)
+            {
+                if (parser.enter())
+                {
+                    break;
+                }
+                else if (!parser.accept())
+                {
+                    JSONCONS_THROW(ser_error(json_errc::unexpected_eof, parser.line(), parser.column()));
+                }
+            }
+        }
+        parser.check_done();
+        return decoder.get_result();
+    }
+
+} // namespace
+
+TEST_CASE("json_parser numbers split across buffers")
+{
+    std::string text = "[0,-0,1.5,-12.25e-3,3E+2,\r\n 123456789012345678,1234567890123456789,"
+                       "18446744073709551615,-9223372036854775808,99999999999999999999,\t7 ,{\"a\":-42},[8]]";
+    json expected = json::parse(text);
+    REQUIRE(expected.size() == 13);
+    CHECK(expected[1].as<int64_t>() == 0);
+    CHECK(expected[6].as<uint64_t>() == 1234567890123456789u);
+    CHECK(expected[7].as<uint64_t>() == (std::numeric_limits<uint64_t>::max)());
+    CHECK(expected[8].as<int64_t>() == (std::numeric_limits<int64_t>::lowest)());
+    CHECK(expected[9].is_bignum());
+
+    for (std::size_t chunk_size = 1; chunk_size <= text.size(); ++chunk_size)
+    {
+        INFO(chunk_size);
+        CHECK(parse_in_chunks(text, chunk_size) == expected);
+    }
+}
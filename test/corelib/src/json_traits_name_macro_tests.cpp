@@ -296,12 +296,27 @@ namespace ns {
         std::string surname;
     };
 
+    struct Person2
+    {
+        std::string first_name;
+        int age;
+        std::string family_name;
+    };
+
+    struct Person3
+    {
+        std::string name;
+        int age;
+    };
+
 } // ns
 } // namespace 
 
 JSONCONS_ALL_MEMBER_NAME_TRAITS(ns::book1a,(author,"Author"),(title,"Title"),(price,"Price"))
 JSONCONS_ALL_MEMBER_NAME_TRAITS(ns::book1b,(author,"Author"),(title,"Title"),(price,"Price"))
 JSONCONS_N_MEMBER_NAME_TRAITS(ns::Person1, 1, (name, "n"), (surname, "sn"))
+JSONCONS_N_MEMBER_NAME_TRAITS(ns::Person2, 2, (first_name, "na-e"), (age, "age", JSONCONS_RDWR, [](int x){return x >= 0;}), (family_name, "nx-e"))
+JSONCONS_N_MEMBER_NAME_TRAITS(ns::Person3, 1, (name, "n"), (age, "age", JSONCONS_RDWR, [](int x){return x >= 0;}))
 JSONCONS_ALL_CTOR_GETTER_NAME_TRAITS(ns::book2a, (author,"Author"),(title,"Title"),(price,"Price"))
 JSONCONS_N_CTOR_GETTER_NAME_TRAITS(ns::book2b, 2, (author,"Author"),(title,"Title"),(price,"Price"), (isbn, "Isbn"), (publisher, "Publisher"))
 JSONCONS_ALL_GETTER_SETTER_NAME_TRAITS(ns::book3a, (get_author,set_author,"Author"),(get_title,set_title,"Title"),(get_price,set_price,"Price"))
@@ -396,6 +411,33 @@ TEST_CASE("JSONCONS_N_MEMBER_NAME_TRAITS tests")
     }
 }
 
+TEST_CASE("JSONCONS_N_MEMBER_NAME_TRAITS names that hash alike")
+{
+    SECTION("as")
+    {
+        ojson j = ojson::parse(R"({"nb-e":"x","nx-e":"Smith","age":30,"na-e":"John"})");
+        REQUIRE(j.is<ns::Person2>());
+        auto person = j.as<ns::Person2>();
+        CHECK(person.first_name == "John");
+        CHECK(person.family_name == "Smith");
+        CHECK(person.age == 30);
+    }
+    SECTION("missing or unmatched members")
+    {
+        CHECK_FALSE(ojson::parse(R"({"na-e":"John","nx-e":"Smith"})").is<ns::Person2>());
+        CHECK(ojson::parse(R"({"na-e":"John","age":30})").is<ns::Person2>());
+        CHECK_FALSE(ojson::parse(R"({"na-e":"John","nx-e":"Smith","age":-1})").is<ns::Person2>());
+        CHECK_THROWS_AS(json::parse(R"({"nx-e":"Smith","age":30})").as<ns::Person2>(), conv_error);
+    }
+    SECTION("unmatched optional member")
+    {
+        CHECK(json::parse(R"({"n":"John"})").is<ns::Person3>());
+        CHECK(json::parse(R"({"n":"John","age":30})").is<ns::Person3>());
+        CHECK_FALSE(json::parse(R"({"n":"John","age":-1})").is<ns::Person3>());
+        CHECK_THROWS_AS(json::parse(R"({"n":"John","age":-1})").as<ns::Person3>(), conv_error);
+    }
+}
+
 TEST_CASE("JSONCONS_ALL_TPL_MEMBER_NAME_TRAITS tests 1")
 {
     SECTION("TemplatedStruct1<std::pair<int,int>>")
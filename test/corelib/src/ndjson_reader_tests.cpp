@@ -0,0 +1,168 @@
+// Copyright 2022 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/ndjson_reader.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::string make_input(std::size_t count)
+    {
+        std::string input;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            input += R"({"id":)" + std::to_string(i) + R"(,"name":"record )" + std::to_string(i) + "\"}\n";
+        }
+        return input;
+    }
+
+    class id_collector : public default_json_visitor
+    {
+    public:
+        std::vector<uint64_t> ids;
+    private:
+        bool visit_uint64(uint64_t value, semantic_tag, const ser_context&, std::error_code&) override
+        {
+            ids.push_back(value);
+            return true;
+        }
+    };
+
+} // namespace
+
+TEST_CASE("ndjson_reader delivers records in order")
+{
+    const std::size_t count = 5000;
+    std::string input = make_input(count);
+
+    auto options = ndjson_options{}
+        .num_threads(4)
+        .chunk_size(100)
+        .max_in_flight_bytes(2000);
+    ndjson_reader<json> reader(options);
+
+    SECTION("string")
+    {
+        std::size_t expected = 0;
+        std::size_t n = reader.read(input, [&](ndjson_record<json>& record) -> bool
+        {
+            CHECK_FALSE(record.ec);
+            CHECK(record.line == expected + 1);
+            CHECK(record.value["id"].as<std::size_t>() == expected);
+            ++expected;
+            return true;
+        });
+        CHECK(n == count);
+        CHECK(expected == count);
+    }
+
+    SECTION("stream")
+    {
+        std::istringstream is(input);
+        std::size_t expected = 0;
+        std::size_t n = reader.read(is, [&](ndjson_record<json>& record) -> bool
+        {
+            CHECK(record.line == expected + 1);
+            CHECK(record.value["name"].as<std::string>() == "record " + std::to_string(expected));
+            ++expected;
+            return true;
+        });
+        CHECK(n == count);
+    }
+
+    SECTION("stop early")
+    {
+        std::size_t n = reader.read(input, [&](ndjson_record<json>& record) -> bool
+        {
+            return record.line < 10;
+        });
+        CHECK(n == 10);
+    }
+
+    SECTION("visitor")
+    {
+        id_collector visitor;
+        reader.read(input, visitor);
+        REQUIRE(visitor.ids.size() == count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            CHECK(visitor.ids[i] == i);
+        }
+    }
+}
+
+TEST_CASE("ndjson_reader errors and blank lines")
+{
+    std::string input = "[1,2]\n\n{\"a\":\n  \r\n\"abc\"\r\n{\"b\":true} x\n42";
+
+    for (std::size_t chunk_size : {1, 4, 1000})
+    {
+        ndjson_reader<ojson> reader(ndjson_options{}.num_threads(2).chunk_size(chunk_size));
+
+        std::vector<ndjson_record<ojson>> records;
+        reader.read(input, [&](ndjson_record<ojson>& record) -> bool
+        {
+            records.push_back(std::move(record));
+            return true;
+        });
+
+        REQUIRE(records.size() == 5);
+        CHECK(records[0].line == 1);
+        CHECK(records[0].value == ojson::parse("[1,2]"));
+        CHECK(records[1].line == 3);
+        CHECK(records[1].ec == json_errc::unexpected_eof);
+        CHECK(records[1].value.is_null());
+        CHECK(records[2].line == 5);
+        CHECK(records[2].value.as<std::string>() == "abc");
+        CHECK(records[3].line == 6);
+        CHECK(records[3].ec == json_errc::extra_character);
+        CHECK(records[3].column == 11);
+        CHECK(records[4].line == 7);
+        CHECK(records[4].value.as<int>() == 42);
+
+        std::istringstream is(input);
+        std::size_t n = reader.read(is, [&](ndjson_record<ojson>& record) -> bool
+        {
+            return !record.ec;
+        });
+        CHECK(n == 2);
+    }
+
+    SECTION("visitor stops at the first error")
+    {
+        ndjson_reader<json> reader;
+        id_collector visitor;
+        std::error_code ec;
+        reader.read(input, visitor, ec);
+        CHECK(ec == json_errc::unexpected_eof);
+        CHECK(visitor.ids.size() == 2);
+
+        CHECK_THROWS_AS(reader.read(input, visitor), ser_error);
+    }
+}
+
+TEST_CASE("ndjson_reader long lines")
+{
+    std::string long_string(10000, 'x');
+    std::string input = "\"" + long_string + "\"\n[\"" + long_string + "\"]\n";
+
+    ndjson_reader<json> reader(ndjson_options{}.num_threads(3).chunk_size(64).max_in_flight_bytes(0));
+
+    std::istringstream is(input);
+    std::vector<json> values;
+    reader.read(is, [&](ndjson_record<json>& record) -> bool
+    {
+        CHECK_FALSE(record.ec);
+        values.push_back(std::move(record.value));
+        return true;
+    });
+    REQUIRE(values.size() == 2);
+    CHECK(values[0].as<std::string>() == long_string);
+    CHECK(values[1][0].as<std::string>() == long_string);
+}
@@ -9,6 +9,9 @@
 #include <utility>
 #include <ctime>
 #include <cwchar>
+#include <cmath>
+#include <cstring>
+#include <random>
 #include <catch/catch.hpp>
 
 using namespace jsoncons;
@@ -53,3 +56,117 @@ TEST_CASE("test_exponent")
 
 }
 
+
+TEST_CASE("chars_to hard cases")
+{
+    jsoncons::detail::chars_to to_double;
+
+    auto check = [&](const std::string& s)
+    {
+        char* end = nullptr;
+        double expected = strtod(s.c_str(), &end);
+        double actual = to_double(s.c_str(), s.length());
+        CHECK(std::memcmp(&actual, &expected, sizeof(double)) == 0);
+    };
+
+    SECTION("round to even")
+    {
+        check("9007199254740993");
+        check("9007199254740992.5");
+        check("9007199254740995");
+        check("1e23");
+        check("8.988465674311579e307");
+        check("7.2057594037927933e16");
+    }
+
+    SECTION("limits")
+    {
+        check("4.9406564584124654e-324");
+        check("2.4703282292062327e-324");
+        check("2.4703282292062328e-324");
+        check("2.2250738585072011e-308");
+        check("2.2250738585072014e-308");
+        check("1.7976931348623157e308");
+        check("1.7976931348623158e308");
+        check("1e-400");
+        check("1e400");
+        check("-1e400");
+    }
+
+    SECTION("zeros")
+    {
+        double d = to_double("-0.0", 4);
+        CHECK(d == 0.0);
+        CHECK(std::signbit(d));
+        check("0e999999");
+        check("0.000000000000000000000000000000000000000000000000000000000001");
+    }
+
+    SECTION("more than 19 digits")
+    {
+        check("1.00000000000000011102230246251565404236316680908203125");
+        check("123456789012345678901234567890");
+        check("0.1000000000000000055511151231257827021181583404541015625");
+    }
+
+    SECTION("prefix")
+    {
+        CHECK(to_double("1.5e3,", 6) == 1500.0);
+        CHECK(to_double("2e", 2) == 2.0);
+        CHECK(to_double("1.25\0garbage", 12) == 1.25);
+    }
+
+    SECTION("hexadecimal")
+    {
+        CHECK(to_double("0x3p-1", 6) == 1.5);
+        CHECK(to_double("-0x3p-1", 7) == -1.5);
+    }
+
+    SECTION("wide characters")
+    {
+        CHECK(to_double(L"-12.5e-1", 8) == -1.25);
+    }
+
+    SECTION("not a number")
+    {
+        CHECK_THROWS(to_double("abc", 3));
+    }
+}
+
+TEST_CASE("chars_to random round trip")
+{
+    jsoncons::detail::chars_to to_double;
+
+    std::mt19937_64 gen(20211);
+    char buffer[64];
+    for (int i = 0; i < 100000; ++i)
+    {
+        uint64_t bits = gen();
+        double x;
+        std::memcpy(&x, &bits, sizeof(double));
+        if (!std::isfinite(x))
+        {
+            continue;
+        }
+        int precision = 1 + static_cast<int>(gen() % 17);
+        int length = snprintf(buffer, sizeof(buffer), "%.*g", precision, x);
+        char* end = nullptr;
+        double expected = strtod(buffer, &end);
+        double actual = to_double(buffer, static_cast<std::size_t>(length));
+        CHECK(std::memcmp(&actual, &expected, sizeof(double)) == 0);
+    }
+}
+
+TEST_CASE("parsers use chars_to")
+{
+    json j = json::parse("[0.1, 2.5e-3, 9007199254740993.0, 1e23]");
+    CHECK(j[0].as<double>() == 0.1);
+    CHECK(j[1].as<double>() == 2.5e-3);
+    CHECK(j[2].as<double>() == 9007199254740992.0);
+    CHECK(j[3].as<double>() == 1e23);
+
+    json_options options;
+    options.lossless_number(true);
+    json k = json::parse("3.14159", options);
+    CHECK(k.as<std::string>() == "3.14159");
+}
@@ -75,3 +75,128 @@ TEST_CASE("jmespath_expression tests")
     }    
 }
 
+
+TEST_CASE("jmespath_expression evaluate_view tests")
+{
+    json doc = json::parse(R"(
+        {
+          "people": [
+            {"age": 20, "name": "Bob", "address": {"city": "Toronto"}},
+            {"age": 25, "name": "Fred", "address": {"city": "Montreal"}},
+            {"age": 30, "name": "George", "address": {"city": "Ottawa"}}
+          ]
+        }
+    )");
+
+    SECTION("selection refers to the document")
+    {
+        auto expr = jmespath::make_expression<json>("people[1].address");
+        auto result = expr.evaluate_view(doc);
+        CHECK(&result.value() == &doc.at("people").at(1).at("address"));
+        CHECK(result->at("city").as<std::string>() == "Montreal");
+    }
+
+    SECTION("projection")
+    {
+        auto expr = jmespath::make_expression<json>("people[*].address");
+        auto result = expr.evaluate_view(doc);
+        REQUIRE(result->is_array());
+        REQUIRE(result->size() == 3);
+        CHECK((*result)[2]["city"].as<std::string>() == "Ottawa");
+        CHECK(*result == expr.evaluate(doc));
+
+        json copy = result.materialize();
+        CHECK(copy == *result);
+        doc["people"][2]["address"]["city"] = "Kingston";
+        CHECK(copy[2]["city"].as<std::string>() == "Ottawa");
+        CHECK((*result)[2]["city"].as<std::string>() == "Kingston");
+    }
+
+    SECTION("function result is owned by the result")
+    {
+        auto expr = jmespath::make_expression<json>("sort_by(people, &age)[].{n: name, a: age}");
+        json expected = expr.evaluate(doc);
+
+        auto result = expr.evaluate_view(doc);
+        auto moved = std::move(result);
+        CHECK(*moved == expected);
+        CHECK(moved.materialize() == expected);
+
+        auto sum = jmespath::make_expression<json>("sum(people[].age)").evaluate_view(doc);
+        CHECK(*sum == json(75.0));
+    }
+
+    SECTION("error")
+    {
+        auto expr = jmespath::make_expression<json>("abs(people)");
+        std::error_code ec;
+        auto result = expr.evaluate_view(doc, ec);
+        CHECK(ec);
+        CHECK(result->is_null());
+        CHECK_THROWS_AS(expr.evaluate_view(doc), jmespath::jmespath_error);
+    }
+}
+
+TEST_CASE("jmespath evaluation_context tests")
+{
+    json doc = json::parse(R"(
+        {
+          "people": [
+            {"age": 20, "name": "Bob"},
+            {"age": 25, "name": "Fred"},
+            {"age": 30, "name": "George"}
+          ]
+        }
+    )");
+
+    SECTION("reuse across expressions and documents")
+    {
+        auto expr1 = jmespath::make_expression<json>("people[?age > `20`].{n: name, a: age}");
+        auto expr2 = jmespath::make_expression<json>("sum(people[].age)");
+
+        jmespath::evaluation_context<json> context;
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(expr1.evaluate(context, doc) == expr1.evaluate(doc));
+            CHECK(expr2.evaluate(context, doc) == json(75.0));
+        }
+        CHECK(context.temp_count() > 0);
+
+        json other = json::parse(R"({"people":[{"age": 40, "name": "Mary"}]})");
+        CHECK(expr1.evaluate(context, other) == json::parse(R"([{"n":"Mary","a":40}])"));
+        CHECK(expr2.evaluate(context, other) == json(40.0));
+    }
+
+    SECTION("storage is reused")
+    {
+        auto expr = jmespath::make_expression<json>("people[*].[name, age]");
+
+        jmespath::evaluation_context<json> context;
+        json expected = expr.evaluate(context, doc);
+        std::size_t temp_count = context.temp_count();
+        std::size_t allocation_count = context.allocation_count();
+        CHECK(temp_count > 0);
+        CHECK(allocation_count > 0);
+
+        for (int i = 0; i < 10; ++i)
+        {
+            CHECK(expr.evaluate(context, doc) == expected);
+        }
+        CHECK(context.temp_count() == temp_count);
+        CHECK(context.allocation_count() == allocation_count);
+
+        context.reset();
+        CHECK(context.temp_count() == 0);
+        CHECK(context.allocation_count() == allocation_count);
+    }
+
+    SECTION("error")
+    {
+        auto expr = jmespath::make_expression<json>("abs(people)");
+        jmespath::evaluation_context<json> context;
+        std::error_code ec;
+        json result = expr.evaluate(context, doc, ec);
+        CHECK(ec);
+        CHECK_THROWS_AS(expr.evaluate(context, doc), jmespath::jmespath_error);
+    }
+}
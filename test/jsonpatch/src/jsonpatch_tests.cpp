@@ -12,6 +12,7 @@
 #include <utility>
 #include <ctime>
 #include <new>
+#include <limits>
 #include <jsoncons/json.hpp>
 #include <jsoncons_ext/jsonpatch/jsonpatch.hpp>
 
@@ -194,3 +195,357 @@ TEST_CASE("jsonpatch - remove two items from array")
 
 
 
+
+TEST_CASE("jsonpatch from_diff with lcs array diff")
+{
+    jsonpatch::diff_options options;
+    options.array_diff(jsonpatch::array_diff_kind::lcs);
+
+    auto check_diff = [&](json source, const json& target) -> json
+    {
+        json patch = jsonpatch::from_diff(source, target, options);
+        check_patch(source, patch, std::error_code(), target);
+        return patch;
+    };
+
+    SECTION("insert at front")
+    {
+        json source(jsoncons::json_array_arg);
+        for (int i = 0; i < 1000; ++i)
+        {
+            source.push_back(i);
+        }
+        json target = source;
+        target.insert(target.array_range().begin(), -1);
+
+        json patch = check_diff(source, target);
+        CHECK(patch == json::parse(R"([{"op":"add","path":"/0","value":-1}])"));
+        CHECK(jsonpatch::from_diff(source, target).size() == 1001);
+    }
+
+    SECTION("insertions and removals")
+    {
+        json source = json::parse(R"(["a","b","c","d","e","f","g"])");
+        json target = json::parse(R"(["b","c","x","e","f","y","g","z"])");
+        json patch = check_diff(source, target);
+        CHECK(patch.size() == 4);
+    }
+
+    SECTION("changed element is diffed in place")
+    {
+        json source = json::parse(R"({"items":[{"a":1,"b":2},{"a":3,"b":4},{"a":5,"b":6}]})");
+        json target = json::parse(R"({"items":[{"a":0},{"a":1,"b":2},{"a":3,"b":5},{"a":5,"b":6}]})");
+        json patch = check_diff(source, target);
+        CHECK(patch == json::parse(R"([{"op":"add","path":"/items/0","value":{"a":0}},{"op":"replace","path":"/items/2/b","value":5}])"));
+    }
+
+    SECTION("edit distance budget exceeded")
+    {
+        options.max_edit_distance(2);
+        json source = json::parse(R"([0,1,2,3,4,5,6,7,8,9])");
+        json target = json::parse(R"([0,10,11,12,13,14,6,7,8,9])");
+        check_diff(source, target);
+
+        json source2 = json::parse(R"([0,1,2,3,4,5,6,7,8,9])");
+        json target2 = json::parse(R"([0,6,7,8,9])");
+        check_diff(source2, target2);
+    }
+
+    SECTION("random edits")
+    {
+        std::srand(42);
+        for (int n = 0; n < 200; ++n)
+        {
+            json source(jsoncons::json_array_arg);
+            json target(jsoncons::json_array_arg);
+            for (int i = 0; i < 30; ++i)
+            {
+                source.push_back(std::rand() % 6);
+                target.push_back(std::rand() % 6);
+            }
+            options.max_edit_distance(static_cast<std::size_t>(std::rand() % 40));
+            check_diff(source, target);
+        }
+    }
+}
+
+TEST_CASE("jsonpatch from_diff with identity key")
+{
+    jsonpatch::diff_options options;
+    options.identity_key("id");
+
+    auto check_diff = [&](json source, const json& target) -> json
+    {
+        json patch = jsonpatch::from_diff(source, target, options);
+        check_patch(source, patch, std::error_code(), target);
+        return patch;
+    };
+
+    SECTION("moved element")
+    {
+        json source = json::parse(R"([{"id":1,"v":"a"},{"id":2,"v":"b"},{"id":3,"v":"c"}])");
+        json target = json::parse(R"([{"id":3,"v":"c"},{"id":1,"v":"a"},{"id":2,"v":"x"}])");
+        json patch = check_diff(source, target);
+        CHECK(patch == json::parse(R"([{"op":"move","from":"/2","path":"/0"},{"op":"replace","path":"/2/v","value":"x"}])"));
+    }
+
+    SECTION("added and removed elements")
+    {
+        json source = json::parse(R"([{"id":"a"},{"id":"b"},{"id":"c"},{"id":"d"}])");
+        json target = json::parse(R"([{"id":"e"},{"id":"d"},{"id":"b"},{"id":"f","x":1}])");
+        json patch = check_diff(source, target);
+        CHECK(patch.size() == 5);
+    }
+
+    SECTION("not applicable")
+    {
+        json source = json::parse(R"([{"id":1},{"id":1},{"id":2}])");
+        json target = json::parse(R"([{"id":2},{"id":1}])");
+        check_diff(source, target);
+
+        json source2 = json::parse(R"([{"id":1},2])");
+        json target2 = json::parse(R"([2,{"id":1}])");
+        check_diff(source2, target2);
+    }
+
+    SECTION("random permutations")
+    {
+        std::srand(7);
+        for (int n = 0; n < 200; ++n)
+        {
+            json source(jsoncons::json_array_arg);
+            json target(jsoncons::json_array_arg);
+            for (int i = 0; i < 20; ++i)
+            {
+                if (std::rand() % 4 != 0)
+                {
+                    source.push_back(json::parse("{\"id\":" + std::to_string(i) + ",\"v\":" + std::to_string(std::rand() % 3) + "}"));
+                }
+                if (std::rand() % 4 != 0)
+                {
+                    target.push_back(json::parse("{\"id\":" + std::to_string(i) + ",\"v\":" + std::to_string(std::rand() % 3) + "}"));
+                }
+            }
+            for (std::size_t i = target.size(); i > 1; --i)
+            {
+                std::swap(target[i-1], target[static_cast<std::size_t>(std::rand()) % i]);
+            }
+            check_diff(source, target);
+        }
+    }
+
+    SECTION("many moved elements")
+    {
+        std::srand(11);
+        json source(jsoncons::json_array_arg);
+        json target(jsoncons::json_array_arg);
+        for (int i = 0; i < 3000; ++i)
+        {
+            if (i % 10 != 0)
+            {
+                source.push_back(json::parse("{\"id\":" + std::to_string(i) + "}"));
+            }
+            if (i % 10 != 5)
+            {
+                target.push_back(json::parse("{\"id\":" + std::to_string(i) + "}"));
+            }
+        }
+        for (std::size_t i = target.size(); i > 1; --i)
+        {
+            std::swap(target[i-1], target[static_cast<std::size_t>(std::rand()) % i]);
+        }
+        json patch = check_diff(source, target);
+        // Each element is removed, added or moved at most once
+        CHECK(patch.size() <= 3000);
+    }
+}
+
+TEST_CASE("jsonpatch apply_patch rollback")
+{
+    json doc = json::parse(R"(
+        {"a": {"b": [1, 2, 3], "c": {"d": "x"}}, "e": [{"f": 1}, {"f": 2}]}
+    )");
+
+    auto check_rollback = [&](const json& patch, std::error_code expected_ec)
+    {
+        json target = doc;
+        std::error_code ec;
+        jsonpatch::apply_patch(target, patch, ec);
+        CHECK(ec == expected_ec);
+        CHECK(target == doc);
+    };
+
+    SECTION("move, then failure")
+    {
+        check_rollback(json::parse(R"([
+            {"op": "move", "from": "/a/b", "path": "/e/0/g"},
+            {"op": "move", "from": "/a/c", "path": "/a/b"},
+            {"op": "move", "from": "/e/1", "path": "/e/0"},
+            {"op": "test", "path": "/e/1/g", "value": [1, 2]}
+        ])"), jsonpatch::jsonpatch_errc::test_failed);
+    }
+
+    SECTION("move onto an existing member, then failure")
+    {
+        check_rollback(json::parse(R"([
+            {"op": "move", "from": "/a/c", "path": "/a/b"},
+            {"op": "remove", "path": "/a/missing"}
+        ])"), jsonpatch::jsonpatch_errc::remove_failed);
+    }
+
+    SECTION("move into its own child fails")
+    {
+        check_rollback(json::parse(R"([
+            {"op": "move", "from": "/a", "path": "/a/c/z"}
+        ])"), jsonpatch::jsonpatch_errc::copy_failed);
+    }
+
+    SECTION("root replaced, then failure")
+    {
+        check_rollback(json::parse(R"([
+            {"op": "replace", "path": "", "value": [1]},
+            {"op": "add", "path": "/-", "value": 2},
+            {"op": "add", "path": "/5", "value": 3}
+        ])"), jsonpatch::jsonpatch_errc::add_failed);
+    }
+
+    SECTION("invalid operation is found before the document is changed")
+    {
+        check_rollback(json::parse(R"([
+            {"op": "remove", "path": "/a"},
+            {"op": "add", "path": "/x"}
+        ])"), jsonpatch::jsonpatch_errc::invalid_patch);
+    }
+}
+
+namespace {
+
+    // Allocates with operator new, but throws std::bad_alloc when no
+    // allocations are left
+    std::size_t allocations_left = (std::numeric_limits<std::size_t>::max)();
+
+    template <class T>
+    struct failing_allocator
+    {
+        using value_type = T;
+
+        failing_allocator() = default;
+
+        template <class U>
+        failing_allocator(const failing_allocator<U>&) noexcept
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            if (allocations_left == 0)
+            {
+                throw std::bad_alloc();
+            }
+            --allocations_left;
+            return static_cast<T*>(::operator new(n*sizeof(T)));
+        }
+
+        void deallocate(T* p, std::size_t) noexcept
+        {
+            ::operator delete(p);
+        }
+
+        friend bool operator==(const failing_allocator&, const failing_allocator&) noexcept
+        {
+            return true;
+        }
+
+        friend bool operator!=(const failing_allocator&, const failing_allocator&) noexcept
+        {
+            return false;
+        }
+    };
+
+    using failing_json = jsoncons::basic_json<char,jsoncons::sorted_policy,failing_allocator<char>>;
+}
+
+TEST_CASE("jsonpatch apply_patch rollback when an operation throws")
+{
+    failing_json doc = failing_json::parse(R"(
+        {"a": {"b": [1, 2, 3], "c": {"d": "x"}}, "e": [{"f": 1}, {"f": 2}]}
+    )");
+    failing_json patch = failing_json::parse(R"([
+        {"op": "add", "path": "/a/b/1", "value": "a string that is too long to be stored inline"},
+        {"op": "replace", "path": "/a/c/d", "value": "another string that is too long to be stored inline"},
+        {"op": "move", "from": "/e/0", "path": "/a/f"},
+        {"op": "copy", "from": "/a/b", "path": "/g"},
+        {"op": "remove", "path": "/a/b/0"},
+        {"op": "add", "path": "/e/-", "value": {"h": "a third string that is too long to be stored inline"}}
+    ])");
+    failing_json expected = doc;
+    jsonpatch::apply_patch(expected, patch);
+    REQUIRE(expected != doc);
+
+    std::size_t failures = 0;
+    for (std::size_t limit = 0; limit < 100; ++limit)
+    {
+        failing_json target = doc;
+        std::error_code ec;
+        allocations_left = limit;
+        bool thrown = false;
+        try
+        {
+            jsonpatch::apply_patch(target, patch, ec);
+        }
+        catch (const std::bad_alloc&)
+        {
+            thrown = true;
+        }
+        allocations_left = (std::numeric_limits<std::size_t>::max)();
+        if (thrown)
+        {
+            ++failures;
+            CHECK(target == doc);
+        }
+        else
+        {
+            CHECK_FALSE(ec);
+            CHECK(target == expected);
+        }
+    }
+    CHECK(failures > 0);
+    CHECK(failures < 100);
+}
+
+TEST_CASE("jsonpatch apply_patch with many operations")
+{
+    json doc(jsoncons::json_object_arg);
+    doc["items"] = json(jsoncons::json_array_arg);
+    json patch(jsoncons::json_array_arg);
+    json expected = doc;
+    for (int i = 0; i < 500; ++i)
+    {
+        json record(jsoncons::json_object_arg);
+        record["id"] = i;
+        expected["items"].push_back(record);
+        patch.push_back(json::parse("{\"op\":\"add\",\"path\":\"/items/-\",\"value\":{\"id\":" + std::to_string(i) + "}}"));
+        patch.push_back(json::parse("{\"op\":\"add\",\"path\":\"/items/" + std::to_string(i) + "/tag\",\"value\":\"t\"}"));
+        patch.push_back(json::parse("{\"op\":\"test\",\"path\":\"/items/" + std::to_string(i) + "/id\",\"value\":" + std::to_string(i) + "}"));
+        expected["items"][i]["tag"] = "t";
+    }
+    for (int i = 0; i < 250; ++i)
+    {
+        patch.push_back(json::parse(R"({"op":"remove","path":"/items/0"})"));
+        expected["items"].erase(expected["items"].array_range().begin());
+    }
+    patch.push_back(json::parse(R"({"op":"copy","from":"/items/0","path":"/first"})"));
+    expected["first"] = expected["items"][0];
+
+    json target = doc;
+    std::error_code ec;
+    jsonpatch::apply_patch(target, patch, ec);
+    CHECK_FALSE(ec);
+    CHECK(target == expected);
+
+    patch.push_back(json::parse(R"({"op":"test","path":"/first/id","value":0})"));
+    target = doc;
+    jsonpatch::apply_patch(target, patch, ec);
+    CHECK(ec == jsonpatch::jsonpatch_errc::test_failed);
+    CHECK(target == doc);
+}
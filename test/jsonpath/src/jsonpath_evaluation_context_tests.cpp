@@ -0,0 +1,153 @@
+// Copyright 2022 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/jsonpath/jsonpath.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    const std::string input = R"(
+{
+    "store": {
+        "book": [
+            {"category": "reference", "author": "Nigel Rees", "title": "Sayings of the Century", "price": 8.95},
+            {"category": "fiction", "author": "Evelyn Waugh", "title": "Sword of Honour", "price": 12.99},
+            {"category": "fiction", "author": "Herman Melville", "title": "Moby Dick", "isbn": "0-553-21311-3", "price": 8.99}
+        ],
+        "bicycle": {"color": "red", "price": 19.95},
+        "tags": ["a", "b", "c"],
+        "name": "Bookstore"
+    }
+}
+    )";
+
+} // namespace
+
+TEST_CASE("jsonpath identifier and index chains")
+{
+    json root = json::parse(input);
+
+    auto check = [&](const std::string& path, const std::string& expected)
+    {
+        auto expr = jsonpath::make_expression<json>(path);
+        CHECK(expr.evaluate(root) == json::parse(expected));
+        CHECK(jsonpath::json_query(root, path) == json::parse(expected));
+    };
+
+    SECTION("values")
+    {
+        check("$.store.book[0].author", R"(["Nigel Rees"])");
+        check("$['store']['book'][2]['isbn']", R"(["0-553-21311-3"])");
+        check("$.store.book[-1].title", R"(["Moby Dick"])");
+        check("$.store.book.1.title", R"(["Sword of Honour"])");
+        check("$.store.book[3].title", R"([])");
+        check("$.store.book[-4].title", R"([])");
+        check("$.store.missing.title", R"([])");
+        check("$.store.bicycle[0]", R"([])");
+        check("$.store.book.length", R"([3])");
+        check("$.store.name.length", R"([9])");
+        check("$.store.tags[1]", R"(["b"])");
+    }
+
+    SECTION("chains followed by other selectors")
+    {
+        check("$.store.book[*].author", R"(["Nigel Rees","Evelyn Waugh","Herman Melville"])");
+        check("$.store.book[?(@.price < 10)].title", R"(["Sayings of the Century","Moby Dick"])");
+        check("$.store.book[0:2].price", R"([8.95,12.99])");
+        check("$..book[1].author", R"(["Evelyn Waugh"])");
+        check("$.store.book[0,2].author", R"(["Nigel Rees","Herman Melville"])");
+        check("$.store.book[0].author.length", R"([10])");
+    }
+
+    SECTION("paths")
+    {
+        auto expr = jsonpath::make_expression<json>("$.store.book[-1].title");
+        json result = expr.evaluate(root, jsonpath::result_options::path);
+        CHECK(result == json::parse(R"(["$['store']['book'][2]['title']"])"));
+
+        json result2 = jsonpath::json_query(root, "$.store.book.1.title", jsonpath::result_options::path);
+        CHECK(result2 == json::parse(R"(["$['store']['book'][1]['title']"])"));
+    }
+
+    SECTION("nodups and sort")
+    {
+        auto options = jsonpath::result_options::nodups | jsonpath::result_options::sort;
+        json result = jsonpath::json_query(root, "$.store.book[2,0,2].author", options);
+        CHECK(result == json::parse(R"(["Nigel Rees","Herman Melville"])"));
+    }
+}
+
+TEST_CASE("jsonpath evaluation_context tests")
+{
+    json root = json::parse(input);
+
+    SECTION("same results as without a context")
+    {
+        std::vector<std::string> paths = {
+            "$.store.book[0].author",
+            "$.store.book[*].title",
+            "$..price",
+            "$.store.book[?(@.price > avg($.store.book[*].price))].title",
+            "$.store.book.length",
+            "$.store.tags[-1]"
+        };
+
+        jsonpath::evaluation_context<json> context;
+        for (const auto& path : paths)
+        {
+            auto expr = jsonpath::make_expression<json>(path);
+            for (int i = 0; i < 3; ++i)
+            {
+                CHECK(expr.evaluate(context, root) == expr.evaluate(root));
+                CHECK(expr.evaluate(context, root, jsonpath::result_options::path) == 
+                      expr.evaluate(root, jsonpath::result_options::path));
+            }
+        }
+    }
+
+    SECTION("callback")
+    {
+        auto expr = jsonpath::make_expression<json>("$.store.book[*].title.length");
+        jsonpath::evaluation_context<json> context;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            std::vector<std::string> paths;
+            std::vector<std::size_t> lengths;
+            auto callback = [&](const std::string& path, const json& val)
+            {
+                paths.push_back(path);
+                lengths.push_back(val.as<std::size_t>());
+            };
+            expr.evaluate(context, root, callback, jsonpath::result_options::path);
+            REQUIRE(paths.size() == 3);
+            CHECK(paths[1] == "$['store']['book'][1]['title']['length']");
+            CHECK(lengths[0] == 22);
+            CHECK(lengths[2] == 9);
+        }
+    }
+
+    SECTION("many values")
+    {
+        auto expr = jsonpath::make_expression<json>("$.items[1].id");
+        jsonpath::evaluation_context<json> context;
+        for (int i = 0; i < 100; ++i)
+        {
+            json value(json_object_arg);
+            value["items"] = json(json_array_arg);
+            value["items"].push_back(json(json_object_arg));
+            value["items"].push_back(json(json_object_arg));
+            value["items"][1]["id"] = i;
+
+            json result = expr.evaluate(context, value);
+            REQUIRE(result.size() == 1);
+            CHECK(result[0].as<int>() == i);
+        }
+        context.reset();
+    }
+}
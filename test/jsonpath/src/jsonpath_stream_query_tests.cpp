@@ -0,0 +1,274 @@
+// Copyright 2022 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_cursor.hpp>
+#include <jsoncons_ext/jsonpath/jsonpath.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <catch/catch.hpp>
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    const std::string input = R"(
+{
+    "store": {
+        "book": [
+            {"category": "reference", "author": "Nigel Rees", "title": "Sayings of the Century", "price": 8.95},
+            {"category": "fiction", "author": "Evelyn Waugh", "title": "Sword of Honour", "price": 12.99},
+            {"category": "fiction", "author": "Herman Melville", "title": "Moby Dick", "isbn": "0-553-21311-3", "price": 8.99},
+            {"category": "fiction", "author": "J. R. R. Tolkien", "title": "The Lord of the Rings", "isbn": "0-395-19395-8", "price": 22.99}
+        ],
+        "bicycle": {"color": "red", "price": 19.95},
+        "tags": ["a", "b", "c", "d", "e"],
+        "it's": {"price": 1}
+    }
+}
+    )";
+
+    std::vector<std::pair<std::string,json>> stream_results(const std::string& text, const std::string& path)
+    {
+        std::vector<std::pair<std::string,json>> results;
+        json_string_cursor cursor(text);
+        jsonpath::stream_query<json>(cursor, path,
+            [&](const std::string& location, const json& val)
+            {
+                results.emplace_back(location, val);
+            });
+        return results;
+    }
+
+    // The locations and values that json_query selects, in the order of stream_query
+    std::vector<std::pair<std::string,json>> query_results(const std::string& text, const std::string& path)
+    {
+        std::vector<std::pair<std::string,json>> results;
+        json root = json::parse(text);
+        jsonpath::json_query(root, path,
+            [&](const std::string& location, const json& val)
+            {
+                results.emplace_back(location, val);
+            }, jsonpath::result_options::nodups | jsonpath::result_options::sort);
+        return results;
+    }
+
+} // namespace
+
+TEST_CASE("jsonpath stream_query tests")
+{
+    SECTION("same selections as json_query")
+    {
+        std::vector<std::string> paths = {
+            "$",
+            "$.store",
+            "$.store.book[0].author",
+            "$['store']['book'][2]['isbn']",
+            "$.store.book[*].author",
+            "$.store.book[1:3].title",
+            "$.store.book[:2].price",
+            "$.store.book[0:4:2].title",
+            "$.store.book[1:].title",
+            "$.store.book[0,3].title",
+            "$.store['bicycle','tags']",
+            "$.store.*",
+            "$..price",
+            "$..book[2]",
+            "$..*",
+            "$.store..price",
+            "$.store.book[?(@.price < 10)].title",
+            "$.store.book[?(@.price >= 12.99 && @.category == 'fiction')].author",
+            "$.store.book[?(@.isbn)].title",
+            "$.store.book[?(!@.isbn)].title",
+            "$.store.book[?(@.author == 'Nigel Rees' || @.price > 20)].title",
+            "$.store.tags[?(@ >= 'c')]",
+            "$..[?(@.price == 19.95)].color",
+            "$.store.book[4].title",
+            "$.store.missing",
+            "$.store.bicycle[0]",
+            "$.store.tags.name",
+            "$.store[\"it's\"].price"
+        };
+        for (const auto& path : paths)
+        {
+            auto expected = query_results(input, path);
+            auto actual = stream_results(input, path);
+            std::sort(actual.begin(), actual.end(),
+                      [](const std::pair<std::string,json>& a, const std::pair<std::string,json>& b){return a.first < b.first;});
+            std::sort(expected.begin(), expected.end(),
+                      [](const std::pair<std::string,json>& a, const std::pair<std::string,json>& b){return a.first < b.first;});
+            INFO(path);
+            CHECK(actual == expected);
+        }
+    }
+
+    SECTION("document order")
+    {
+        auto results = stream_results(input, "$.store.tags[3,0,2]");
+        REQUIRE(results.size() == 3);
+        CHECK(results[0].first == "$['store']['tags'][0]");
+        CHECK(results[1].first == "$['store']['tags'][2]");
+        CHECK(results[2].first == "$['store']['tags'][3]");
+
+        auto nested = stream_results(R"({"a":{"a":{"a":1}}})", "$..a");
+        REQUIRE(nested.size() == 3);
+        CHECK(nested[0].first == "$['a']");
+        CHECK(nested[1].first == "$['a']['a']");
+        CHECK(nested[2].first == "$['a']['a']['a']");
+        CHECK(nested[2].second == json(1));
+    }
+
+    SECTION("stops reading once nothing more can be selected")
+    {
+        // The text after the selected values is not valid JSON
+        std::string text = R"({"records":[{"id":1},{"id":2},{"id":3}], "rest": [1,2,)";
+        auto results = stream_results(text, "$.records[*].id");
+        REQUIRE(results.size() == 3);
+        CHECK(results[2].second == json(3));
+
+        std::string text2 = R"([{"id":1,"x":[1,2]},{"id":2, "x": tru)";
+        CHECK(stream_results(text2, "$[0].id").size() == 1);
+        CHECK(stream_results(text2, "$[:1]").size() == 1);
+
+        std::string text3 = R"({"a":1,"b":{"c":2,"d":[)";
+        auto results3 = stream_results(text3, "$.b.c");
+        REQUIRE(results3.size() == 1);
+        CHECK(results3[0].second == json(2));
+
+        CHECK_THROWS_AS(stream_results(text3, "$.b.d"), ser_error);
+        CHECK_THROWS_AS(stream_results(text3, "$..c"), ser_error);
+    }
+
+    SECTION("evaluate to array")
+    {
+        json_string_cursor cursor(input);
+        json result = jsonpath::stream_query<json>(cursor, "$.store.book[?(@.price < 10)].price");
+        CHECK(result == json::parse("[8.95,8.99]"));
+
+        auto expr = jsonpath::make_stream_expression<json>("$.store.bicycle.color");
+        json_string_cursor cursor2(input);
+        std::error_code ec;
+        CHECK(expr.evaluate(cursor2, ec) == json::parse(R"(["red"])"));
+        CHECK_FALSE(ec);
+    }
+
+    SECTION("cbor cursor")
+    {
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(json::parse(input), data);
+        cbor::cbor_bytes_cursor cursor(data);
+        json result = jsonpath::stream_query<json>(cursor, "$..book[?(@.isbn)].isbn");
+        CHECK(result == json::parse(R"(["0-553-21311-3","0-395-19395-8"])"));
+    }
+
+    SECTION("wjson")
+    {
+        std::wstring text = LR"({"a":[{"b":1},{"b":2}]})";
+        wjson_string_cursor cursor(text);
+        std::vector<std::wstring> locations;
+        jsonpath::stream_query<wjson>(cursor, L"$.a[*].b",
+            [&](const std::wstring& location, const wjson&){locations.push_back(location);});
+        REQUIRE(locations.size() == 2);
+        CHECK(locations[1] == L"$['a'][1]['b']");
+    }
+
+    SECTION("errors")
+    {
+        std::vector<std::string> not_streamable = {
+            "$.book[-1]",
+            "$.book[-2:]",
+            "$.book[:-1]",
+            "$.book[::-1]",
+            "$.book[(@.length-1)]",
+            "$.book[?(@.price > $.limit)]",
+            "$.book[?(length(@.title) > 10)]",
+            "$.book[?(@.title =~ /Moby/)]",
+            "$.book[?(@..price)]",
+            "$.."
+        };
+        for (const auto& path : not_streamable)
+        {
+            std::error_code ec;
+            jsonpath::make_stream_expression<json>(path, ec);
+            INFO(path);
+            CHECK(ec == jsonpath::jsonpath_errc::selector_not_streamable);
+        }
+
+        std::error_code ec;
+        jsonpath::make_stream_expression<json>("store.book", ec);
+        CHECK(ec == jsonpath::jsonpath_errc::expected_root_or_function);
+
+        ec.clear();
+        jsonpath::make_stream_expression<json>("$.book[0", ec);
+        CHECK(ec == jsonpath::jsonpath_errc::syntax_error);
+
+        ec.clear();
+        jsonpath::make_stream_expression<json>("$.book[::0]", ec);
+        CHECK(ec == jsonpath::jsonpath_errc::step_cannot_be_zero);
+
+        ec.clear();
+        jsonpath::make_stream_expression<json>("$.book[?(@.price = 1)]", ec);
+        CHECK(ec == jsonpath::jsonpath_errc::expected_separator);
+
+        CHECK_THROWS_AS(jsonpath::make_stream_expression<json>("$.book[?(@.price < 1"), jsonpath::jsonpath_error);
+    }
+
+    SECTION("rejects the same paths as make_expression")
+    {
+        std::vector<std::string> malformed = {
+            "",
+            "store.book",
+            "$.",
+            "$.book[",
+            "$.book[0",
+            "$.book[0,",
+            "$.book[0]]",
+            "$.book[::0]",
+            "$.book[1:2:3:4]",
+            "$.book[a]",
+            "$['book",
+            "$['book\\q']",
+            "$['book'",
+            "$.book[?(@.price = 1)]",
+            "$.book[?(@.price < 1",
+            "$.book[?(@.price < )]",
+            "$.book[?(@.price < 1 && )]",
+            "$.book[?(!)]",
+            "$.book.length()",
+            "$.book[0] x"
+        };
+        for (const auto& path : malformed)
+        {
+            std::error_code expected;
+            jsonpath::make_expression<json>(path, expected);
+            std::error_code ec;
+            jsonpath::make_stream_expression<json>(path, ec);
+            INFO(path);
+            CHECK(expected);
+            CHECK(ec == expected);
+
+            std::size_t expected_column = 0;
+            std::size_t column = 0;
+            JSONCONS_TRY
+            {
+                jsonpath::make_expression<json>(path);
+            }
+            JSONCONS_CATCH (const jsonpath::jsonpath_error& e)
+            {
+                expected_column = e.column();
+            }
+            JSONCONS_TRY
+            {
+                jsonpath::make_stream_expression<json>(path);
+            }
+            JSONCONS_CATCH (const jsonpath::jsonpath_error& e)
+            {
+                column = e.column();
+            }
+            CHECK(column == expected_column);
+        }
+    }
+}
@@ -10,6 +10,7 @@
 #include <iostream>
 #include <sstream>
 #include <vector>
+#include <algorithm>
 #include <map>
 #include <utility>
 #include <ctime>
@@ -640,3 +641,162 @@ TEST_CASE("to_uri_fragment test")
     }
 }
 
+
+TEST_CASE("compiled_json_pointer tests")
+{
+    json doc = json::parse(R"(
+        {
+           "foo": ["bar", "baz"],
+           "": 0,
+           "a/b": 1,
+           "m~n": 8,
+           "store": {"book": [{"title": "A", "price": 8}, {"title": "B", "price": 12}], "10": "ten"}
+        }
+    )");
+
+    SECTION("get")
+    {
+        std::vector<std::string> pointers = {"", "/foo", "/foo/0", "/", "/a~1b", "/m~0n", 
+                                             "/store/book/1/title", "/store/10", "#/foo/1"};
+        for (const auto& s : pointers)
+        {
+            jsonpointer::compiled_json_pointer location(s);
+            CHECK(jsonpointer::get(doc, location) == jsonpointer::get(doc, s));
+            CHECK(jsonpointer::contains(doc, location));
+        }
+    }
+
+    SECTION("tokens")
+    {
+        jsonpointer::compiled_json_pointer location("/store/10/a~1b/-");
+        REQUIRE(location.size() == 4);
+        CHECK(location.token(0) == "store");
+        CHECK_FALSE(location.is_index(0));
+        CHECK(location.is_index(1));
+        CHECK(location.index(1) == 10);
+        CHECK(location.token(2) == "a/b");
+        CHECK_FALSE(location.is_index(3));
+        CHECK(location.to_string() == "/store/10/a~1b/-");
+    }
+
+    SECTION("errors")
+    {
+        std::vector<std::pair<std::string,jsonpointer::jsonpointer_errc>> cases = {
+            {"/foo/2", jsonpointer::jsonpointer_errc::index_exceeds_array_size},
+            {"/foo/-", jsonpointer::jsonpointer_errc::index_exceeds_array_size},
+            {"/foo/x", jsonpointer::jsonpointer_errc::invalid_index},
+            {"/bar", jsonpointer::jsonpointer_errc::key_not_found},
+            {"/a~1b/c", jsonpointer::jsonpointer_errc::expected_object_or_array}
+        };
+        for (const auto& c : cases)
+        {
+            std::error_code ec;
+            jsonpointer::get(doc, jsonpointer::compiled_json_pointer(c.first), ec);
+            CHECK(ec == c.second);
+            CHECK_FALSE(jsonpointer::contains(doc, jsonpointer::compiled_json_pointer(c.first)));
+        }
+
+        std::error_code ec;
+        jsonpointer::compiled_json_pointer location("foo", ec);
+        CHECK(ec == jsonpointer::jsonpointer_errc::expected_slash);
+        CHECK_THROWS_AS(jsonpointer::compiled_json_pointer("/m~2n"), jsonpointer::jsonpointer_error);
+    }
+
+    SECTION("get non-const")
+    {
+        json target = doc;
+        jsonpointer::get(target, jsonpointer::compiled_json_pointer("/store/book/0/price")) = 9;
+        CHECK(target["store"]["book"][0]["price"] == 9);
+    }
+
+    SECTION("get_many")
+    {
+        std::vector<jsonpointer::compiled_json_pointer> locations;
+        for (const char* s : {"/store/book/1/title", "/foo/1", "/store/book/0/title", "/store/book/2/title",
+                              "/store/book/0/price", "/store/book", "", "/store/book/1/price", "/foo/0/x"})
+        {
+            locations.emplace_back(s);
+        }
+        std::sort(locations.begin(), locations.end());
+        CHECK(locations.front().empty());
+
+        std::vector<const json*> results;
+        jsonpointer::get_many(static_cast<const json&>(doc), locations, results);
+        REQUIRE(results.size() == locations.size());
+        for (std::size_t i = 0; i < locations.size(); ++i)
+        {
+            std::error_code ec;
+            const json& expected = jsonpointer::get(static_cast<const json&>(doc), locations[i], ec);
+            if (ec)
+            {
+                CHECK(results[i] == nullptr);
+            }
+            else
+            {
+                CHECK(results[i] == &expected);
+            }
+        }
+        CHECK(results.end() - std::remove(results.begin(), results.end(), nullptr) == 2);
+
+        json target = doc;
+        std::vector<json*> mutable_results;
+        jsonpointer::get_many(target, locations, mutable_results);
+        for (auto p : mutable_results)
+        {
+            if (p != nullptr && p->is_string())
+            {
+                *p = "changed";
+            }
+        }
+        CHECK(target["store"]["book"][1]["title"] == "changed");
+    }
+
+    SECTION("add, replace and remove")
+    {
+        std::vector<std::string> pointers = {"", "/foo/0", "/foo/1", "/foo/2", "/foo/3", "/foo/-", "/foo/x",
+                                             "/", "/a~1b", "/new", "/a~1b/c", "/store/book/1/title",
+                                             "/store/10", "/store/book/5/title", "/x/y/z"};
+        for (const auto& s : pointers)
+        {
+            jsonpointer::compiled_json_pointer location(s);
+            for (bool create_if_missing : {false, true})
+            {
+                json expected = doc;
+                std::error_code expected_ec;
+                jsonpointer::add(expected, s, json("value"), create_if_missing, expected_ec);
+                json target = doc;
+                std::error_code ec;
+                jsonpointer::add(target, location, json("value"), create_if_missing, ec);
+                CHECK(ec == expected_ec);
+                CHECK(target == expected);
+
+                expected = doc;
+                expected_ec = std::error_code{};
+                jsonpointer::replace(expected, s, json("value"), create_if_missing, expected_ec);
+                target = doc;
+                ec = std::error_code{};
+                jsonpointer::replace(target, location, json("value"), create_if_missing, ec);
+                CHECK(ec == expected_ec);
+                CHECK(target == expected);
+            }
+
+            json expected = doc;
+            std::error_code expected_ec;
+            jsonpointer::remove(expected, s, expected_ec);
+            json target = doc;
+            std::error_code ec;
+            jsonpointer::remove(target, location, ec);
+            CHECK(ec == expected_ec);
+            CHECK(target == expected);
+        }
+
+        json target = doc;
+        jsonpointer::add(target, jsonpointer::compiled_json_pointer("/foo/1"), "qux");
+        CHECK(target["foo"] == json::parse(R"(["bar", "qux", "baz"])"));
+        jsonpointer::replace(target, jsonpointer::compiled_json_pointer("/store/book/0/price"), 9);
+        CHECK(target["store"]["book"][0]["price"] == 9);
+        jsonpointer::remove(target, jsonpointer::compiled_json_pointer("/store/book/1"));
+        CHECK(target["store"]["book"].size() == 1);
+        CHECK_THROWS_AS(jsonpointer::remove(target, jsonpointer::compiled_json_pointer("/bar")), jsonpointer::jsonpointer_error);
+    }
+}
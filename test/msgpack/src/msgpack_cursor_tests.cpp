@@ -387,3 +387,104 @@ TEMPLATE_TEST_CASE("msgpack_cursor reset test", "",
         CHECK(cursor.done());
     }
 }
+
+namespace {
+
+    std::string event_name(const staj_event& event)
+    {
+        std::ostringstream os;
+        os << event.event_type();
+        if (event.event_type() == staj_event_type::key || event.event_type() == staj_event_type::string_value)
+        {
+            os << " " << event.get<std::string>();
+        }
+        return os.str();
+    }
+
+    // The events read from a cursor, skipping the values of members whose names begin with prefix
+    std::vector<std::string> read_skipping(staj_cursor& cursor, const std::string& prefix)
+    {
+        std::vector<std::string> events;
+        bool skip_next = false;
+        for (; !cursor.done(); cursor.next())
+        {
+            events.push_back(event_name(cursor.current()));
+            if (skip_next)
+            {
+                staj_event_type type = cursor.current().event_type();
+                cursor.skip();
+                if (type == staj_event_type::begin_object || type == staj_event_type::begin_array)
+                {
+                    events.push_back(event_name(cursor.current()));
+                }
+                skip_next = false;
+            }
+            else if (cursor.current().event_type() == staj_event_type::key)
+            {
+                skip_next = cursor.current().get<std::string>().compare(0, prefix.size(), prefix) == 0;
+            }
+        }
+        return events;
+    }
+
+} // namespace
+
+TEST_CASE("msgpack_cursor skip test")
+{
+    std::string text = R"(
+{
+    "a": {"b": [1, {"c": "}]"}], "d": "x"},
+    "skip1": [[1, 2, {"x": "yyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyy"}], {}, [], "]]", -5, -100000, 1.5, true, null, 100000, 10000000000],
+    "e": "yyyyyyyyyyyyyyyyyyyyyyyyyyyyyy",
+    "skip2": {"g": {"h": [true, null, 1.5, 1.0e300, false]}},
+    "skip3": 10,
+    "i": [],
+    "skip4": [[[[]]], {"": {"": {}}}]
+}
+    )";
+
+    json_string_cursor json_cursor(text);
+    std::vector<std::string> expected = read_skipping(json_cursor, "skip");
+
+    std::vector<uint8_t> data;
+    ojson j = ojson::parse(text);
+    j["skip4"][1]["bin"] = ojson(byte_string_arg, std::vector<uint8_t>(300, 'z'));
+    j["skip4"][1]["ext"] = ojson(byte_string_arg, std::vector<uint8_t>{1,2,3,4}, 7);
+    j["skip4"][1]["array"] = ojson::make_array<1>(20, ojson(-1));
+    msgpack::encode_msgpack(j, data);
+
+    SECTION("bytes source")
+    {
+        msgpack::msgpack_bytes_cursor cursor(data);
+        CHECK(read_skipping(cursor, "skip") == expected);
+
+        msgpack::msgpack_bytes_cursor cursor2(data);
+        cursor2.skip();
+        CHECK(cursor2.current().event_type() == staj_event_type::end_object);
+        cursor2.next();
+        CHECK(cursor2.done());
+    }
+
+    SECTION("stream source")
+    {
+        std::istringstream is(std::string(reinterpret_cast<const char*>(data.data()), data.size()));
+        msgpack::msgpack_stream_cursor cursor(is);
+        CHECK(read_skipping(cursor, "skip") == expected);
+    }
+
+    SECTION("unexpected eof")
+    {
+        std::vector<uint8_t> data2;
+        msgpack::encode_msgpack(json::parse(R"([[1,"abcdef"]])"), data2);
+        data2.pop_back();
+
+        msgpack::msgpack_bytes_cursor cursor(data2);
+        cursor.next();
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == msgpack::msgpack_errc::unexpected_eof);
+
+        msgpack::msgpack_bytes_cursor cursor2(data2);
+        CHECK_THROWS_AS(cursor2.skip(), ser_error);
+    }
+}
@@ -186,3 +186,180 @@ TEMPLATE_TEST_CASE("test_msgpack_encoder_reset", "",
     f.encoder.flush();
     CHECK(f.bytes2() == expected_full);
 }
+
+namespace {
+
+    // A stream buffer that cannot seek, like a pipe
+    class unseekable_buf : public std::streambuf
+    {
+    public:
+        std::string data;
+    protected:
+        int_type overflow(int_type ch) override
+        {
+            if (ch != traits_type::eof())
+            {
+                data.push_back(static_cast<char>(ch));
+            }
+            return ch;
+        }
+        std::streamsize xsputn(const char* s, std::streamsize n) override
+        {
+            data.append(s, static_cast<std::size_t>(n));
+            return n;
+        }
+    };
+
+    // A sink with only push_back and flush
+    class push_back_sink
+    {
+        std::vector<uint8_t>* buf_ptr_;
+    public:
+        using value_type = uint8_t;
+
+        push_back_sink(std::vector<uint8_t>& buf)
+            : buf_ptr_(std::addressof(buf))
+        {
+        }
+
+        void push_back(uint8_t b)
+        {
+            buf_ptr_->push_back(b);
+        }
+
+        void flush()
+        {
+        }
+    };
+
+    std::string make_large_json()
+    {
+        std::string s = R"({"small":{"a":[1,2,3]},"medium":[)";
+        for (int i = 0; i < 20; ++i)
+        {
+            s += (i > 0 ? "," : "") + std::to_string(i);
+        }
+        s += R"(],"large":[)";
+        for (int i = 0; i < 70000; ++i)
+        {
+            s += (i > 0 ? "," : "") + std::string(R"({"id":)") + std::to_string(i) + R"(,"tags":["x","y"]})";
+        }
+        s += "]}";
+        return s;
+    }
+}
+
+TEST_CASE("msgpack encoder with containers of unknown length")
+{
+    SECTION("transcode json text")
+    {
+        std::string input = R"({"a":[1,2,{"b":null}],"c":"text","d":{},"e":[],"f":[true,false,1.5]})";
+
+        std::vector<uint8_t> v;
+        {
+            msgpack::msgpack_bytes_encoder encoder(v);
+            json_string_reader reader(input, encoder);
+            reader.read();
+        }
+
+        std::vector<uint8_t> expected;
+        msgpack::encode_msgpack(json::parse(input), expected);
+        CHECK(v == expected);
+    }
+
+    SECTION("sink without append")
+    {
+        std::string input = R"({"a":[1,2,{"b":null}],"c":"a longer text string","d":{},"e":[]})";
+
+        std::vector<uint8_t> v;
+        {
+            msgpack::basic_msgpack_encoder<push_back_sink> encoder(v);
+            json_string_reader reader(input, encoder);
+            reader.read();
+        }
+
+        std::vector<uint8_t> expected;
+        msgpack::encode_msgpack(json::parse(input), expected);
+        CHECK(v == expected);
+    }
+
+    SECTION("map 16 and array 16 headers")
+    {
+        std::vector<uint8_t> v;
+        msgpack::msgpack_bytes_encoder encoder(v);
+        encoder.begin_object();
+        for (int i = 0; i < 16; ++i)
+        {
+            encoder.key(std::to_string(i));
+            encoder.begin_array();
+            for (int j = 0; j < i; ++j)
+            {
+                encoder.uint64_value(j);
+            }
+            encoder.end_array();
+        }
+        encoder.end_object();
+        encoder.flush();
+
+        REQUIRE_FALSE(v.empty());
+        CHECK(v[0] == msgpack::msgpack_type::map16_type);
+        json j = msgpack::decode_msgpack<json>(v);
+        CHECK(j.size() == 16);
+        CHECK(j["15"].size() == 15);
+        CHECK(j["3"] == json::parse("[0,1,2]"));
+    }
+
+    SECTION("known length inside unknown length")
+    {
+        std::vector<uint8_t> v;
+        msgpack::msgpack_bytes_encoder encoder(v);
+        encoder.begin_array();
+        encoder.begin_array(2);
+        encoder.string_value("a");
+        encoder.begin_object();
+        encoder.key("b");
+        encoder.int64_value(-1);
+        encoder.end_object();
+        encoder.end_array();
+        encoder.end_array();
+        encoder.flush();
+
+        CHECK(msgpack::decode_msgpack<json>(v) == json::parse(R"([["a",{"b":-1}]])"));
+    }
+
+    SECTION("large document")
+    {
+        std::string input = make_large_json();
+        ojson expected_value = ojson::parse(input);
+        std::vector<uint8_t> expected;
+        msgpack::encode_msgpack(expected_value, expected);
+
+        // Headers of large containers are reserved and patched in place
+        std::vector<uint8_t> v;
+        {
+            msgpack::msgpack_bytes_encoder encoder(v);
+            json_string_reader reader(input, encoder);
+            reader.read();
+        }
+        CHECK(msgpack::decode_msgpack<ojson>(v) == expected_value);
+
+        std::ostringstream os;
+        {
+            msgpack::msgpack_stream_encoder encoder(os);
+            json_string_reader reader(input, encoder);
+            reader.read();
+        }
+        std::string s = os.str();
+        CHECK(msgpack::decode_msgpack<ojson>(std::vector<uint8_t>(s.begin(), s.end())) == expected_value);
+
+        // Without seeking, the smallest headers are written
+        unseekable_buf buf;
+        {
+            std::ostream unseekable(&buf);
+            msgpack::msgpack_stream_encoder encoder(unseekable);
+            json_string_reader reader(input, encoder);
+            reader.read();
+        }
+        CHECK(std::vector<uint8_t>(buf.data.begin(), buf.data.end()) == expected);
+    }
+}
@@ -182,3 +182,51 @@ TEST_CASE("decode indefinite length ubjson arrays and maps")
 }
 
 
+TEST_CASE("decode ubjson strongly typed numeric arrays")
+{
+    SECTION("int16 to json and to std::vector")
+    {
+        std::vector<uint8_t> v = {'[','$','I','#','i',3, 0x01,0x00, 0xff,0x00, 0x00,0x05};
+        check_decode_ubjson(v, json::parse("[256,-256,5]"));
+
+        auto u = ubjson::decode_ubjson<std::vector<int16_t>>(v);
+        CHECK(u == std::vector<int16_t>{256,-256,5});
+        auto w = ubjson::decode_ubjson<std::vector<double>>(v);
+        CHECK(w == std::vector<double>{256,-256,5});
+    }
+
+    SECTION("float64 and uint8")
+    {
+        std::vector<uint8_t> v = {'[','$','D','#','i',2,
+                                  0x3f,0xf0,0,0,0,0,0,0,
+                                  0xbf,0xf8,0,0,0,0,0,0};
+        check_decode_ubjson(v, json::parse("[1.0,-1.5]"));
+        CHECK(ubjson::decode_ubjson<std::vector<double>>(v) == std::vector<double>{1.0,-1.5});
+
+        std::vector<uint8_t> b = {'[','$','U','#','i',3, 1,2,255};
+        check_decode_ubjson(b, json::parse("[1,2,255]"));
+        CHECK(ubjson::decode_ubjson<std::vector<int>>(b) == std::vector<int>{1,2,255});
+    }
+
+    SECTION("typed array in an object")
+    {
+        std::vector<uint8_t> v = {'{','U',0x01,'a','[','$','l','#','i',2, 0,0,0,1, 0xff,0xff,0xff,0xfe,
+                                  'U',0x01,'b','T','}'};
+        check_decode_ubjson(v, json::parse(R"({"a":[1,-2],"b":true})"));
+
+        std::vector<uint8_t> w = {'{','#','i',1,'U',0x01,'a','[','$','d','#','i',1, 0x3f,0x80,0,0};
+        auto m = ubjson::decode_ubjson<std::map<std::string,std::vector<float>>>(w);
+        CHECK(m["a"] == std::vector<float>{1.0f});
+    }
+
+    SECTION("truncated")
+    {
+        std::vector<uint8_t> v = {'[','$','I','#','i',3, 0x01,0x00, 0xff};
+        std::error_code ec;
+        json_decoder<json> decoder;
+        ubjson::basic_ubjson_reader<jsoncons::bytes_source> reader(v, decoder);
+        reader.read(ec);
+        CHECK(ec == ubjson::ubjson_errc::unexpected_eof);
+    }
+}
+
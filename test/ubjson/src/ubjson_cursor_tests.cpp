@@ -414,3 +414,29 @@ TEMPLATE_TEST_CASE("ubjson_cursor reset test", "",
         CHECK(cursor.done());
     }
 }
+
+TEST_CASE("ubjson_cursor strongly typed array")
+{
+    std::vector<uint8_t> data = {'[','#','i',2, '[','$','I','#','i',2, 0x01,0x00, 0xff,0x00, 'T'};
+
+    ubjson::ubjson_bytes_cursor cursor(data);
+    CHECK(cursor.current().event_type() == staj_event_type::begin_array);
+    cursor.next();
+    CHECK(cursor.current().event_type() == staj_event_type::begin_array);
+    CHECK(cursor.current().size() == 2);
+    cursor.next();
+    CHECK(cursor.current().event_type() == staj_event_type::int64_value);
+    CHECK(cursor.current().get<int>() == 256);
+    cursor.next();
+    CHECK(cursor.current().event_type() == staj_event_type::int64_value);
+    CHECK(cursor.current().get<int>() == -256);
+    cursor.next();
+    CHECK(cursor.current().event_type() == staj_event_type::end_array);
+    cursor.next();
+    CHECK(cursor.current().event_type() == staj_event_type::bool_value);
+    CHECK(cursor.current().get<bool>());
+    cursor.next();
+    CHECK(cursor.current().event_type() == staj_event_type::end_array);
+    cursor.next();
+    CHECK(cursor.done());
+}